@@ -1051,11 +1051,17 @@ void achievements_tracker::clear()
     achievements_status_.clear();
 }
 
-void achievements_tracker::notify( const cata::event &e )
+enum_bitset<event_type> achievements_tracker::notified_types() const
 {
-    if( e.type() == event_type::game_start ) {
+    return enum_bitset<event_type>();
+}
+
+void achievements_tracker::listen_to( event_bus &bus )
+{
+    bus.listen<event_type::game_start>( this,
+    [this]( const cata::typed_event<event_type::game_start> & ) {
         init_watchers();
-    }
+    } );
 }
 
 void achievements_tracker::serialize( JsonOut &jsout ) const
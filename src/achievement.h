@@ -218,7 +218,8 @@ class achievements_tracker : public event_subscriber
         std::string ui_text_for( const achievement * ) const;
 
         void clear();
-        void notify( const cata::event & ) override;
+        enum_bitset<event_type> notified_types() const override;
+        void listen_to( event_bus & ) override;
 
         void serialize( JsonOut & ) const;
         void deserialize( JsonIn & );
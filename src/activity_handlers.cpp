@@ -1521,7 +1521,7 @@ void activity_handlers::milk_finish( player_activity *act, player *p )
         milked_item->second = 0;
         p->add_msg_if_player( _( "The %s's udders run dry." ), source_mon->get_name() );
     } else {
-        milked_item->second = milk->charges;
+        milked_item->second = milk->charges();
     }
     // if the monster was not manually tied up, but needed to be fixed in place temporarily then
     // remove that now.
@@ -1549,9 +1549,9 @@ void activity_handlers::fill_liquid_do_turn( player_activity *act, player *p )
                 case LST_INFINITE_MAP:
                     source = here.water_from( pos );
                     charges = std::max( 1, source->charges_per_volume( volume_per_second ) );
-                    source->charges = charges;
+                    source->set_charges( charges );
                     source = cb( std::move( source ) );
-                    return source && source->charges == charges;
+                    return source && source->charges() == charges;
                 case LST_VEHICLE:
                     auto vp = here.veh_at( pos );
                     if( !vp ) {
@@ -1563,9 +1563,9 @@ void activity_handlers::fill_liquid_do_turn( player_activity *act, player *p )
                     }
                     item &source_it = base.contents.back();
                     charges = std::max( 1, source_it.charges_per_volume( volume_per_second ) );
-                    int orig = source_it.charges;
+                    int orig = source_it.charges();
                     source_it.attempt_split( charges, cb );
-                    return source_it.charges == 0 || source_it.charges == orig;
+                    return source_it.charges() == 0 || source_it.charges() == orig;
             }
             return false;
         };
@@ -2521,7 +2521,7 @@ item *get_fake_tool( hack_type_t hack_type, const player_activity &activity )
             const vehicle &veh = pos->vehicle();
 
             fake_item = item::spawn_temporary( itype_welder, calendar::turn, 0 );
-            fake_item->charges = veh.fuel_left( itype_battery );
+            fake_item->set_charges( veh.fuel_left( itype_battery ) );
 
             break;
         }
@@ -2547,7 +2547,7 @@ item *get_fake_tool( hack_type_t hack_type, const player_activity &activity )
                     const tripoint_abs_ms abspos( m.getabs( position ) );
                     const distribution_grid &grid = get_distribution_grid_tracker().grid_at( abspos );
                     fake_item = item::spawn_temporary( item_type.get_id(), calendar::turn, 0 );
-                    fake_item->charges = grid.get_resource( true );
+                    fake_item->set_charges( grid.get_resource( true ) );
                     break;
                 }
             }
@@ -2566,7 +2566,7 @@ void discharge_real_power_source(
     const int original_charges
 )
 {
-    const int used_charges = original_charges - tool.charges;
+    const int used_charges = original_charges - tool.charges();
 
     if( used_charges <= 0 ) {
         return;
@@ -2675,7 +2675,7 @@ void activity_handlers::repair_item_finish( player_activity *act, player *p )
         ploc = &*act->targets[0];
     }
     const tripoint hack_position = hack_type ? hack::get_position( *act ) : tripoint{};
-    const int hack_original_charges = fake_tool ? fake_tool->charges : 0;
+    const int hack_original_charges = fake_tool ? fake_tool->charges() : 0;
 
     item *main_tool = nullptr;
     if( hack_type.has_value() ) {
@@ -3813,9 +3813,9 @@ void activity_handlers::craft_do_turn( player_activity *act, player *p )
 
     // Base moves for batch size with no speed modifier or assistants
     // Must ensure >= 1 so we don't divide by 0;
-    const double base_total_moves = std::max( 1, rec.batch_time( craft->charges, 1.0f, 0 ) );
+    const double base_total_moves = std::max( 1, rec.batch_time( craft->charges(), 1.0f, 0 ) );
     // Current expected total moves, includes crafting speed modifiers and assistants
-    const double cur_total_moves = std::max( 1, rec.batch_time( craft->charges, crafting_speed,
+    const double cur_total_moves = std::max( 1, rec.batch_time( craft->charges(), crafting_speed,
                                    assistants ) );
     // Delta progress in moves adjusted for current crafting speed
     const double delta_progress = p->get_moves() * base_total_moves / cur_total_moves;
@@ -3857,7 +3857,7 @@ void activity_handlers::craft_do_turn( player_activity *act, player *p )
         complete_craft( *p, *craft_copy, bench_location{bench_t, bench_pos} );
         act->targets.front()->detach();
         if( is_long ) {
-            if( p->making_would_work( p->lastrecipe, craft_copy->charges ) ) {
+            if( p->making_would_work( p->lastrecipe, craft_copy->charges() ) ) {
                 p->last_craft->execute( bench_pos );
             }
         }
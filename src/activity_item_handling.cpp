@@ -499,7 +499,7 @@ static std::list<pickup::act_item> convert_to_items( Character &p,
                 if( obtained >= count ) {
                     break;
                 }
-                const int qty = it->count_by_charges() ? std::min<int>( it->charges, count - obtained ) : 1;
+                const int qty = it->count_by_charges() ? std::min<int>( it->charges(), count - obtained ) : 1;
                 obtained += qty;
                 res.emplace_back( *it, qty, it->obtain_cost( p, qty ) );
             }
@@ -800,10 +800,10 @@ void wash_activity_actor::finish( player_activity &act, Character &who )
             if( i.count > it.count() ) {
                 debugmsg( "Invalid item count to wash: tried %d, max %d", i.count, it.count() );
             }
-            it.item_tags.erase( flag_FILTHY );
+            it.unset_flag( flag_FILTHY );
         } else {
             detached_ptr<item> it2 = it.split( i.count );
-            it2->item_tags.erase( flag_FILTHY );
+            it2->unset_flag( flag_FILTHY );
         }
         who.on_worn_item_washed( it );
     }
@@ -1342,12 +1342,12 @@ static bool are_requirements_nearby( const std::vector<tripoint> &loot_spots,
                 const std::optional<vpart_reference> weldpart = vp.part_with_feature( "WELDRIG", true );
                 if( weldpart ) {
                     item *welder = item::spawn_temporary( itype_welder, calendar::start_of_cataclysm );
-                    welder->charges = veh.fuel_left( itype_battery, true );
+                    welder->set_charges( veh.fuel_left( itype_battery, true ) );
                     welder->set_flag( flag_PSEUDO );
                     temp_inv.add_item( *welder );
                     item *soldering_iron = item::spawn_temporary( itype_soldering_iron,
                                            calendar::start_of_cataclysm );
-                    soldering_iron->charges = veh.fuel_left( itype_battery, true );
+                    soldering_iron->set_charges( veh.fuel_left( itype_battery, true ) );
                     soldering_iron->set_flag( flag_PSEUDO );
                     temp_inv.add_item( *soldering_iron );
                 }
@@ -3407,11 +3407,11 @@ void try_fuel_fire( player_activity &act, player &p, const bool starting_fire )
     }
     // Only use tinder if we didn't find any other valid fuel to use
     if( found ) {
-        const int quantity = std::max( 1, std::min( found->charges, found->charges_per_volume( 250_ml ) ) );
+        const int quantity = std::max( 1, std::min( found->charges(), found->charges_per_volume( 250_ml ) ) );
         // Note: move_item() handles messages (they're the generic "you drop x")
         move_item( p, *found, quantity, *refuel_spot, *best_fire );
     } else if( found_tinder ) {
-        const int quantity = std::max( 1, std::min( found_tinder->charges,
+        const int quantity = std::max( 1, std::min( found_tinder->charges(),
                                        found_tinder->charges_per_volume( 250_ml ) ) );
         move_item( p, *found_tinder, quantity, *refuel_spot, *best_fire );
     }
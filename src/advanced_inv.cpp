@@ -335,7 +335,7 @@ void advanced_inventory::print_items( const advanced_inventory_pane &pane, bool
             //Count charges
             unsigned int charges_total = 0;
             for( const auto item : sitem.items ) {
-                charges_total += item->charges;
+                charges_total += item->charges();
             }
             if( stolen ) {
                 item_name = string_format( "%s %s", stolen_string, it.display_money( sitem.items.size(),
@@ -437,8 +437,8 @@ struct advanced_inv_sorter {
                 }
                 break;
             case SORTBY_CHARGES:
-                if( d1.items.front()->charges != d2.items.front()->charges ) {
-                    return d1.items.front()->charges > d2.items.front()->charges;
+                if( d1.items.front()->charges() != d2.items.front()->charges() ) {
+                    return d1.items.front()->charges() > d2.items.front()->charges();
                 }
                 break;
             case SORTBY_CATEGORY:
@@ -851,7 +851,7 @@ bool advanced_inventory::move_all_items( bool nested_call )
                 if( !spane.is_filtered( *it ) ) {
                     int count;
                     if( it->count_by_charges() )                         {
-                        count = it->charges;
+                        count = it->charges();
                     } else {
                         count = stack.size();
                     }
@@ -1676,7 +1676,7 @@ bool advanced_inventory::move_content( item &src_container, item &dest_container
         return false;
     }
     if( src_container.is_non_resealable_container() ) {
-        if( src_contents.charges > amount ) {
+        if( src_contents.charges() > amount ) {
             popup( _( "You can't partially unload liquids from unsealable container." ) );
             return false;
         }
@@ -1702,7 +1702,7 @@ bool advanced_inventory::query_charges( aim_location destarea, const advanced_in
     const bool by_charges = it.count_by_charges();
     const units::volume free_volume = p.free_volume( panes[dest].in_vehicle() );
     // default to move all, unless if being equipped
-    const int input_amount = by_charges ? it.charges : action == "MOVE_SINGLE_ITEM" ? 1 : sitem.stacks;
+    const int input_amount = by_charges ? it.charges() : action == "MOVE_SINGLE_ITEM" ? 1 : sitem.stacks;
     // there has to be something to begin with
     assert( input_amount > 0 );
     amount = input_amount;
@@ -1744,7 +1744,7 @@ bool advanced_inventory::query_charges( aim_location destarea, const advanced_in
     }
     // Inventory has a weight capacity, map and vehicle don't have that
     if( destarea == AIM_INVENTORY  || destarea == AIM_WORN ) {
-        const units::mass unitweight = it.weight() / ( by_charges ? it.charges : 1 );
+        const units::mass unitweight = it.weight() / ( by_charges ? it.charges() : 1 );
         const units::mass max_weight = g->u.has_trait( trait_DEBUG_STORAGE ) ?
                                        units::mass_max : g->u.weight_capacity() * 4 - g->u.weight_carried();
         if( unitweight > 0_gram && unitweight * amount > max_weight ) {
@@ -1766,7 +1766,7 @@ bool advanced_inventory::query_charges( aim_location destarea, const advanced_in
     }
     // Now we have the final amount. Query if requested or limited room left.
     if( action == "MOVE_VARIABLE_ITEM" || amount < input_amount ) {
-        const int count = by_charges ? it.charges : sitem.stacks;
+        const int count = by_charges ? it.charges() : sitem.stacks;
         const char *msg = nullptr;
         std::string popupmsg;
         if( amount >= input_amount ) {
@@ -0,0 +1,85 @@
+#include "async_file_writer.h"
+
+#include <exception>
+#include <ostream>
+#include <utility>
+
+#include "fstream_utils.h"
+#include "output.h"
+#include "translations.h"
+
+async_file_writer::~async_file_writer()
+{
+    if( worker.joinable() ) {
+        worker.join();
+    }
+}
+
+void async_file_writer::begin_capture()
+{
+    // One batch at a time, the new one may remove or rewrite files of the old one
+    wait();
+    capture = true;
+}
+
+void async_file_writer::end_capture()
+{
+    capture = false;
+    if( captured.empty() ) {
+        return;
+    }
+    writing = std::move( captured );
+    captured.clear();
+    for( const pending_file &file : writing ) {
+        writing_paths.insert( file.path );
+    }
+    done = false;
+    worker = std::thread( [this]() {
+        for( pending_file &file : writing ) {
+            try {
+                // Any of the below may throw. ofstream_wrapper will clean up the temporary path on its own.
+                ofstream_wrapper fout( file.path, cata_ios_mode::binary );
+                fout.stream() << file.data;
+                fout.close();
+            } catch( const std::exception &err ) {
+                file.error = err.what();
+            }
+            file.data.clear();
+            file.data.shrink_to_fit();
+        }
+        done = true;
+    } );
+}
+
+void async_file_writer::add( const std::string &path, std::string data )
+{
+    captured.push_back( { path, std::move( data ), std::string() } );
+}
+
+void async_file_writer::wait_for( const std::string &path )
+{
+    if( writing_paths.count( path ) != 0 ) {
+        wait();
+    }
+}
+
+void async_file_writer::wait()
+{
+    if( !worker.joinable() ) {
+        return;
+    }
+    worker.join();
+    for( const pending_file &file : writing ) {
+        if( !file.error.empty() ) {
+            popup( _( "Failed to write \"%1$s\": %2$s" ), file.path, file.error );
+        }
+    }
+    writing.clear();
+    writing_paths.clear();
+}
+
+async_file_writer &get_async_file_writer()
+{
+    static async_file_writer singleton;
+    return singleton;
+}
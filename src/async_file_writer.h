@@ -0,0 +1,71 @@
+#pragma once
+#ifndef CATA_SRC_ASYNC_FILE_WRITER_H
+#define CATA_SRC_ASYNC_FILE_WRITER_H
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#include "mingw.thread.h"
+#endif
+
+/**
+ * Writes saved files on a worker thread, so saving doesn't stall the game on file I/O.
+ *
+ * While capturing, @ref write_to_file serializes into memory on the calling thread and
+ * queues the result here instead of writing it. That is the snapshot: once it's taken the
+ * game can change freely. @ref end_capture then writes the queued files on a worker thread,
+ * each one to a temporary file that is renamed over the old one, so a crash mid-write
+ * leaves the previous save intact.
+ *
+ * Reading or writing a file that is still being written waits for the worker first.
+ */
+class async_file_writer
+{
+    public:
+        async_file_writer() = default;
+        async_file_writer( const async_file_writer & ) = delete;
+        async_file_writer &operator=( const async_file_writer & ) = delete;
+        ~async_file_writer();
+
+        /** Waits for the previous batch, then starts capturing. */
+        void begin_capture();
+        /** Stops capturing and starts writing the captured files. */
+        void end_capture();
+        bool capturing() const {
+            return capture;
+        }
+        void add( const std::string &path, std::string data );
+
+        /** Waits for the worker if it is writing @p path. */
+        void wait_for( const std::string &path );
+        /** Waits for the worker, and shows a popup for every file it failed to write. */
+        void wait();
+        /** Whether the worker is done, so @ref wait won't block. */
+        bool finished() const {
+            return done;
+        }
+
+    private:
+        struct pending_file {
+            std::string path;
+            std::string data;
+            std::string error;
+        };
+
+        bool capture = false;
+        std::vector<pending_file> captured;
+        // Owned by the worker until it is joined
+        std::vector<pending_file> writing;
+        // Paths of the files in writing, only used by the main thread
+        std::unordered_set<std::string> writing_paths;
+        std::thread worker;
+        std::atomic<bool> done{ true };
+};
+
+async_file_writer &get_async_file_writer();
+
+#endif // CATA_SRC_ASYNC_FILE_WRITER_H
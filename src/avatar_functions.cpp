@@ -673,10 +673,10 @@ bool unload_item( avatar &you, item &loc )
                 liquids.push_back( &*contained );
                 return std::move( contained );
             }
-            int old_charges = contained->charges;
+            int old_charges = contained->charges();
             item &obj = *contained;
             contained = add_or_drop_with_msg( you, std::move( contained ), true );
-            if( !contained || contained->charges != old_charges ) {
+            if( !contained || contained->charges() != old_charges ) {
                 you.mod_moves( -you.item_handling_cost( obj ) );
                 changed = true;
             }
@@ -753,8 +753,8 @@ bool unload_item( avatar &you, item &loc )
         int mv = 0;
         int qty = 0;
         it.contents.remove_top_items_with( [&]( detached_ptr<item> &&contained ) {
-            mv += you.item_reload_cost( it, *contained, contained->charges ) / 2;
-            qty += contained->charges;
+            mv += you.item_reload_cost( it, *contained, contained->charges() ) / 2;
+            qty += contained->charges();
             return add_or_drop_with_msg( you, std::move( contained ), true );
         } );
 
@@ -817,7 +817,7 @@ bool unload_item( avatar &you, item &loc )
             ammo = add_or_drop_with_msg( you, std::move( ammo ), false );
 
             if( ammo ) {
-                qty -= ammo->charges; // only handled part (or none) of the liquid
+                qty -= ammo->charges(); // only handled part (or none) of the liquid
             }
             if( qty <= 0 ) {
                 return false; // no liquid was moved
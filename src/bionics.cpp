@@ -859,10 +859,10 @@ bool Character::activate_bionic( bionic &bio, bool eff_only, bool *close_bionics
                         detached_ptr<item> water = item::spawn( itype_water_clean, calendar::turn, avail );
                         liquid_handler::consume_liquid( std::move( water ) );
                         // NOLINTNEXTLINE(bugprone-use-after-move)
-                        if( water && water->charges < avail ) {
+                        if( water && water->charges() < avail ) {
                             add_msg_activate();
                             extracted = true;
-                            it->set_var( "remaining_water", static_cast<int>( water->charges ) );
+                            it->set_var( "remaining_water", static_cast<int>( water->charges() ) );
                         }
                         break;
                     }
@@ -1002,7 +1002,7 @@ bool Character::activate_bionic( bionic &bio, bool eff_only, bool *close_bionics
             } else {
                 ctr = item::spawn_temporary( "radiocontrol", calendar::start_of_cataclysm );
             }
-            ctr->charges = units::to_kilojoule( get_power_level() );
+            ctr->set_charges( units::to_kilojoule( get_power_level() ) );
             int power_use = invoke_item( ctr );
             mod_power_level( units::from_kilojoule( -power_use ) );
             bio.powered = ctr->active;
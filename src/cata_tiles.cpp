@@ -1,3 +1,4 @@
+#include "typed_options.h"
 #include "units_temperature.h"
 #if defined(TILES)
 #include "cata_tiles.h"
@@ -265,7 +266,7 @@ void cata_tiles::on_options_changed()
     settings.mode = pixel_minimap_mode_from_string( get_option<std::string>( "PIXEL_MINIMAP_MODE" ) );
     settings.brightness = get_option<int>( "PIXEL_MINIMAP_BRIGHTNESS" );
     settings.beacon_size = get_option<int>( "PIXEL_MINIMAP_BEACON_SIZE" );
-    settings.beacon_blink_interval = get_option<bool>( "ANIMATIONS" ) ?
+    settings.beacon_blink_interval = get_option( option::ANIMATIONS ) ?
                                      get_option<int>( "PIXEL_MINIMAP_BLINK" ) : 0;
     settings.square_pixels = get_option<bool>( "PIXEL_MINIMAP_RATIO" );
     settings.scale_to_fit = get_option<bool>( "PIXEL_MINIMAP_SCALE_TO_FIT" );
@@ -1194,7 +1195,7 @@ void cata_tiles::draw( point dest, const tripoint &center, int width, int height
         here.getabs( tripoint( max_mm_reg, center.z ) )
     );
 
-    idle_animations.set_enabled( get_option<bool>( "ANIMATIONS" ) );
+    idle_animations.set_enabled( get_option( option::ANIMATIONS ) );
     idle_animations.prepare_for_redraw();
 
     //set up a default tile for the edges outside the render area
@@ -2623,7 +2624,7 @@ bool cata_tiles::draw_terrain( const tripoint &p, const lit_level ll, int &heigh
         // try drawing memory if invisible and not overridden
         const auto &t = get_terrain_memory_at( p );
 
-        return draw_from_id_string( t.tile, C_TERRAIN, empty_string, p, t.subtile, t.rotation,
+        return draw_from_id_string( t.tile.str(), C_TERRAIN, empty_string, p, t.subtile, t.rotation,
                                     lit_level::MEMORIZED, nv_goggles_activated, height_3d, z_drop );
     }
     return false;
@@ -2642,7 +2643,7 @@ bool cata_tiles::has_terrain_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
         const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "t_" ) ) {
+        if( string_starts_with( t.tile.str(), "t_" ) ) {
             return true;
         }
     }
@@ -2653,7 +2654,7 @@ bool cata_tiles::has_furniture_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
         const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "f_" ) ) {
+        if( string_starts_with( t.tile.str(), "f_" ) ) {
             return true;
         }
     }
@@ -2664,7 +2665,7 @@ bool cata_tiles::has_trap_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
         const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "tr_" ) ) {
+        if( string_starts_with( t.tile.str(), "tr_" ) ) {
             return true;
         }
     }
@@ -2675,7 +2676,7 @@ bool cata_tiles::has_vpart_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
         const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "vp_" ) ) {
+        if( string_starts_with( t.tile.str(), "vp_" ) ) {
             return true;
         }
     }
@@ -2686,7 +2687,7 @@ memorized_terrain_tile cata_tiles::get_terrain_memory_at( const tripoint &p ) co
 {
     if( g->u.should_show_map_memory() ) {
         const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "t_" ) ) {
+        if( string_starts_with( t.tile.str(), "t_" ) ) {
             return t;
         }
     }
@@ -2697,7 +2698,7 @@ memorized_terrain_tile cata_tiles::get_furniture_memory_at( const tripoint &p )
 {
     if( g->u.should_show_map_memory() ) {
         const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "f_" ) ) {
+        if( string_starts_with( t.tile.str(), "f_" ) ) {
             return t;
         }
     }
@@ -2708,7 +2709,7 @@ memorized_terrain_tile cata_tiles::get_trap_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
         const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "tr_" ) ) {
+        if( string_starts_with( t.tile.str(), "tr_" ) ) {
             return t;
         }
     }
@@ -2719,7 +2720,7 @@ memorized_terrain_tile cata_tiles::get_vpart_memory_at( const tripoint &p ) cons
 {
     if( g->u.should_show_map_memory() ) {
         const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "vp_" ) ) {
+        if( string_starts_with( t.tile.str(), "vp_" ) ) {
             return t;
         }
     }
@@ -2794,7 +2795,7 @@ bool cata_tiles::draw_furniture( const tripoint &p, const lit_level ll, int &hei
     } else if( invisible[0] && has_furniture_memory_at( p ) ) {
         // try drawing memory if invisible and not overridden
         const auto &t = get_furniture_memory_at( p );
-        return draw_from_id_string( t.tile, C_FURNITURE, empty_string, p, t.subtile, t.rotation,
+        return draw_from_id_string( t.tile.str(), C_FURNITURE, empty_string, p, t.subtile, t.rotation,
                                     lit_level::MEMORIZED, nv_goggles_activated, height_3d, z_drop );
     }
     return false;
@@ -2869,7 +2870,7 @@ bool cata_tiles::draw_trap( const tripoint &p, const lit_level ll, int &height_3
     } else if( invisible[0] && has_trap_memory_at( p ) ) {
         // try drawing memory if invisible and not overridden
         const auto &t = get_trap_memory_at( p );
-        return draw_from_id_string( t.tile, C_TRAP, empty_string, p, t.subtile, t.rotation,
+        return draw_from_id_string( t.tile.str(), C_TRAP, empty_string, p, t.subtile, t.rotation,
                                     lit_level::MEMORIZED, nv_goggles_activated, height_3d, z_drop );
     }
     return false;
@@ -3024,7 +3025,7 @@ bool cata_tiles::draw_vpart( const tripoint &p, lit_level ll, int &height_3d,
     } else if( invisible[0] && has_vpart_memory_at( p ) ) {
         // try drawing memory if invisible and not overridden
         const auto &t = get_vpart_memory_at( p );
-        return draw_from_id_string( t.tile, C_VEHICLE_PART, empty_string, p, t.subtile, t.rotation,
+        return draw_from_id_string( t.tile.str(), C_VEHICLE_PART, empty_string, p, t.subtile, t.rotation,
                                     lit_level::MEMORIZED, nv_goggles_activated, height_3d, z_drop );
     }
     return false;
@@ -1,6 +1,7 @@
 #include "cata_utility.h"
 #include "fstream_utils.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cmath>
 #include <cstdio>
@@ -11,7 +12,9 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
+#include "async_file_writer.h"
 #include "debug.h"
 #include "enum_conversions.h"
 #include "filesystem.h"
@@ -457,12 +460,33 @@ std::istream *cata_ifstream::operator->()
     return &*_stream;
 }
 
+static file_write_stats write_stats;
+
 void write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer )
 {
+    async_file_writer &async_writer = get_async_file_writer();
+    if( async_writer.capturing() ) {
+        std::ostringstream buffer;
+        writer( buffer );
+        std::string data = buffer.str();
+        write_stats.files++;
+        write_stats.bytes += data.size();
+        async_writer.add( path, std::move( data ) );
+        return;
+    }
+    async_writer.wait_for( path );
     // Any of the below may throw. ofstream_wrapper will clean up the temporary path on its own.
     ofstream_wrapper fout( path, cata_ios_mode::binary );
     writer( fout.stream() );
+    const std::streamoff size = fout.stream().tellp();
     fout.close();
+    write_stats.files++;
+    write_stats.bytes += std::max<std::streamoff>( size, 0 );
+}
+
+file_write_stats get_file_write_stats()
+{
+    return write_stats;
 }
 
 bool write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer,
@@ -525,6 +549,7 @@ std::istream &safe_getline( std::istream &ins, std::string &str )
 
 bool read_from_file( const std::string &path, const std::function<void( std::istream & )> &reader )
 {
+    get_async_file_writer().wait_for( path );
     try {
         cata_ifstream fin = std::move( cata_ifstream().mode( cata_ios_mode::binary ).open( path ) );
         if( !fin.is_open() ) {
@@ -563,6 +588,7 @@ bool read_from_file_optional( const std::string &path,
     // Note: slight race condition here, but we'll ignore it. Worst case: the file
     // exists and got removed before reading it -> reading fails with a message
     // Or file does not exists, than everything works fine because it's optional anyway.
+    get_async_file_writer().wait_for( path );
     return file_exist( path ) && read_from_file( path, reader );
 }
 
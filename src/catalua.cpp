@@ -91,6 +91,13 @@ void run_hooks( Args &&... ) {}
 
 void run_on_every_x_hooks( lua_state & ) {}
 
+std::string describe_lua_hook_timings()
+{
+    return std::string();
+}
+
+void reset_lua_hook_timings() {}
+
 } // namespace cata
 
 #else // LUA
@@ -101,6 +108,7 @@ void run_on_every_x_hooks( lua_state & ) {}
 #include "catalua_console.h"
 #include "catalua_impl.h"
 #include "catalua_iuse_actor.h"
+#include "catalua_profiler.h"
 #include "catalua_readonly.h"
 #include "catalua_serde.h"
 #include "filesystem.h"
@@ -163,6 +171,11 @@ void show_lua_console()
     cata::show_lua_console_impl();
 }
 
+static void invalidate_hook_tables( lua_state &state )
+{
+    state.hooks_generation++;
+}
+
 void reload_lua_code()
 {
     cata::lua_state &state = *DynamicDataLoader::get_instance().lua;
@@ -173,6 +186,7 @@ void reload_lua_code()
         debugmsg( "%s", e.what() );
     }
     clear_mod_being_loaded( state );
+    invalidate_hook_tables( state );
 }
 
 void debug_write_lua_backtrace( std::ostream &out )
@@ -260,6 +274,31 @@ std::unique_ptr<lua_state, lua_state_deleter> make_wrapped_state()
     return ret;
 }
 
+// Returns a proxy of @p source which bumps lua_state::hooks_generation when written to,
+// so compiled hook tables don't need to check the Lua table for changes
+static sol::table make_hook_table( lua_state &state, sol::table source )
+{
+    sol::state &lua = state.lua;
+    sol::table meta = lua.create_table();
+    meta[sol::meta_function::index] = source;
+    meta[sol::meta_function::new_index] = [&state, source]( const sol::table &,
+    const sol::object & key, const sol::object & value ) mutable {
+        source.raw_set( key, value );
+        state.hooks_generation++;
+    };
+    meta[sol::meta_function::length] = [source]( const sol::table & ) {
+        return source.size();
+    };
+    meta[sol::meta_function::pairs] = [source]( sol::this_state L, const sol::table & )
+    -> std::tuple<sol::object, sol::table, sol::nil_t> {
+        sol::state_view lua( L.lua_state() );
+        return std::make_tuple( lua["next"], source, sol::nil );
+    };
+    sol::table ret = lua.create_table();
+    ret[sol::metatable_key] = meta;
+    return ret;
+}
+
 void init_global_state_tables( lua_state &state, const std::vector<mod_id> &modlist )
 {
     sol::state &lua = state.lua;
@@ -285,6 +324,9 @@ void init_global_state_tables( lua_state &state, const std::vector<mod_id> &modl
     it["mod_runtime"] = mod_runtime;
     it["mod_storage"] = mod_storage;
     it["on_every_x_hooks"] = std::vector<cata::on_every_x_hooks>();
+    std::vector<cata::on_every_x_hooks> &every_x_hooks = it["on_every_x_hooks"];
+    state.every_x_hooks = &every_x_hooks;
+    state.hook_tables.clear();
     gt["hooks"] = hooks;
 
     // Runtime infrastructure
@@ -297,9 +339,13 @@ void init_global_state_tables( lua_state &state, const std::vector<mod_id> &modl
     gt["iuse_functions"] = lua.create_table();
 
     // hooks
-    hooks["on_game_load"] = lua.create_table();
-    hooks["on_game_save"] = lua.create_table();
-    hooks["on_mapgen_postprocess"] = lua.create_table();
+    for( const char *name : {
+             "on_game_load", "on_game_save", "on_mapgen_postprocess"
+         } ) {
+        sol::table source = lua.create_table();
+        hooks[name] = make_hook_table( state, source );
+        state.hook_tables[name].source = source;
+    }
 }
 
 void set_mod_being_loaded( lua_state &state, const mod_id &mod )
@@ -323,6 +369,7 @@ void run_mod_preload_script( lua_state &state, const mod_id &mod )
     }
 
     run_lua_script( state.lua, script_path );
+    invalidate_hook_tables( state );
 }
 
 void run_mod_finalize_script( lua_state &state, const mod_id &mod )
@@ -334,6 +381,7 @@ void run_mod_finalize_script( lua_state &state, const mod_id &mod )
     }
 
     run_lua_script( state.lua, script_path );
+    invalidate_hook_tables( state );
 }
 
 void run_mod_main_script( lua_state &state, const mod_id &mod )
@@ -345,22 +393,72 @@ void run_mod_main_script( lua_state &state, const mod_id &mod )
     }
 
     run_lua_script( state.lua, script_path );
+    invalidate_hook_tables( state );
+}
+
+// Returns the dispatch table for game.hooks[name], recompiling it if the Lua table changed
+static lua_hook_table &get_hook_table( lua_state &state, std::string_view name )
+{
+    auto it = state.hook_tables.find( name );
+    if( it == state.hook_tables.end() ) {
+        lua_hook_table table;
+        table.source = state.lua.globals()["game"]["hooks"][name];
+        it = state.hook_tables.emplace( std::string( name ), std::move( table ) ).first;
+    }
+    lua_hook_table &table = it->second;
+    if( table.generation == state.hooks_generation ) {
+        return table;
+    }
+    const size_t size = table.source.size();
+
+    // Keep timings of functions that are still registered
+    std::map<std::string, lua_hook_timing> old_timings;
+    for( lua_hook &hook : table.hooks ) {
+        old_timings.emplace( hook.source, hook.timing );
+    }
+    table.hooks.clear();
+    for( size_t i = 1; i <= size; i++ ) {
+        sol::object obj = table.source[i];
+        if( obj.get_type() != sol::type::function ) {
+            debugmsg( "Hook %s[%d] is not a function", name, i );
+            continue;
+        }
+        lua_hook hook;
+        hook.func = obj.as<sol::protected_function>();
+        hook.source = describe_lua_function( hook.func );
+        hook.mod = lua_function_mod( hook.func );
+        auto old = old_timings.find( hook.source );
+        if( old != old_timings.end() ) {
+            hook.timing = old->second;
+        }
+        table.hooks.push_back( std::move( hook ) );
+    }
+    table.generation = state.hooks_generation;
+    return table;
 }
 
 template<typename... Args>
 void run_hooks( lua_state &state, std::string_view hooks_table, Args &&...args )
 {
-    sol::state &lua = state.lua;
-    sol::table hooks = lua.globals()["game"]["hooks"][hooks_table];
-    for( auto &ref : hooks ) {
-        int idx = -1;
+    lua_hook_table &table = get_hook_table( state, hooks_table );
+    for( size_t i = 0; i < table.hooks.size(); i++ ) {
+        // The hook may add hooks and a nested run_hooks may then recompile the
+        // table, so nothing in it is referenced across the call
+        const sol::protected_function func = table.hooks[i].func;
+        const mod_id mod = table.hooks[i].mod;
+        const std::uint64_t generation = table.generation;
         try {
-            idx = ref.first.as<int>();
-            sol::protected_function func = ref.second;
-            sol::protected_function_result res = func( std::forward<Args>( args )... );
+            lua_call_scope scope( mod );
+            sol::protected_function_result res = func( args... );
+            const std::chrono::nanoseconds spent = scope.finish();
+            if( table.generation == generation ) {
+                table.hooks[i].timing.add( spent );
+            }
             check_func_result( res );
         } catch( std::runtime_error &e ) {
-            debugmsg( "Failed to run hook %s[%d]: %s", hooks_table, idx, e.what() );
+            const std::string source = table.generation == generation ?
+                                       table.hooks[i].source : describe_lua_function( func );
+            debugmsg( "Failed to run hook %s[%d] (%s): %s", hooks_table, i + 1, source, e.what() );
             break;
         }
     }
@@ -387,20 +485,86 @@ void reg_lua_iuse_actors( lua_state &state, Item_factory &ifactory )
 
 void run_on_every_x_hooks( lua_state &state )
 {
-    std::vector<cata::on_every_x_hooks> &master_table =
-        state.lua["game"]["cata_internal"]["on_every_x_hooks"];
-    for( const auto &entry : master_table ) {
-        if( calendar::once_every( entry.interval ) ) {
-            for( auto &func : entry.functions ) {
-                try {
-                    sol::protected_function_result res = func();
-                    check_func_result( res );
-                } catch( std::runtime_error &e ) {
-                    debugmsg(
-                        "Failed to run hook on_every_x(interval = %s): %s",
-                        to_string( entry.interval ), e.what()
-                    );
+    if( state.every_x_hooks == nullptr ) {
+        return;
+    }
+    std::vector<on_every_x_hooks> &entries = *state.every_x_hooks;
+    for( size_t e = 0; e < entries.size(); e++ ) {
+        if( !calendar::once_every( entries[e].interval ) ) {
+            continue;
+        }
+        // A hook may call add_on_every_x_hook, which reallocates the vectors but only
+        // appends to them, so what the call needs is copied and the rest found again by index
+        for( size_t i = 0; i < entries[e].functions.size(); i++ ) {
+            const sol::protected_function func = entries[e].functions[i].func;
+            try {
+                lua_call_scope scope( entries[e].functions[i].mod, lua_call_kind::periodic );
+                if( !scope.allowed() ) {
+                    continue;
                 }
+                sol::protected_function_result res = func();
+                entries[e].functions[i].timing.add( scope.finish() );
+                check_func_result( res );
+            } catch( std::runtime_error &err ) {
+                debugmsg(
+                    "Failed to run hook on_every_x(interval = %s) (%s): %s",
+                    to_string( entries[e].interval ), entries[e].functions[i].source, err.what()
+                );
+            }
+        }
+    }
+}
+
+std::string describe_lua_hook_timings()
+{
+    lua_state *state = DynamicDataLoader::get_instance().lua.get();
+    if( state == nullptr ) {
+        return std::string();
+    }
+    std::string ret = string_format( "%-12s %-48s %8s %10s %10s %10s\n",
+                                     "hook", "function", "calls", "total ms", "max us", "turn us" );
+    const auto describe = [&ret]( const std::string & name, const lua_hook & hook ) {
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        const lua_hook_timing &t = hook.timing;
+        const bool this_turn = t.last_turn == calendar::turn;
+        const microseconds turn_total = this_turn ? duration_cast<microseconds>( t.turn_total ) :
+                                        microseconds( 0 );
+        ret += string_format( "%-12s %-48s %8d %10.3f %10d %10d\n", name, hook.source, t.calls,
+                              duration_cast<microseconds>( t.total ).count() / 1000.0,
+                              static_cast<int>( duration_cast<microseconds>( t.max ).count() ),
+                              static_cast<int>( turn_total.count() ) );
+    };
+    for( std::pair<const std::string, lua_hook_table> &table : state->hook_tables ) {
+        for( const lua_hook &hook : table.second.hooks ) {
+            describe( table.first, hook );
+        }
+    }
+    if( state->every_x_hooks != nullptr ) {
+        for( const on_every_x_hooks &entry : *state->every_x_hooks ) {
+            for( const lua_hook &hook : entry.functions ) {
+                describe( "every " + to_string( entry.interval ), hook );
+            }
+        }
+    }
+    return ret;
+}
+
+void reset_lua_hook_timings()
+{
+    lua_state *state = DynamicDataLoader::get_instance().lua.get();
+    if( state == nullptr ) {
+        return;
+    }
+    for( std::pair<const std::string, lua_hook_table> &table : state->hook_tables ) {
+        for( lua_hook &hook : table.second.hooks ) {
+            hook.timing = lua_hook_timing();
+        }
+    }
+    if( state->every_x_hooks != nullptr ) {
+        for( on_every_x_hooks &entry : *state->every_x_hooks ) {
+            for( lua_hook &hook : entry.functions ) {
+                hook.timing = lua_hook_timing();
             }
         }
     }
@@ -5,6 +5,7 @@
 #include "type_id.h"
 
 #include <memory>
+#include <string>
 
 class Item_factory;
 class map;
@@ -41,6 +42,9 @@ void run_mod_main_script( lua_state &state, const mod_id &mod );
 void run_on_game_load_hooks( lua_state &state );
 void run_on_game_save_hooks( lua_state &state );
 void run_on_every_x_hooks( lua_state &state );
+/** Report of time spent in each registered Lua hook, for modders to find expensive scripts. */
+std::string describe_lua_hook_timings();
+void reset_lua_hook_timings();
 void run_on_mapgen_postprocess_hooks( lua_state &state, map &m, const tripoint &p,
                                       const time_point &when );
 void reg_lua_iuse_actors( lua_state &state, Item_factory &ifactory );
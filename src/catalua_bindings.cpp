@@ -8,6 +8,7 @@
 #include "catalua.h"
 #include "catalua_impl.h"
 #include "catalua_log.h"
+#include "catalua_profiler.h"
 #include "catalua_luna_doc.h"
 #include "catalua_luna.h"
 #include "character.h"
@@ -19,6 +20,7 @@
 #include "field.h"
 #include "field_type.h"
 #include "game.h"
+#include "init.h"
 #include "itype.h"
 #include "map.h"
 #include "messages.h"
@@ -26,6 +28,7 @@
 #include "monster.h"
 #include "mtype.h"
 #include "npc.h"
+#include "path_info.h"
 #include "player.h"
 #include "popup.h"
 #include "rng.h"
@@ -563,6 +566,33 @@ void cata::detail::reg_debug_api( sol::state &lua )
         cata::get_lua_log_instance().set_log_capacity( v );
     } );
     luna::set_fx( lib, "reload_lua_code", &cata::reload_lua_code );
+    DOC( "Returns a report of time spent in each hook function, "
+         "to find scripts that slow down turns." );
+    luna::set_fx( lib, "hook_timings", &cata::describe_lua_hook_timings );
+    luna::set_fx( lib, "reset_hook_timings", &cata::reset_lua_hook_timings );
+    DOC( "Starts recording time, VM instructions and allocations per Lua call stack." );
+    luna::set_fx( lib, "profiler_start", []( sol::this_state lua_this ) {
+        // The console runs on the game's state, so that's the one to profile
+        cata::lua_state *state = DynamicDataLoader::get_instance().lua.get();
+        if( state != nullptr && state->lua.lua_state() == lua_this.lua_state() ) {
+            cata::get_lua_profiler().start( *state );
+        }
+    } );
+    luna::set_fx( lib, "profiler_stop", []() {
+        cata::get_lua_profiler().stop();
+    } );
+    luna::set_fx( lib, "profiler_reset", []() {
+        cata::get_lua_profiler().reset();
+    } );
+    DOC( "Returns time spent per mod and in the hottest functions." );
+    luna::set_fx( lib, "profiler_report", []() -> std::string {
+        return cata::get_lua_profiler().report();
+    } );
+    DOC( "Writes recorded stacks for flamegraph.pl and returns the file path." );
+    luna::set_fx( lib, "profiler_dump", []() -> std::string {
+        const std::string path = PATH_INFO::lua_profile_output();
+        return cata::get_lua_profiler().write_folded( path ) ? path : std::string();
+    } );
     luna::set_fx( lib, "save_game", []() -> bool {
         return g->save( false );
     } );
@@ -620,15 +650,19 @@ void cata::detail::reg_game_api( sol::state &lua )
     sol::protected_function f ) {
         sol::state_view lua( lua_this );
         std::vector<on_every_x_hooks> &hooks = lua["game"]["cata_internal"]["on_every_x_hooks"];
+        lua_hook hook;
+        hook.source = describe_lua_function( f );
+        hook.mod = lua_function_mod( f );
+        hook.func = f;
         for( auto &entry : hooks ) {
             if( entry.interval == interval ) {
-                entry.functions.push_back( f );
+                entry.functions.push_back( std::move( hook ) );
                 return;
             }
         }
-        std::vector<sol::protected_function> vec;
-        vec.push_back( f );
-        hooks.push_back( on_every_x_hooks{ interval, vec } );
+        std::vector<lua_hook> vec;
+        vec.push_back( std::move( hook ) );
+        hooks.push_back( on_every_x_hooks{ interval, std::move( vec ) } );
     } );
 
     luna::set_fx( lib, "get_creature_at", []( const tripoint & p,
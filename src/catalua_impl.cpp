@@ -3,16 +3,79 @@
 
 #include "catalua_bindings.h"
 #include "catalua_log.h"
+#include "catalua_profiler.h"
 #include "catalua_sol.h"
 #include "debug.h"
+#include "mod_manager.h"
 #include "string_formatter.h"
+#include "string_utils.h"
+#include "worldfactory.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <optional>
 #include <stdexcept>
 #include <utility>
 
+namespace cata
+{
+
+void lua_hook_timing::add( std::chrono::nanoseconds spent )
+{
+    if( last_turn != calendar::turn ) {
+        last_turn = calendar::turn;
+        turn_total = std::chrono::nanoseconds( 0 );
+    }
+    calls++;
+    total += spent;
+    turn_total += spent;
+    max = std::max( max, spent );
+}
+
+std::string describe_lua_function( const sol::protected_function &func )
+{
+    lua_State *L = func.lua_state();
+    if( L == nullptr || !func.valid() ) {
+        return "<invalid>";
+    }
+    func.push();
+    lua_Debug ar;
+    // '>' makes lua_getinfo pop the function from the stack
+    if( lua_getinfo( L, ">S", &ar ) == 0 ) {
+        return "<unknown>";
+    }
+    return string_format( "%s:%d", ar.short_src, ar.linedefined );
+}
+
+mod_id lua_function_mod( const sol::protected_function &func )
+{
+    lua_State *L = func.lua_state();
+    if( L == nullptr || !func.valid() || !world_generator || !world_generator->active_world ) {
+        return mod_id();
+    }
+    func.push();
+    lua_Debug ar;
+    if( lua_getinfo( L, ">S", &ar ) == 0 || ar.source == nullptr || ar.source[0] != '@' ) {
+        return mod_id();
+    }
+    // Scripts are loaded by their path within the mod directory, see run_mod_main_script()
+    const std::string path( ar.source + 1 );
+    for( const mod_id &mod : world_generator->active_world->active_mod_order ) {
+        if( mod.is_valid() && string_starts_with( path, mod->path + "/" ) ) {
+            return mod;
+        }
+    }
+    return mod_id();
+}
+
+lua_state::~lua_state()
+{
+    get_lua_profiler().forget( *this );
+}
+
+} // namespace cata
+
 sol::state make_lua_state()
 {
     sol::state lua;
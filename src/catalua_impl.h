@@ -2,14 +2,54 @@
 #ifndef CATA_SRC_CATALUA_IMPL_H
 #define CATA_SRC_CATALUA_IMPL_H
 
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "calendar.h"
 #include "catalua_sol.h"
+#include "type_id.h"
 
 namespace cata
 {
+/** Time spent in a single hook function, see describe_lua_hook_timings(). */
+struct lua_hook_timing {
+    int calls = 0;
+    std::chrono::nanoseconds total{ 0 };
+    std::chrono::nanoseconds max{ 0 };
+    // Accumulated during last_turn only
+    std::chrono::nanoseconds turn_total{ 0 };
+    time_point last_turn = calendar::before_time_starts;
+
+    void add( std::chrono::nanoseconds spent );
+};
+
+struct lua_hook {
+    // Where the function was defined, as "source:line"
+    std::string source;
+    // Mod whose script defined the function, charged for the time it takes
+    mod_id mod;
+    sol::protected_function func;
+    lua_hook_timing timing;
+};
+
 struct on_every_x_hooks {
     time_duration interval;
-    std::vector<sol::protected_function> functions;
+    std::vector<lua_hook> functions;
+};
+
+/**
+ * Dispatch table compiled from one of the game.hooks[name] Lua tables.
+ * Rebuilt when lua_state::hooks_generation moved on since it was compiled.
+ */
+struct lua_hook_table {
+    sol::table source;
+    // lua_state::hooks_generation the hooks were compiled at, 0 if never
+    std::uint64_t generation = 0;
+    std::vector<lua_hook> hooks;
 };
 
 /**
@@ -19,11 +59,22 @@ struct on_every_x_hooks {
  */
 struct lua_state {
     sol::state lua;
+    // Owned by game.cata_internal.on_every_x_hooks, cached to skip the table lookups every turn
+    std::vector<on_every_x_hooks> *every_x_hooks = nullptr;
+    std::map<std::string, lua_hook_table, std::less<>> hook_tables;
+    // Bumped on every write to a game.hooks[name] table and after mod scripts ran
+    std::uint64_t hooks_generation = 1;
 
     lua_state() = default;
-    ~lua_state() = default;
+    explicit lua_state( sol::state &&state ) : lua( std::move( state ) ) {}
+    ~lua_state();
 };
 
+/** "source:line" of a Lua function, for reporting. */
+std::string describe_lua_function( const sol::protected_function &func );
+/** Active mod whose directory holds the script that defined @p func, or an empty id. */
+mod_id lua_function_mod( const sol::protected_function &func );
+
 } // namespace cata
 
 sol::state make_lua_state();
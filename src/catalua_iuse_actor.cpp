@@ -3,10 +3,11 @@
 #include "catalua_iuse_actor.h"
 
 #include "catalua_impl.h"
+#include "catalua_profiler.h"
 #include "player.h"
 
 lua_iuse_actor::lua_iuse_actor( const std::string &type, sol::protected_function &&luafunc )
-    : iuse_actor( type ), luafunc( luafunc ) {}
+    : iuse_actor( type ), luafunc( luafunc ), mod( cata::lua_function_mod( this->luafunc ) ) {}
 
 lua_iuse_actor::~lua_iuse_actor() = default;
 
@@ -19,6 +20,7 @@ int lua_iuse_actor::use( player &who, item &itm, bool tick, const tripoint &pos
 {
     if( !tick ) {
         try {
+            cata::lua_call_scope scope( mod );
             sol::protected_function_result res = luafunc( who.as_character(), itm, pos );
             check_func_result( res );
             int ret = res;
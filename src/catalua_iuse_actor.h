@@ -5,12 +5,14 @@
 #include "iuse.h"
 #include "catalua_sol.h"
 #include "ret_val.h"
+#include "type_id.h"
 
 /** Dynamic iuse_actor provided by Lua. */
 class lua_iuse_actor : public iuse_actor
 {
     private:
         sol::protected_function luafunc;
+        mod_id mod;
 
     public:
         lua_iuse_actor( const std::string &type, sol::protected_function &&luafunc );
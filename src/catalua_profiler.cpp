@@ -0,0 +1,311 @@
+#if defined(LUA)
+#include "catalua_profiler.h"
+
+#include "catalua_impl.h"
+#include "catalua_log.h"
+#include "catalua_sol.h"
+#include "debug.h"
+#include "fstream_utils.h"
+#include "string_formatter.h"
+#include "typed_options.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace cata
+{
+
+// VM instructions between count hook calls
+static constexpr int instruction_sample_rate = 1000;
+
+static std::string mod_frame_name( const mod_id &mod )
+{
+    return mod.is_empty() ? std::string( "<unknown mod>" ) : mod.str();
+}
+
+lua_profiler &get_lua_profiler()
+{
+    static lua_profiler profiler;
+    return profiler;
+}
+
+void lua_profiler::start( lua_state &state )
+{
+    if( is_running() ) {
+        stop();
+    }
+    profiled = state.lua.lua_state();
+    original_alloc = lua_getallocf( profiled, &original_alloc_ud );
+    lua_setallocf( profiled, &lua_profiler::alloc, this );
+    lua_sethook( profiled, &lua_profiler::hook, LUA_MASKCALL | LUA_MASKRET | LUA_MASKCOUNT,
+                 instruction_sample_rate );
+}
+
+void lua_profiler::stop()
+{
+    if( !is_running() ) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    while( !frames.empty() ) {
+        pop_frame( now );
+    }
+    lua_sethook( profiled, nullptr, 0, 0 );
+    lua_setallocf( profiled, original_alloc, original_alloc_ud );
+    profiled = nullptr;
+    original_alloc = nullptr;
+    original_alloc_ud = nullptr;
+}
+
+void lua_profiler::forget( const lua_state &state )
+{
+    if( profiled != nullptr && profiled == state.lua.lua_state() ) {
+        profiled = nullptr;
+        frames.clear();
+    }
+}
+
+void lua_profiler::reset()
+{
+    mods.clear();
+    stacks.clear();
+}
+
+lua_profiler::mod_usage &lua_profiler::usage_for( const mod_id &mod )
+{
+    mod_usage &usage = mods[mod];
+    if( usage.last_turn != calendar::turn ) {
+        usage.last_turn = calendar::turn;
+        usage.turn_total = std::chrono::nanoseconds( 0 );
+    }
+    return usage;
+}
+
+bool lua_profiler::begin_call( const mod_id &mod, lua_call_kind kind )
+{
+    mod_usage &usage = usage_for( mod );
+    const int budget_us = get_option( option::LUA_TURN_BUDGET );
+    if( kind == lua_call_kind::periodic && budget_us > 0 && usage.turn_total > std::chrono::microseconds( budget_us ) &&
+        get_option( option::LUA_BUDGET_ACTION ) == "throttle" ) {
+        usage.throttled_calls++;
+        return false;
+    }
+
+    active_call call;
+    call.mod = mod;
+    call.start = std::chrono::steady_clock::now();
+    call.frames_base = frames.size();
+    calls.push_back( call );
+    if( is_running() ) {
+        call_frame root;
+        root.key = mod_frame_name( mod );
+        root.start = call.start;
+        frames.push_back( std::move( root ) );
+    }
+    return true;
+}
+
+std::chrono::nanoseconds lua_profiler::end_call()
+{
+    const auto now = std::chrono::steady_clock::now();
+    const active_call call = calls.back();
+    calls.pop_back();
+    // Frames the Lua code did not return from, e.g. due to an error
+    while( frames.size() > call.frames_base ) {
+        pop_frame( now );
+    }
+
+    const std::chrono::nanoseconds spent = now - call.start;
+    // Only charge the time not already charged to calls made from within this one
+    const std::chrono::nanoseconds own = spent - call.nested;
+    if( !calls.empty() ) {
+        calls.back().nested += spent;
+    }
+
+    mod_usage &usage = usage_for( call.mod );
+    const int budget_us = get_option( option::LUA_TURN_BUDGET );
+    const bool was_over = usage.turn_total > std::chrono::microseconds( budget_us );
+    usage.calls++;
+    usage.total += own;
+    usage.turn_total += own;
+    usage.alloc_bytes += call.alloc_bytes;
+    if( budget_us > 0 && !was_over && usage.turn_total > std::chrono::microseconds( budget_us ) ) {
+        usage.turns_over_budget++;
+        const bool throttle = get_option( option::LUA_BUDGET_ACTION ) == "throttle";
+        std::string msg = string_format(
+                              "Mod %s spent %d us in Lua this turn, over the budget of %d us%s",
+                              mod_frame_name( call.mod ),
+                              static_cast<int>( std::chrono::duration_cast<std::chrono::microseconds>
+                                      ( usage.turn_total ).count() ),
+                              budget_us, throttle ? ", skipping its on_every_x hooks until next turn" : "" );
+        DebugLog( DL::Warn, DC::Lua ) << msg;
+        get_lua_log_instance().add( LuaLogLevel::Warn, std::move( msg ) );
+    }
+    return spent;
+}
+
+void lua_profiler::push_frame( lua_State *L, lua_Debug *ar )
+{
+    lua_getinfo( L, "Sn", ar );
+    std::string name;
+    if( ar->what != nullptr && std::string( ar->what ) == "C" ) {
+        name = string_format( "[C] %s", ar->name != nullptr ? ar->name : "?" );
+    } else if( ar->name != nullptr ) {
+        name = string_format( "%s %s:%d", ar->name, ar->short_src, ar->linedefined );
+    } else {
+        name = string_format( "%s:%d", ar->short_src, ar->linedefined );
+    }
+    // ';' separates frames in the collapsed format
+    std::replace( name.begin(), name.end(), ';', ':' );
+
+    call_frame frame;
+    frame.key = frames.empty() ? std::move( name ) : frames.back().key + ";" + name;
+    frame.start = std::chrono::steady_clock::now();
+    frames.push_back( std::move( frame ) );
+}
+
+void lua_profiler::pop_frame( std::chrono::steady_clock::time_point now )
+{
+    call_frame &frame = frames.back();
+    const std::chrono::nanoseconds spent = now - frame.start;
+    stack_usage &usage = stacks[frame.key];
+    usage.calls++;
+    usage.self += spent - frame.children;
+    usage.alloc_bytes += frame.alloc_bytes;
+    usage.instructions += frame.instructions;
+    frames.pop_back();
+    if( !frames.empty() ) {
+        frames.back().children += spent;
+    }
+}
+
+void lua_profiler::hook( lua_State *L, lua_Debug *ar )
+{
+    lua_profiler &p = get_lua_profiler();
+    // Frames below this belong to an enclosing call from C++ and must outlive this one
+    const size_t base = p.calls.empty() ? 0 : p.calls.back().frames_base + 1;
+    switch( ar->event ) {
+        case LUA_HOOKCALL:
+            p.push_frame( L, ar );
+            break;
+        case LUA_HOOKTAILCALL:
+            // The replaced function won't get a return event
+            if( p.frames.size() > base ) {
+                p.pop_frame( std::chrono::steady_clock::now() );
+            }
+            p.push_frame( L, ar );
+            break;
+        case LUA_HOOKRET:
+            // Returns from functions entered before profiling started have no frame
+            if( p.frames.size() > base ) {
+                p.pop_frame( std::chrono::steady_clock::now() );
+            }
+            break;
+        case LUA_HOOKCOUNT:
+            if( !p.frames.empty() ) {
+                p.frames.back().instructions += instruction_sample_rate;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void *lua_profiler::alloc( void *ud, void *ptr, size_t osize, size_t nsize )
+{
+    lua_profiler &p = *static_cast<lua_profiler *>( ud );
+    // For new blocks osize holds the object type instead of a size
+    const size_t grown = ptr == nullptr ? nsize : ( nsize > osize ? nsize - osize : 0 );
+    if( grown > 0 ) {
+        if( !p.frames.empty() ) {
+            p.frames.back().alloc_bytes += grown;
+        }
+        if( !p.calls.empty() ) {
+            p.calls.back().alloc_bytes += grown;
+        }
+    }
+    return p.original_alloc( p.original_alloc_ud, ptr, osize, nsize );
+}
+
+std::string lua_profiler::report() const
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    const auto to_us = []( std::chrono::nanoseconds t ) {
+        return static_cast<int>( duration_cast<microseconds>( t ).count() );
+    };
+
+    std::string ret = string_format( "Lua profiler is %s\n\n", is_running() ? "running" : "stopped" );
+    ret += string_format( "%-24s %8s %10s %10s %10s %6s %9s\n",
+                          "mod", "calls", "total ms", "turn us", "alloc KiB", "over", "throttled" );
+    for( const std::pair<const mod_id, mod_usage> &e : mods ) {
+        const mod_usage &u = e.second;
+        ret += string_format( "%-24s %8d %10.3f %10d %10d %6d %9d\n", mod_frame_name( e.first ),
+                              u.calls, to_us( u.total ) / 1000.0,
+                              u.last_turn == calendar::turn ? to_us( u.turn_total ) : 0,
+                              static_cast<int>( u.alloc_bytes / 1024 ), u.turns_over_budget,
+                              u.throttled_calls );
+    }
+
+    // Sum up stacks by their innermost function
+    std::map<std::string, stack_usage> functions;
+    for( const std::pair<const std::string, stack_usage> &e : stacks ) {
+        const size_t sep = e.first.rfind( ';' );
+        stack_usage &f = functions[sep == std::string::npos ? e.first : e.first.substr( sep + 1 )];
+        f.calls += e.second.calls;
+        f.self += e.second.self;
+        f.alloc_bytes += e.second.alloc_bytes;
+        f.instructions += e.second.instructions;
+    }
+    std::vector<std::pair<std::string, stack_usage>> sorted( functions.begin(), functions.end() );
+    std::sort( sorted.begin(), sorted.end(), []( const auto & a, const auto & b ) {
+        return a.second.self > b.second.self;
+    } );
+    constexpr size_t max_functions = 20;
+    if( sorted.size() > max_functions ) {
+        sorted.resize( max_functions );
+    }
+    ret += string_format( "\n%-48s %8s %10s %10s %10s\n",
+                          "function", "calls", "self ms", "alloc KiB", "instr" );
+    for( const std::pair<std::string, stack_usage> &e : sorted ) {
+        ret += string_format( "%-48s %8d %10.3f %10d %10d\n", e.first, e.second.calls,
+                              to_us( e.second.self ) / 1000.0,
+                              static_cast<int>( e.second.alloc_bytes / 1024 ),
+                              static_cast<int>( e.second.instructions ) );
+    }
+    return ret;
+}
+
+bool lua_profiler::write_folded( const std::string &path ) const
+{
+    return write_to_file( path, [&]( std::ostream & out ) {
+        for( const std::pair<const std::string, stack_usage> &e : stacks ) {
+            const long long us = std::chrono::duration_cast<std::chrono::microseconds>
+                                 ( e.second.self ).count();
+            if( us > 0 ) {
+                out << e.first << ' ' << us << '\n';
+            }
+        }
+    }, "Lua profile" );
+}
+
+lua_call_scope::lua_call_scope( const mod_id &mod, lua_call_kind kind )
+    : active( get_lua_profiler().begin_call( mod, kind ) ) {}
+
+lua_call_scope::~lua_call_scope()
+{
+    finish();
+}
+
+std::chrono::nanoseconds lua_call_scope::finish()
+{
+    if( !active ) {
+        return std::chrono::nanoseconds( 0 );
+    }
+    active = false;
+    return get_lua_profiler().end_call();
+}
+
+} // namespace cata
+
+#endif // LUA
@@ -0,0 +1,155 @@
+#pragma once
+#ifndef CATA_SRC_CATALUA_PROFILER_H
+#define CATA_SRC_CATALUA_PROFILER_H
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "calendar.h"
+#include "type_id.h"
+
+struct lua_Debug;
+struct lua_State;
+
+namespace cata
+{
+
+struct lua_state;
+
+/** Whether a call into Lua may be skipped when its mod ran out of budget. */
+enum class lua_call_kind : int {
+    // Save, load, mapgen and item use hooks, which the game relies on to run
+    required,
+    // Periodic hooks like on_every_x, which can wait for the next turn
+    periodic,
+};
+
+/**
+ * Attributes time spent in Lua to mods, and when started, to individual functions.
+ *
+ * Every call from C++ into mod code (hooks, iuse functions) goes through
+ * @ref lua_call_scope, which charges the time to the mod that defined the
+ * function and enforces the LUA_TURN_BUDGET option.
+ *
+ * While running, the profiler installs a call/return/count hook with `lua_sethook`
+ * and wraps the state's allocator, so time, VM instructions and allocated bytes
+ * are also recorded per call stack. Stacks are kept in the collapsed
+ * "frame;frame;frame value" form used by flamegraph.pl.
+ */
+class lua_profiler
+{
+    public:
+        struct mod_usage {
+            int calls = 0;
+            std::chrono::nanoseconds total{ 0 };
+            size_t alloc_bytes = 0;
+            // Accumulated during last_turn only
+            std::chrono::nanoseconds turn_total{ 0 };
+            time_point last_turn = calendar::before_time_starts;
+            int turns_over_budget = 0;
+            int throttled_calls = 0;
+        };
+
+        struct stack_usage {
+            int calls = 0;
+            // Not including time spent in functions called from this one
+            std::chrono::nanoseconds self{ 0 };
+            size_t alloc_bytes = 0;
+            size_t instructions = 0;
+        };
+
+        /** Begins profiling @p state, replacing its debug hook and allocator. */
+        void start( lua_state &state );
+        /** Restores the hook and allocator of the profiled state. Keeps collected data. */
+        void stop();
+        /** Forgets the profiled state without touching it, for when it is being destroyed. */
+        void forget( const lua_state &state );
+        bool is_running() const {
+            return profiled != nullptr;
+        }
+        /** Discards collected per-mod and per-stack data. */
+        void reset();
+
+        /** Per-mod and hottest function tables, for the Lua console. */
+        std::string report() const;
+        /** Writes the collected stacks in collapsed format, weighted by self time in microseconds. */
+        bool write_folded( const std::string &path ) const;
+
+        const std::map<mod_id, mod_usage> &get_mod_usage() const {
+            return mods;
+        }
+        const std::map<std::string, stack_usage> &get_stack_usage() const {
+            return stacks;
+        }
+
+    private:
+        friend class lua_call_scope;
+        struct call_frame {
+            // Collapsed stack up to and including this frame
+            std::string key;
+            std::chrono::steady_clock::time_point start;
+            std::chrono::nanoseconds children{ 0 };
+            size_t alloc_bytes = 0;
+            size_t instructions = 0;
+        };
+        struct active_call {
+            mod_id mod;
+            std::chrono::steady_clock::time_point start;
+            // Time spent in calls from C++ into Lua made during this one
+            std::chrono::nanoseconds nested{ 0 };
+            size_t alloc_bytes = 0;
+            size_t frames_base = 0;
+        };
+
+        bool begin_call( const mod_id &mod, lua_call_kind kind );
+        std::chrono::nanoseconds end_call();
+        mod_usage &usage_for( const mod_id &mod );
+
+        static void hook( lua_State *L, lua_Debug *ar );
+        static void *alloc( void *ud, void *ptr, size_t osize, size_t nsize );
+        void push_frame( lua_State *L, lua_Debug *ar );
+        void pop_frame( std::chrono::steady_clock::time_point now );
+
+        std::map<mod_id, mod_usage> mods;
+        std::map<std::string, stack_usage> stacks;
+        std::vector<active_call> calls;
+        std::vector<call_frame> frames;
+
+        lua_State *profiled = nullptr;
+        // Allocator of the profiled state, restored on stop()
+        void *( *original_alloc )( void *, void *, size_t, size_t ) = nullptr;
+        void *original_alloc_ud = nullptr;
+};
+
+lua_profiler &get_lua_profiler();
+
+/**
+ * Wraps a call from C++ into a Lua function defined by @p mod.
+ * If the call is periodic, the mod ran out of its per-turn budget and
+ * LUA_BUDGET_ACTION is "throttle", allowed() is false and the call should be skipped.
+ * Required calls always run, but still count against the budget.
+ */
+class lua_call_scope
+{
+    public:
+        explicit lua_call_scope( const mod_id &mod, lua_call_kind kind = lua_call_kind::required );
+        lua_call_scope( const lua_call_scope & ) = delete;
+        lua_call_scope &operator=( const lua_call_scope & ) = delete;
+        ~lua_call_scope();
+
+        bool allowed() const {
+            return active;
+        }
+        /** Ends the call early and returns the time it took. */
+        std::chrono::nanoseconds finish();
+
+    private:
+        bool active;
+};
+
+} // namespace cata
+
+#endif // CATA_SRC_CATALUA_PROFILER_H
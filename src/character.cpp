@@ -2615,16 +2615,16 @@ detached_ptr<item> Character::i_add_to_container( detached_ptr<item> &&it, const
     const itype_id item_type = it->typeId();
     auto add_to_container = [&it]( item & container ) {
         auto &contained_ammo = container.contents.front();
-        if( contained_ammo.charges < container.ammo_capacity() ) {
-            const int diff = container.ammo_capacity() - contained_ammo.charges;
+        if( contained_ammo.charges() < container.ammo_capacity() ) {
+            const int diff = container.ammo_capacity() - contained_ammo.charges();
             //~ %1$s: item name, %2$s: container name
             add_msg( pgettext( "container", "You put the %1$s in your %2$s." ), it->tname(),
                      container.tname() );
-            if( diff >= it->charges ) {
+            if( diff >= it->charges() ) {
                 contained_ammo.merge_charges( std::move( it ) );
             } else {
-                it->charges -= diff;
-                contained_ammo.charges = container.ammo_capacity();
+                it->set_charges( it->charges() - diff );
+                contained_ammo.set_charges( container.ammo_capacity() );
             }
         }
     };
@@ -3044,26 +3044,24 @@ units::mass Character::weight_carried_reduced_by( const excluded_stacks &without
 
     // Wielded item
     units::mass weaponweight = 0_gram;
-    int subtract_count = 0;
     item &weapon = primary_weapon();
     auto weapon_it = without.find( &weapon );
     if( weapon_it == without.end() ) {
         weaponweight = weapon.weight();
     } else {
-        subtract_count = ( *weapon_it ).second;
+        int subtract_count = ( *weapon_it ).second;
         if( weapon.count_by_charges() ) {
-            weapon.charges -= subtract_count;
-            if( weapon.charges < 0 ) {
+            if( subtract_count > weapon.charges() ) {
                 debugmsg( "Trying to remove more charges than the wielded item has" );
-                //Set subtract_count to the original value of weapon->charges, so that it's set back correctly at the end
-                subtract_count += weapon.charges;
-                weapon.charges = 0;
+                subtract_count = weapon.charges();
+            }
+            // The weight of items counted by charges is proportional to the charges, so there's
+            // no need to change the charges of the weapon and lose its cached weight
+            if( weapon.charges() > 0 ) {
+                weaponweight = weapon.weight() * ( weapon.charges() - subtract_count ) / weapon.charges();
             }
-            weaponweight = weapon.weight();
         } else if( subtract_count > 1 ) {
             debugmsg( "Trying to remove more than one wielded item" );
-        } else {
-            subtract_count = 0;
         }
     }
     // Don't try to add weaponweight if it doesn't exist or is weightless
@@ -3079,7 +3077,6 @@ units::mass Character::weight_carried_reduced_by( const excluded_stacks &without
             ret += weaponweight;
         }
     }
-    weapon.charges += subtract_count;
     return ret;
 }
 
@@ -6706,8 +6703,8 @@ int Character::throw_range( const item &it ) const
 
     item &tmp = *item::spawn_temporary( it );
 
-    if( tmp.count_by_charges() && tmp.charges > 1 ) {
-        tmp.charges = 1;
+    if( tmp.count_by_charges() && tmp.charges() > 1 ) {
+        tmp.set_charges( 1 );
     }
 
     /** @EFFECT_STR determines maximum weight that can be thrown */
@@ -6911,7 +6908,7 @@ detached_ptr<item> Character::pour_into( vehicle &veh, detached_ptr<item> &&liqu
     auto stack = units::legacy_volume_factor / liquid->type->stack_size;
     auto title = string_format( _( "Select target tank for <color_%s>%.1fL %s</color>" ),
                                 get_all_colors().get_name( liquid->color() ),
-                                round_up( to_liter( liquid->charges * stack ), 1 ),
+                                round_up( to_liter( liquid->charges() * stack ), 1 ),
                                 liquid->tname() );
 
     auto &tank = veh_interact::select_part( veh, sel, title );
@@ -7944,8 +7941,8 @@ bool Character::consume_charges( item &used, int qty )
 
     // Consume comestibles destroying them if no charges remain
     if( used.is_food() || used.is_medication() ) {
-        used.charges -= qty;
-        if( used.charges <= 0 ) {
+        used.set_charges( used.charges() - qty );
+        if( used.charges() <= 0 ) {
             used.detach();
             return true;
         }
@@ -7953,7 +7950,7 @@ bool Character::consume_charges( item &used, int qty )
     }
 
     if( used.is_power_armor() ) {
-        if( used.charges >= qty ) {
+        if( used.charges() >= qty ) {
             used.ammo_consume( qty, pos() );
         } else if( character_funcs::can_interface_armor( *this ) && has_charges( itype_bio_armor, qty ) ) {
             use_charges( itype_bio_armor, qty );
@@ -7967,7 +7964,7 @@ bool Character::consume_charges( item &used, int qty )
     if( used.has_flag( flag_USE_UPS ) ) {
         // With the new UPS system, we'll want to use any charges built up in the tool before pulling from the UPS
         // The usage of the item was already approved, so drain item if possible, otherwise use UPS
-        if( used.charges >= qty ) {
+        if( used.charges() >= qty ) {
             used.ammo_consume( qty, pos() );
         } else {
             use_charges( itype_UPS, qty );
@@ -10126,7 +10123,7 @@ bool Character::has_item_with_flag( const flag_id &flag, bool need_charges ) con
 {
     return has_item_with( [&flag, &need_charges]( const item & it ) {
         if( it.is_tool() && need_charges ) {
-            return it.has_flag( flag ) && it.type->tool->max_charges ? it.charges > 0 : it.has_flag( flag );
+            return it.has_flag( flag ) && it.type->tool->max_charges ? it.charges() > 0 : it.has_flag( flag );
         }
         return it.has_flag( flag );
     } );
@@ -10293,15 +10290,15 @@ std::vector<detached_ptr<item>> Character::use_charges( const itype_id &what, in
 
         } else if( e->count_by_charges() ) {
             if( e->typeId() == what ) {
-                if( e->charges > qty ) {
-                    e->charges -= qty;
+                if( e->charges() > qty ) {
+                    e->set_charges( e->charges() - qty );
                     detached_ptr<item> split = item::spawn( *e );
-                    split->charges = qty;
+                    split->set_charges( qty );
                     res.push_back( std::move( split ) );
                     qty = 0;
                     return VisitResponse::ABORT;
                 } else {
-                    qty -= e->charges;
+                    qty -= e->charges();
                     res.push_back( std::move( e ) );
                 }
             }
@@ -11670,9 +11667,9 @@ bool Character::can_reload( const item &it, const itype_id &ammo ) const
 int Character::item_reload_cost( const item &it, item &ammo, int qty ) const
 {
     if( ammo.is_ammo() ) {
-        qty = std::max( std::min( ammo.charges, qty ), 1 );
+        qty = std::max( std::min( ammo.charges(), qty ), 1 );
     } else if( ammo.is_ammo_container() || ammo.is_container() ) {
-        qty = clamp( qty, ammo.contents.front().charges, 1 );
+        qty = clamp( qty, ammo.contents.front().charges(), 1 );
     } else if( ammo.is_magazine() ) {
         qty = 1;
     } else {
@@ -11681,12 +11678,12 @@ int Character::item_reload_cost( const item &it, item &ammo, int qty ) const
     }
 
     //Save the quantity so we can change it for item_handling_cost and reset it after
-    int saved_quantity = ammo.charges;
-    ammo.charges = qty;
+    int saved_quantity = ammo.charges();
+    ammo.set_charges( qty );
     // No base cost for handling ammo - that's already included in obtain cost
     // We have the ammo in our hands right now
     int mv = item_handling_cost( ammo, true, 0 );
-    ammo.charges = saved_quantity;
+    ammo.set_charges( saved_quantity );
 
     if( ammo.has_flag( flag_MAG_BULKY ) ) {
         mv *= 1.5; // bulky magazines take longer to insert
@@ -99,7 +99,7 @@ void siphon( Character &ch, vehicle &veh, const itype_id &desired_liquid )
     liquid_handler::handle_liquid( std::move( liquid ) );
     // NOLINTNEXTLINE(bugprone-use-after-move)
     if( liquid ) {
-        veh.drain( desired_liquid, qty - liquid->charges );
+        veh.drain( desired_liquid, qty - liquid->charges() );
     } else {
         veh.drain( desired_liquid, qty );
     }
@@ -463,7 +463,7 @@ std::string fmt_wielded_weapon( const Character &who )
 
     } else if( weapon.is_container() && weapon.contents.num_item_stacks() == 1 ) {
         return string_format( "%s (%d)", weapon.tname(),
-                              weapon.contents.front().charges );
+                              weapon.contents.front().charges() );
 
     } else {
         return weapon.tname();
@@ -865,7 +865,7 @@ void Character::process_items()
     // Active item processing done, now we're recharging.
     std::vector<item *> active_worn_items;
     bool weapon_active = primary_weapon().has_flag( flag_USE_UPS ) &&
-                         primary_weapon().charges < primary_weapon().type->maximum_charges();
+                         primary_weapon().charges() < primary_weapon().type->maximum_charges();
     std::vector<size_t> active_held_items;
     int ch_UPS = 0;
     for( size_t index = 0; index < inv.size(); index++ ) {
@@ -876,14 +876,14 @@ void Character::process_items()
         } else if( identifier == itype_adv_UPS_off ) {
             ch_UPS += it.ammo_remaining() / 0.5;
         }
-        if( it.has_flag( flag_USE_UPS ) && it.charges < it.type->maximum_charges() ) {
+        if( it.has_flag( flag_USE_UPS ) && it.charges() < it.type->maximum_charges() ) {
             active_held_items.push_back( index );
         }
     }
     bool update_required = get_check_encumbrance();
     for( item *&w : worn ) {
         if( w->has_flag( flag_USE_UPS ) &&
-            w->charges < w->type->maximum_charges() ) {
+            w->charges() < w->type->maximum_charges() ) {
             active_worn_items.push_back( w );
         }
         // Necessary for UPS in Aftershock - check worn items for charge
@@ -914,18 +914,18 @@ void Character::process_items()
         }
         item &it = inv.find_item( index );
         ch_UPS_used++;
-        it.charges++;
+        it.set_charges( it.charges() + 1 );
     }
     if( weapon_active && ch_UPS_used < ch_UPS ) {
         ch_UPS_used++;
-        primary_weapon().charges++;
+        primary_weapon().set_charges( primary_weapon().charges() + 1 );
     }
     for( item *worn_item : active_worn_items ) {
         if( ch_UPS_used >= ch_UPS ) {
             break;
         }
         ch_UPS_used++;
-        worn_item->charges++;
+        worn_item->set_charges( worn_item->charges() + 1 );
     }
     if( ch_UPS_used > 0 ) {
         use_charges( itype_UPS, ch_UPS_used );
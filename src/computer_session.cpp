@@ -373,12 +373,12 @@ void computer_session::action_sample()
                 if( capa <= 0 ) {
                     continue;
                 }
-                capa = std::min( sewage->charges, capa );
+                capa = std::min( sewage->charges(), capa );
                 if( elem->contents.empty() ) {
                     elem->put_in( item::spawn( itype_sewage, calendar::turn ) );
-                    elem->contents.front().charges = capa;
+                    elem->contents.front().set_charges( capa );
                 } else {
-                    elem->contents.front().charges += capa;
+                    elem->contents.front().set_charges( elem->contents.front().charges() + capa );
                 }
                 found_item = true;
                 break;
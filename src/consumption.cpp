@@ -315,7 +315,7 @@ nutrients Character::compute_effective_nutrients( const item &comest ) const
         nutrients tally{};
         for( const item * const &component : components ) {
             nutrients component_value =
-                compute_effective_nutrients( *component ) * component->charges;
+                compute_effective_nutrients( *component ) * component->charges();
             if( component->has_flag( flag_BYPRODUCT ) ) {
                 tally -= component_value;
             } else {
@@ -1289,7 +1289,7 @@ bool Character::feed_furnace_with( item &it )
         return false;
     }
 
-    const int consumed_charges =  std::min( it.charges, it.charges_per_volume( furnace_max_volume ) );
+    const int consumed_charges =  std::min( it.charges(), it.charges_per_volume( furnace_max_volume ) );
     const int energy =  get_acquirable_energy( it, rechargeable_cbm::furnace );
 
     if( energy == 0 ) {
@@ -1331,7 +1331,7 @@ bool Character::feed_furnace_with( item &it )
         mod_power_level( units::from_kilojoule( profitable_energy ) );
     }
 
-    it.charges -= consumed_charges;
+    it.set_charges( it.charges() - consumed_charges );
     mod_moves( -250 );
 
     return true;
@@ -1348,7 +1348,7 @@ bool Character::fuel_bionic_with( item &it )
 
     const int fuel_multiplier = get_bionic_state( bio ).info().fuel_multiplier;
 
-    int loadable = std::min( it.charges * fuel_multiplier, get_fuel_capacity( it.typeId() ) );
+    int loadable = std::min( it.charges() * fuel_multiplier, get_fuel_capacity( it.typeId() ) );
     int loaded = 0;
 
     if( !str_loaded.empty() ) {
@@ -1358,7 +1358,7 @@ bool Character::fuel_bionic_with( item &it )
     const std::string new_charge = std::to_string( loadable + loaded );
 
     loadable = std::ceil( loadable / fuel_multiplier );
-    it.charges -= loadable;
+    it.set_charges( it.charges() - loadable );
     // Type and amount of fuel
     set_value( it.typeId().str(), new_charge );
     update_fuel_storage( it.typeId() );
@@ -1393,9 +1393,9 @@ int Character::get_acquirable_energy( const item &it, rechargeable_cbm cbm ) con
             break;
 
         case rechargeable_cbm::reactor:
-            if( it.charges > 0 ) {
+            if( it.charges() > 0 ) {
                 const auto iter = plut_charges.find( it.typeId() );
-                return iter != plut_charges.end() ? it.charges * iter->second : 0;
+                return iter != plut_charges.end() ? it.charges() * iter->second : 0;
             }
 
             break;
@@ -1403,7 +1403,7 @@ int Character::get_acquirable_energy( const item &it, rechargeable_cbm cbm ) con
         case rechargeable_cbm::furnace: {
             units::volume consumed_vol = it.volume();
             units::mass consumed_mass = it.weight();
-            if( it.count_by_charges() && it.charges > it.charges_per_volume( furnace_max_volume ) ) {
+            if( it.count_by_charges() && it.charges() > it.charges_per_volume( furnace_max_volume ) ) {
                 const double n_stacks = static_cast<double>( it.charges_per_volume( furnace_max_volume ) ) /
                                         it.type->stack_size;
                 consumed_vol = it.type->volume * n_stacks;
@@ -1424,7 +1424,7 @@ int Character::get_acquirable_energy( const item &it, rechargeable_cbm cbm ) con
         }
         case rechargeable_cbm::other:
             const bionic_id &bid = get_most_efficient_bionic( get_bionic_fueled_with( it ) );
-            const int to_consume = std::min( it.charges, bid->fuel_capacity );
+            const int to_consume = std::min( it.charges(), bid->fuel_capacity );
             const int to_charge = static_cast<int>( it.fuel_energy() * to_consume * bid->fuel_efficiency );
             return to_charge;
     }
@@ -1523,9 +1523,9 @@ detached_ptr<item> Character::consume_item( detached_ptr<item> &&target )
         fuel_bionic_with( comest ) ) {
 
         if( &comest == &*target ) {
-            return target->charges > 0 ? std::move( target ) : detached_ptr<item>();
+            return target->charges() > 0 ? std::move( target ) : detached_ptr<item>();
         } else {
-            if( comest.charges <= 0 ) {
+            if( comest.charges() <= 0 ) {
                 comest.detach();
             }
             target->on_contents_changed();
@@ -1652,8 +1652,8 @@ bool Character::consume_med( item &target )
     }
 
     mod_moves( -250 );
-    target.charges -= amount_used;
-    return target.charges <= 0;
+    target.set_charges( target.charges() - amount_used );
+    return target.charges() <= 0;
 }
 
 consumption_event::consumption_event( const item &food ) : time( calendar::turn )
@@ -416,7 +416,7 @@ bool player::check_eligible_containers_for_crafting( const recipe &rec, int batc
         // we go through half-filled containers first, then go through empty containers if we need
         std::sort( conts.begin(), conts.end(), item_ptr_compare_by_charges );
 
-        int charges_to_store = prod->charges;
+        int charges_to_store = prod->charges();
         for( const item *cont : conts ) {
             if( charges_to_store <= 0 ) {
                 break;
@@ -629,7 +629,7 @@ static void set_components( item &of, const std::vector<item *> &used,
             components.push_back( item::spawn( *tmp ) );
             // This assumes all (count-by-charges) items of the same type have been merged into one,
             // which has a charges value that can be evenly divided by batch_size.
-            components.back()->charges = tmp->charges / batch_size;
+            components.back()->set_charges( tmp->charges() / batch_size );
         } else {
             if( ( non_charges_counter + offset ) % batch_size == 0 ) {
                 components.push_back( item::spawn( *tmp ) );
@@ -773,7 +773,7 @@ void player::craft_skill_gain( const item &craft, const int &multiplier )
     }
 
     const recipe &making = craft.get_making();
-    const int batch_size = craft.charges;
+    const int batch_size = craft.charges();
 
     std::vector<npc *> helpers = character_funcs::get_crafting_helpers( *this );
 
@@ -1028,7 +1028,7 @@ void complete_craft( player &p, item &craft, const bench_location & )
     }
 
     const recipe &making = craft.get_making();
-    const int batch_size = craft.charges;
+    const int batch_size = craft.charges();
     std::vector<detached_ptr<item>> used = craft.remove_components();
     std::vector<item *> used_items;
     used_items.reserve( used.size() );
@@ -1109,7 +1109,7 @@ void complete_craft( player &p, item &craft, const bench_location & )
             for( detached_ptr<item> &comp : used ) {
                 // only comestibles have cooks_like.  any other type of item will throw an exception, so filter those out
                 if( comp->is_comestible() && !comp->get_comestible()->cooks_like.is_empty() ) {
-                    comp = item::spawn( comp->get_comestible()->cooks_like, comp->birthday(), comp->charges );
+                    comp = item::spawn( comp->get_comestible()->cooks_like, comp->birthday(), comp->charges() );
                 }
                 // If this recipe is cooked or dehydrated, components are no longer raw.
                 if( should_heat || is_dehydrated ) {
@@ -1131,9 +1131,9 @@ void complete_craft( player &p, item &craft, const bench_location & )
             //TODO!: check what ref level should be compared here
             if( newit != &food_contained ) {  // If a canned/contained item was crafted…
                 // … the container holds exactly one completion of the recipe, no matter the batch size.
-                food_contained.recipe_charges = food_contained.charges;
+                food_contained.recipe_charges = food_contained.charges();
             } else { // Otherwise, the item is already stacked so we need to divide by batch size.
-                newit->recipe_charges = newit->charges / batch_size;
+                newit->recipe_charges = newit->charges() / batch_size;
             }
             newit_counter++;
         }
@@ -1247,7 +1247,7 @@ bool player::can_continue_craft( item &craft )
     if( !craft.has_tools_to_continue() ) {
 
         const std::vector<std::vector<tool_comp>> &tool_reqs = rec.simple_requirements().get_tools();
-        const int batch_size = craft.charges;
+        const int batch_size = craft.charges();
 
         std::vector<std::vector<tool_comp>> adjusted_tool_reqs;
         for( const std::vector<tool_comp> &alternatives : tool_reqs ) {
@@ -1598,7 +1598,7 @@ std::vector<detached_ptr<item>> player::consume_items( map &m, const comp_select
         std::vector<detached_ptr<item>>::iterator b = ret.begin();
         b++;
         while( ret.size() > 1 ) {
-            ret.front()->charges += ( *b )->charges;
+            ret.front()->set_charges( ret.front()->charges() + ( *b )->charges() );
             b = ret.erase( b );
         }
     }
@@ -1815,7 +1815,7 @@ bool player::craft_consume_tools( item &craft, int mulitplier, bool start_craft
         }
 
         // Account for batch size
-        int full_cost = charges * craft.charges;
+        int full_cost = charges * craft.charges();
 
         if( start_craft ) {
             return crafting::charges_for_starting( full_cost );
@@ -1947,7 +1947,7 @@ ret_val<bool> crafting::can_disassemble( const Character &who, const item &obj,
 
     if( obj.count_by_charges() ) {
         int batch_size = r.disassembly_batch_size();
-        if( obj.charges < batch_size ) {
+        if( obj.charges() < batch_size ) {
             auto msg = vgettext( "You need at least %d charge of %s.",
                                  "You need at least %d charges of %s.", batch_size );
             return ret_val<bool>::make_failure( msg, batch_size, obj.tname() );
@@ -2044,7 +2044,7 @@ static disass_prompt_result prompt_disassemble_in_seq( avatar &you, const item &
     }
 
     if( obj.count_by_charges() ) {
-        int num_batches = obj.charges / batch_size;
+        int num_batches = obj.charges() / batch_size;
         if( num_batches == 0 ) {
             // Not enough charges for even one disassembly
             return res;
@@ -2166,7 +2166,7 @@ void crafting::complete_disassemble( Character &who, const iuse_location &target
 
     if( org_item.count_by_charges() ) {
         int batch_size = dis.disassembly_batch_size();
-        org_item.charges -= batch_size * target.count;
+        org_item.set_charges( org_item.charges() - ( batch_size * target.count ) );
     }
 
     // Consume tool charges
@@ -2204,9 +2204,9 @@ void crafting::complete_disassemble( Character &who, const iuse_location &target
             int compcount = comp.count * target.count;
             detached_ptr<item> newit = item::spawn( comp.type, calendar::turn );
             const bool is_liquid = newit->made_of( LIQUID );
-            if( uncraft_liquids_contained && is_liquid && newit->charges != 0 ) {
+            if( uncraft_liquids_contained && is_liquid && newit->charges() != 0 ) {
                 // Spawn liquid item in its default container
-                compcount = compcount / newit->charges;
+                compcount = compcount / newit->charges();
                 if( compcount != 0 ) {
                     newit = item::in_its_container( std::move( newit ) );
                 }
@@ -2215,12 +2215,12 @@ void crafting::complete_disassemble( Character &who, const iuse_location &target
                 // they are added together on the map anyway and handle_liquid
                 // should only be called once to put it all into a container at once.
                 if( newit->count_by_charges() || is_liquid ) {
-                    newit->charges = compcount;
+                    newit->set_charges( compcount );
                     compcount = 1;
-                } else if( !newit->craft_has_charges() && newit->charges > 0 ) {
+                } else if( !newit->craft_has_charges() && newit->charges() > 0 ) {
                     // tools that can be unloaded should be created unloaded,
                     // tools that can't be unloaded will keep their default charges.
-                    newit->charges = 0;
+                    newit->set_charges( 0 );
                 }
             }
 
@@ -2269,7 +2269,7 @@ void crafting::complete_disassemble( Character &who, const iuse_location &target
 
     // remove the item, except when it's counted by charges and still has some
     // It's important to remove/delete it after its contents are removed, lest they be deleted too
-    if( !org_item.count_by_charges() || org_item.charges <= 0 ) {
+    if( !org_item.count_by_charges() || org_item.charges() <= 0 ) {
         org_item.detach();
     }
 
@@ -2319,18 +2319,18 @@ void remove_ammo( item &dis_item, Character &who )
     }
     if( dis_item.is_gun() && !dis_item.ammo_current().is_null() ) {
         detached_ptr<item> ammodrop = item::spawn( dis_item.ammo_current(), calendar::turn );
-        ammodrop->charges = dis_item.charges;
+        ammodrop->set_charges( dis_item.charges() );
         drop_or_handle( std::move( ammodrop ), who );
-        dis_item.charges = 0;
+        dis_item.set_charges( 0 );
     }
-    if( dis_item.is_tool() && dis_item.charges > 0 && !dis_item.ammo_current().is_null() ) {
+    if( dis_item.is_tool() && dis_item.charges() > 0 && !dis_item.ammo_current().is_null() ) {
         detached_ptr<item> ammodrop = item::spawn( dis_item.ammo_current(), calendar::turn );
-        ammodrop->charges = dis_item.charges;
+        ammodrop->set_charges( dis_item.charges() );
         if( dis_item.ammo_current() == itype_plut_cell ) {
-            ammodrop->charges /= PLUTONIUM_CHARGES;
+            ammodrop->set_charges( ammodrop->charges() / PLUTONIUM_CHARGES );
         }
         drop_or_handle( std::move( ammodrop ), who );
-        dis_item.charges = 0;
+        dis_item.set_charges( 0 );
     }
 }
 
@@ -77,6 +77,7 @@
 #include "overmap.h"
 #include "overmap_ui.h"
 #include "overmapbuffer.h"
+#include "path_info.h"
 #include "pimpl.h"
 #include "player.h"
 #include "pldata.h"
@@ -92,6 +93,7 @@
 #include "string_utils.h"
 #include "trait_group.h"
 #include "translations.h"
+#include "turn_profiler.h"
 #include "type_id.h"
 #include "ui.h"
 #include "ui_manager.h"
@@ -190,6 +192,8 @@ enum debug_menu_index {
     DEBUG_NESTED_MAPGEN,
     DEBUG_RESET_IGNORED_MESSAGES,
     DEBUG_RELOAD_TILES,
+    DEBUG_TURN_PROFILER,
+    DEBUG_TURN_PROFILER_TRACE,
 };
 
 class mission_debug
@@ -238,6 +242,8 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( DEBUG_BENCHMARK, true, 'b', _( "Draw benchmark" ) ) },
             { uilist_entry( DEBUG_BENCHMARK_FPS, true, 'B', _( "FPS benchmark" ) ) },
             { uilist_entry( DEBUG_HOUR_TIMER, true, 'E', _( "Toggle hour timer" ) ) },
+            { uilist_entry( DEBUG_TURN_PROFILER, true, 'P', _( "Toggle turn profiler" ) ) },
+            { uilist_entry( DEBUG_TURN_PROFILER_TRACE, true, 'x', _( "Write turn profiler trace" ) ) },
             { uilist_entry( DEBUG_TRAIT_GROUP, true, 't', _( "Test trait group" ) ) },
             { uilist_entry( DEBUG_SHOW_MSG, true, 'd', _( "Show debug message" ) ) },
             { uilist_entry( DEBUG_CRASH_GAME, true, 'C', _( "Crash game (test crash handling)" ) ) },
@@ -1442,7 +1448,7 @@ void debug()
             for( int i = 0; i < OMAPX; i++ ) {
                 for( int j = 0; j < OMAPY; j++ ) {
                     for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
-                        cur_om.seen( { i, j, k } ) = true;
+                        cur_om.set_seen( { i, j, k }, true );
                     }
                 }
             }
@@ -1867,6 +1873,23 @@ void debug()
         case DEBUG_HOUR_TIMER:
             g->toggle_debug_hour_timer();
             break;
+        case DEBUG_TURN_PROFILER: {
+            cata::turn_profiler &profiler = cata::get_turn_profiler();
+            if( profiler.is_running() ) {
+                profiler.stop();
+            } else {
+                profiler.start();
+            }
+            add_msg( string_format( "turn profiler %s", profiler.is_running() ? "started" : "stopped" ) );
+            break;
+        }
+        case DEBUG_TURN_PROFILER_TRACE: {
+            const std::string path = PATH_INFO::turn_profile_output();
+            if( cata::get_turn_profiler().write_chrome_trace( path ) ) {
+                popup( _( "Wrote the recorded zones to %s" ), path );
+            }
+            break;
+        }
         case DEBUG_CHANGE_TIME: {
             auto set_turn = [&]( const int initial, const time_duration & factor, const char *const msg ) {
                 const auto text = string_input_popup()
@@ -53,6 +53,8 @@ void distribution_grid::update( time_point to )
         if( sm == nullptr ) {
             return;
         }
+        // Updating changes the state of the active furniture
+        sm->modified = true;
 
         for( const tile_location &loc : c.second ) {
             auto &active = sm->active_furniture[loc.on_submap];
@@ -82,6 +84,11 @@ int distribution_grid::mod_resource( int amt, bool recurse )
                 if( cached_amount_here ) {
                     cached_amount_here = *cached_amount_here + amt_before_battery - amt;
                 }
+                if( amt != amt_before_battery ) {
+                    if( submap *sm = mb.lookup_submap( c.first ) ) {
+                        sm->modified = true;
+                    }
+                }
                 if( amt == 0 ) {
                     return 0;
                 }
@@ -313,6 +320,7 @@ void grid_furn_transform_queue::apply( mapbuffer &mb, distribution_grid_tracker
         } else {
             sm->set_furn( p_within_sm.raw(), qt.id );
         }
+        sm->modified = true;
 
         if( !qt.msg.empty() ) {
             if( u.sees( pos_local ) ) {
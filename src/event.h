@@ -6,7 +6,9 @@
 #include <cstddef>
 #include <cstdlib>
 #include <map>
+#include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -623,8 +625,110 @@ struct make_event_helper<Type, std::index_sequence<I...>> {
     }
 };
 
+template<event_type Type, typename IndexSequence>
+struct payload_helper;
+
+template<event_type Type, size_t... I>
+struct payload_helper<Type, std::index_sequence<I...>> {
+    using Spec = event_spec<Type>;
+    using type = std::tuple <
+                 typename cata_variant_detail::convert<Spec::fields[I].second>::type...
+                 >;
+};
+
+constexpr bool keys_equal( const char *lhs, const char *rhs )
+{
+    while( *lhs != '\0' && *lhs == *rhs ) {
+        ++lhs;
+        ++rhs;
+    }
+    return *lhs == *rhs;
+}
+
 } // namespace event_detail
 
+// The statically typed counterpart of event.  The payload is a tuple of the
+// field types listed in event_spec<Type>, so constructing and reading one
+// needs no map and no string conversions.  Fields are read by index, which
+// can be looked up by key at compile time:
+//
+//     e.get<typed_event<Type>::field( "killer" )>()
+template<event_type Type>
+class typed_event
+{
+    public:
+        using Spec = event_detail::event_spec<Type>;
+        using payload_type = typename event_detail::payload_helper <
+                             Type, std::make_index_sequence<Spec::fields.size()>
+                             >::type;
+
+        template<typename... Args>
+        explicit typed_event( time_point time, Args &&... args )
+            : time_( time )
+            , payload_( std::forward<Args>( args )... ) {
+            static_assert( sizeof...( Args ) == Spec::fields.size(),
+                           "wrong number of arguments for event type" );
+        }
+
+        static constexpr event_type type() {
+            return Type;
+        }
+        time_point time() const {
+            return time_;
+        }
+
+        // Index of the field with the given key; fails to compile if there is none
+        static constexpr size_t field( const char *key ) {
+            for( size_t i = 0; i < Spec::fields.size(); ++i ) {
+                if( event_detail::keys_equal( Spec::fields[i].first, key ) ) {
+                    return i;
+                }
+            }
+            throw std::logic_error( "no such field in event" );
+        }
+
+        template<size_t I>
+        const auto &get() const {
+            return std::get<I>( payload_ );
+        }
+
+        const payload_type &payload() const {
+            return payload_;
+        }
+
+        // Converts to the map-based form for subscribers which handle events generically
+        event to_event() const {
+            return event( Type, time_, to_data( payload_ ) );
+        }
+
+        // The map-based form of a payload, as stored by stats_tracker
+        static event::data_type to_data( const payload_type &payload ) {
+            return to_data_helper( payload, std::make_index_sequence<Spec::fields.size()> {} );
+        }
+
+        static typed_event from_event( const event &e ) {
+            return from_event_helper( e, std::make_index_sequence<Spec::fields.size()> {} );
+        }
+    private:
+        template<size_t... I>
+        static event::data_type to_data_helper( const payload_type &payload,
+                                                std::index_sequence<I...> ) {
+            return event::data_type{ {
+                    Spec::fields[I].first,
+                    cata_variant::make<Spec::fields[I].second>( std::get<I>( payload ) )
+                } ...
+            };
+        }
+
+        template<size_t... I>
+        static typed_event from_event_helper( const event &e, std::index_sequence<I...> ) {
+            return typed_event( e.time(), e.get<Spec::fields[I].second>( Spec::fields[I].first )... );
+        }
+
+        time_point time_;
+        payload_type payload_;
+};
+
 } // namespace cata
 
 #endif // CATA_SRC_EVENT_H
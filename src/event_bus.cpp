@@ -2,7 +2,10 @@
 
 #include <algorithm>
 
+#include "bodypart.h"
+#include "character.h"
 #include "debug.h"
+#include "mutation.h"
 #include "options.h"
 
 event_subscriber::~event_subscriber()
@@ -12,6 +15,11 @@ event_subscriber::~event_subscriber()
     }
 }
 
+enum_bitset<event_type> event_subscriber::notified_types() const
+{
+    return enum_bitset<event_type>().set_all();
+}
+
 void event_subscriber::on_subscribe( event_bus *b )
 {
     if( subscribed_to ) {
@@ -41,6 +49,13 @@ void event_bus::subscribe( event_subscriber *s )
     if( get_option<bool>( "ENABLE_EVENTS" ) ) {
         subscribers.push_back( s );
         s->on_subscribe( this );
+        const enum_bitset<event_type> types = s->notified_types();
+        for( size_t i = 0; i < num_types; ++i ) {
+            if( types.test( static_cast<event_type>( i ) ) ) {
+                handlers_by_type[i].push_back( { s, nullptr } );
+            }
+        }
+        s->listen_to( *this );
     }
 }
 
@@ -52,12 +67,45 @@ void event_bus::unsubscribe( event_subscriber *s )
     } else {
         ( *it )->on_unsubscribe( this );
         subscribers.erase( it );
+        for( std::vector<handler> &handlers : handlers_by_type ) {
+            handlers.erase( std::remove_if( handlers.begin(), handlers.end(), [s]( const handler & h ) {
+                return h.owner == s;
+            } ), handlers.end() );
+        }
+    }
+}
+
+template<event_type Type>
+void event_bus::send_generic( const cata::event &e ) const
+{
+    std::optional<cata::typed_event<Type>> typed;
+    for( const handler &h : handlers_by_type[static_cast<size_t>( Type )] ) {
+        if( h.callback ) {
+            if( !typed ) {
+                typed.emplace( cata::typed_event<Type>::from_event( e ) );
+            }
+            h.callback( &*typed );
+        } else {
+            h.owner->notify( e );
+        }
     }
 }
 
+template<int... I>
+auto event_bus::make_generic_senders( std::integer_sequence<int, I...> ) ->
+std::array<generic_sender, num_types>
+{
+    return {{ &event_bus::send_generic<static_cast<event_type>( I )>... }};
+}
+
 void event_bus::send( const cata::event &e ) const
 {
-    for( event_subscriber *s : subscribers ) {
-        s->notify( e );
+    static const std::array<generic_sender, num_types> senders =
+        make_generic_senders( std::make_integer_sequence<int, static_cast<int>( num_types )> {} );
+    const size_t type_index = static_cast<size_t>( e.type() );
+    if( type_index >= num_types ) {
+        debugmsg( "Invalid event type" );
+        return;
     }
+    ( this->*senders[type_index] )( e );
 }
@@ -2,9 +2,14 @@
 #ifndef CATA_SRC_EVENT_BUS_H
 #define CATA_SRC_EVENT_BUS_H
 
+#include <array>
+#include <functional>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "calendar.h"
+#include "enum_bitset.h"
 #include "event.h"
 
 class event_bus;
@@ -16,7 +21,13 @@ class event_subscriber
         event_subscriber( const event_subscriber & ) = delete;
         event_subscriber &operator=( const event_subscriber & ) = delete;
         virtual ~event_subscriber();
-        virtual void notify( const cata::event & ) = 0;
+        // Receives the map-based form of every event in notified_types()
+        virtual void notify( const cata::event & ) {}
+        // Event types to pass to notify().  Defaults to all of them.
+        virtual enum_bitset<event_type> notified_types() const;
+        // Called once on subscription, override to register typed listeners
+        // with event_bus::listen.
+        virtual void listen_to( event_bus & ) {}
     private:
         friend class event_bus;
         void on_subscribe( event_bus * );
@@ -27,6 +38,9 @@ class event_subscriber
 class event_bus
 {
     public:
+        template<event_type Type>
+        using listener = std::function<void( const cata::typed_event<Type> & )>;
+
         event_bus() = default;
         event_bus( const event_bus & ) = delete;
         event_bus &operator=( const event_bus & ) = delete;
@@ -34,13 +48,58 @@ class event_bus
         void subscribe( event_subscriber * );
         void unsubscribe( event_subscriber * );
 
+        // Registers a callback for the statically typed payload of one event
+        // type.  It lives until owner unsubscribes.
+        template<event_type Type>
+        void listen( event_subscriber *owner, listener<Type> callback ) {
+            handlers_by_type[static_cast<size_t>( Type )].push_back( {
+                owner, [callback = std::move( callback )]( const void *e ) {
+                    callback( *static_cast<const cata::typed_event<Type> *>( e ) );
+                }
+            } );
+        }
+
         void send( const cata::event & ) const;
+        // Only builds the payload if anyone is interested in this event type,
+        // and only converts it to cata::event for subscribers using notify().
         template<event_type Type, typename... Args>
         void send( Args &&... args ) const {
-            send( cata::event::make<Type>( std::forward<Args>( args )... ) );
+            const std::vector<handler> &handlers = handlers_by_type[static_cast<size_t>( Type )];
+            if( handlers.empty() ) {
+                return;
+            }
+            const cata::typed_event<Type> e( calendar::turn, std::forward<Args>( args )... );
+            std::optional<cata::event> generic;
+            for( const handler &h : handlers ) {
+                if( h.callback ) {
+                    h.callback( &e );
+                } else {
+                    if( !generic ) {
+                        generic.emplace( e.to_event() );
+                    }
+                    h.owner->notify( *generic );
+                }
+            }
         }
     private:
+        // Either a typed listener or, with an empty callback, a subscriber
+        // using notify().  Kept in subscription order.
+        struct handler {
+            event_subscriber *owner;
+            // Takes a pointer to cata::typed_event of the handled type
+            std::function<void( const void * )> callback;
+        };
+        static constexpr size_t num_types = static_cast<size_t>( event_type::num_event_types );
+        using generic_sender = void ( event_bus::* )( const cata::event & ) const;
+
+        template<event_type Type>
+        void send_generic( const cata::event & ) const;
+        template<int... I>
+        static std::array<generic_sender, num_types> make_generic_senders(
+            std::integer_sequence<int, I...> );
+
         std::vector<event_subscriber *> subscribers;
+        std::array<std::vector<handler>, num_types> handlers_by_type;
 };
 
 event_bus &get_event_bus();
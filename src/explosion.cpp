@@ -1749,9 +1749,9 @@ void emp_blast( const tripoint &p )
         // TODO: More effects?
         //e-handcuffs effects
         item &cuffs = u.primary_weapon();
-        if( cuffs.typeId() == itype_e_handcuffs && cuffs.charges > 0 ) {
+        if( cuffs.typeId() == itype_e_handcuffs && cuffs.charges() > 0 ) {
             cuffs.unset_flag( flag_NO_UNWIELD );
-            cuffs.charges = 0;
+            cuffs.set_charges( 0 );
             cuffs.active = false;
             add_msg( m_good, _( "The %s on your wrists spark briefly, then release your hands!" ),
                      cuffs.tname() );
@@ -1760,7 +1760,7 @@ void emp_blast( const tripoint &p )
     // Drain any items of their battery charge
     for( auto &it : here.i_at( p ) ) {
         if( it->is_tool() && it->ammo_current() == itype_battery ) {
-            it->charges = 0;
+            it->set_charges( 0 );
         }
     }
     // TODO: Drain NPC energy reserves
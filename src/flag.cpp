@@ -356,6 +356,7 @@ const flag_id flag_WINDMETER( "WINDMETER" );
 namespace
 {
 generic_factory<json_flag> json_flags_all( "json_flags" );
+flag_bitset inherited;
 } // namespace
 
 /** @relates string_id */
@@ -408,6 +409,7 @@ void json_flag::check_consistency()
 void json_flag::reset()
 {
     json_flags_all.reset();
+    inherited.clear();
 }
 
 void json_flag::load_all( const JsonObject &jo, const std::string &src )
@@ -428,6 +430,12 @@ void json_flag::check() const
 void json_flag::finalize_all()
 {
     json_flags_all.finalize();
+    inherited.clear();
+    for( const json_flag &f : json_flags_all.get_all() ) {
+        if( f.inherit() ) {
+            inherited.set( f.id );
+        }
+    }
 }
 
 bool json_flag::is_ready()
@@ -439,3 +447,59 @@ const std::vector<json_flag> &json_flag::get_all()
 {
     return json_flags_all.get_all();
 }
+
+int json_flag::index( const flag_id &id )
+{
+    if( !json_flags_all.is_valid( id ) ) {
+        return -1;
+    }
+    return json_flags_all.convert( id, int_id<json_flag>( -1 ) ).to_i();
+}
+
+const flag_bitset &json_flag::inherited_flags()
+{
+    return inherited;
+}
+
+bool flag_bitset::test( const flag_id &id ) const
+{
+    return test( json_flag::index( id ) );
+}
+
+void flag_bitset::set( const flag_id &id )
+{
+    const int i = json_flag::index( id );
+    if( i >= 0 ) {
+        set( i );
+    }
+}
+
+void flag_bitset::set( int i )
+{
+    if( static_cast<std::size_t>( i / 64 ) >= bits.size() ) {
+        bits.resize( i / 64 + 1 );
+    }
+    bits[i / 64] |= std::uint64_t( 1 ) << ( i % 64 );
+}
+
+flag_bitset &flag_bitset::operator|=( const flag_bitset &rhs )
+{
+    if( rhs.bits.size() > bits.size() ) {
+        bits.resize( rhs.bits.size() );
+    }
+    for( std::size_t i = 0; i < rhs.bits.size(); i++ ) {
+        bits[i] |= rhs.bits[i];
+    }
+    return *this;
+}
+
+flag_bitset &flag_bitset::operator&=( const flag_bitset &rhs )
+{
+    if( rhs.bits.size() < bits.size() ) {
+        bits.resize( rhs.bits.size() );
+    }
+    for( std::size_t i = 0; i < bits.size(); i++ ) {
+        bits[i] &= rhs.bits[i];
+    }
+    return *this;
+}
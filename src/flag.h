@@ -6,6 +6,7 @@
 #include <string>
 
 #include "catalua_type_operators.h"
+#include "flag_bitset.h"
 #include "translations.h"
 #include "type_id.h"
 
@@ -423,6 +424,15 @@ class json_flag
 
         static const std::vector<json_flag> &get_all();
 
+        /**
+         * Dense index of a loaded flag, from 0 to the number of flags, or -1 if @p id isn't
+         * a loaded flag. Uses the id cached in @p id, so it's cheap after the first call.
+         */
+        static int index( const flag_id &id );
+
+        /** Flags that base items inherit from attached items, see @ref inherit. */
+        static const flag_bitset &inherited_flags();
+
         LUA_TYPE_OPS( json_flag, id );
 
     private:
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef CATA_SRC_FLAG_BITSET_H
+#define CATA_SRC_FLAG_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "type_id.h"
+
+/**
+ * Set of flags, one bit per flag at a dense index: @ref json_flag::index for json flags,
+ * @ref ter_furn_flag for terrain and furniture flags.
+ * Testing for a flag is a bit test, so it's used where flags are checked a lot.
+ */
+class flag_bitset
+{
+    public:
+        bool test( int index ) const {
+            return index >= 0 && static_cast<std::size_t>( index / 64 ) < bits.size() &&
+                   ( bits[index / 64] >> ( index % 64 ) & 1 ) != 0;
+        }
+        bool test( const flag_id &id ) const;
+        /** Adds the flag, unless it isn't a loaded one. */
+        void set( const flag_id &id );
+        void set( int index );
+        void clear() {
+            bits.clear();
+        }
+
+        flag_bitset &operator|=( const flag_bitset &rhs );
+        flag_bitset &operator&=( const flag_bitset &rhs );
+
+    private:
+        std::vector<std::uint64_t> bits;
+};
+
+#endif // CATA_SRC_FLAG_BITSET_H
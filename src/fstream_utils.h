@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_FSTREAM_UTILS_H
 #define CATA_SRC_FSTREAM_UTILS_H
 
+#include <cstdint>
 #include <iosfwd>
 #include <string>
 #include <memory>
@@ -117,6 +118,17 @@ bool write_to_file( const std::string &path, const std::function<void( std::ostr
 void write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer );
 ///@}
 
+/** Files and bytes written by @ref write_to_file since the game started. */
+struct file_write_stats {
+    int files = 0;
+    std::int64_t bytes = 0;
+
+    file_write_stats operator-( const file_write_stats &rhs ) const {
+        return { files - rhs.files, bytes - rhs.bytes };
+    }
+};
+file_write_stats get_file_write_stats();
+
 class JsonDeserializer;
 
 /**
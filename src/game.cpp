@@ -38,6 +38,7 @@
 #include "activity_handlers.h"
 #include "armor_layers.h"
 #include "artifact.h"
+#include "async_file_writer.h"
 #include "auto_note.h"
 #include "auto_pickup.h"
 #include "avatar.h"
@@ -114,6 +115,7 @@
 #include "map_selector.h"
 #include "mapbuffer.h"
 #include "mapdata.h"
+#include "mapgen_queue.h"
 #include "mapsharing.h"
 #include "memorial_logger.h"
 #include "messages.h"
@@ -162,6 +164,8 @@
 #include "timed_event.h"
 #include "translations.h"
 #include "trap.h"
+#include "turn_profiler.h"
+#include "typed_options.h"
 #include "ui.h"
 #include "ui_manager.h"
 #include "uistate.h"
@@ -556,7 +560,7 @@ bool game::start_game()
     new_game = true;
     start_calendar();
     get_weather().nextweather = calendar::turn;
-    safe_mode = ( get_option<bool>( "SAFEMODE" ) ? SAFE_MODE_ON : SAFE_MODE_OFF );
+    safe_mode = ( get_option( option::SAFEMODE ) ? SAFE_MODE_ON : SAFE_MODE_OFF );
     mostseen = 0; // ...and mostseen is 0, we haven't seen any monsters yet.
     get_safemode().load_global();
     get_distraction_manager().load();
@@ -1214,6 +1218,7 @@ bool game::cleanup_at_end()
 
     MAPBUFFER.clear();
     overmap_buffer.clear();
+    get_mapgen_queue().clear();
 
     avatar &player_character = get_avatar();
     player_character = avatar();
@@ -1351,6 +1356,8 @@ void game::calc_driving_offset( vehicle *veh )
 // Returns true if game is over (death, saved, quit, etc)
 bool game::do_turn()
 {
+    // Everything since the previous call, including waiting for input, counts as a turn
+    cata::get_turn_profiler().end_turn();
     ZoneScoped;
     cleanup_arenas();
     if( is_game_over() ) {
@@ -1402,11 +1409,15 @@ bool game::do_turn()
     u.update_body();
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( get_option( option::AUTOSAVE ) &&
+        calendar::once_every( 1_turns * get_option( option::AUTOSAVE_TURNS ) ) &&
         !u.is_dead_state() ) {
         autosave();
     }
+    // Report the outcome of a background save once it's done
+    if( get_async_file_writer().finished() ) {
+        get_async_file_writer().wait();
+    }
 
     weather.update_weather();
     reset_light_level();
@@ -1528,7 +1539,7 @@ bool game::do_turn()
     explosion_handler::get_explosion_queue().execute();
     cleanup_dead();
 
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( u.moves < 0 && get_option( option::FORCE_REDRAW ) ) {
         ui_manager::redraw();
         refresh_display();
     }
@@ -1595,6 +1606,14 @@ bool game::do_turn()
     sfx::do_vehicle_exterior_engine_sfx();
     sfx::do_fatigue();
 
+    // Generate what the player is heading toward while they aren't waiting on anything else
+    if( get_option( option::MAPGEN_PREFETCH_BUDGET ) > 0 ) {
+        ZoneScopedN( "mapgen_prefetch" );
+        mapgen_queue &mapgen_jobs = get_mapgen_queue();
+        mapgen_jobs.update( u.global_omt_location() );
+        mapgen_jobs.process( std::chrono::milliseconds( get_option( option::MAPGEN_PREFETCH_BUDGET ) ) );
+    }
+
     // reset player noise
     u.volume = 0;
 
@@ -2473,6 +2492,9 @@ void game::move_save_to_graveyard( const std::string &dirname )
     const std::string graveyard_save_dir = graveyard_dir + dirname + "/";
     const std::string &prefix            = base64_encode( u.get_save_id() ) + ".";
 
+    // The last save may still be being written, moving it now would leave part of it behind
+    get_async_file_writer().wait();
+
     if( !assure_dir_exist( graveyard_dir ) ) {
         debugmsg( "could not create graveyard path '%s'", graveyard_dir );
     }
@@ -2579,7 +2601,7 @@ bool game::load( const save_t &name )
         gamemode = std::make_unique<special_game>();
     }
 
-    safe_mode = get_option<bool>( "SAFEMODE" ) ? SAFE_MODE_ON : SAFE_MODE_OFF;
+    safe_mode = get_option( option::SAFEMODE ) ? SAFE_MODE_ON : SAFE_MODE_OFF;
     mostseen = 0; // ...and mostseen is 0, we haven't seen any monsters yet.
 
     init_autosave();
@@ -2673,8 +2695,15 @@ bool game::save_maps()
 {
     try {
         m.save();
+        const file_write_stats before = get_file_write_stats();
         overmap_buffer.save(); // can throw
+        const file_write_stats after_overmaps = get_file_write_stats();
         MAPBUFFER.save(); // can throw
+        const file_write_stats overmaps = after_overmaps - before;
+        const file_write_stats submaps = get_file_write_stats() - after_overmaps;
+        // Unchanged overmaps and submap quads are skipped, this shows what was left
+        dbg( DL::Info ) << "Saved maps: " << overmaps.files << " overmap files (" << overmaps.bytes <<
+                        " bytes), " << submaps.files << " submap files (" << submaps.bytes << " bytes)";
         return true;
     } catch( const std::exception &err ) {
         popup( _( "Failed to save the maps: %s" ), err.what() );
@@ -2744,6 +2773,19 @@ static bool save_uistate_data( const game &g )
 bool game::save( bool quitting )
 {
     cata::run_on_game_save_hooks( *DynamicDataLoader::get_instance().lua );
+    // Saving while playing only takes the snapshot, the files are written in the background.
+    // When quitting there is nothing to get back to, so everything is written right away.
+    async_file_writer &async_writer = get_async_file_writer();
+    if( quitting ) {
+        async_writer.wait();
+    } else {
+        async_writer.begin_capture();
+    }
+    on_out_of_scope end_capture( [&]() {
+        if( async_writer.capturing() ) {
+            async_writer.end_capture();
+        }
+    } );
     try {
         reset_save_ids( time( nullptr ), quitting );
         if( !save_factions_missions_npcs() ||
@@ -3128,6 +3170,8 @@ void game::draw( ui_adaptor &ui )
     // much easier to play with them
     // (e.g. for blind players)
     ui.set_cursor( w_terrain, -u.view_offset.xy() + point( POSX, POSY ) );
+
+    report_option_lookups();
 }
 
 void game::draw_panels( bool force_draw )
@@ -3137,7 +3181,7 @@ void game::draw_panels( bool force_draw )
     const bool draw_this_turn = current_turn > previous_turn || force_draw;
     auto &mgr = panel_manager::get_manager();
     int y = 0;
-    const bool sidebar_right = get_option<std::string>( "SIDEBAR_POSITION" ) == "right";
+    const bool sidebar_right = get_option( option::SIDEBAR_POSITION ) == "right";
     int spacer = get_option<bool>( "SIDEBAR_SPACERS" ) ? 1 : 0;
     int log_height = 0;
     for( const window_panel &panel : mgr.get_current_layout() ) {
@@ -3592,8 +3636,8 @@ character_id game::assign_npc_id()
 
 Creature *game::is_hostile_nearby()
 {
-    int distance = ( get_option<int>( "SAFEMODEPROXIMITY" ) <= 0 ) ? MAX_VIEW_DISTANCE :
-                   get_option<int>( "SAFEMODEPROXIMITY" );
+    int distance = ( get_option( option::SAFEMODEPROXIMITY ) <= 0 ) ? MAX_VIEW_DISTANCE :
+                   get_option( option::SAFEMODEPROXIMITY );
     return is_hostile_within( distance );
 }
 
@@ -3849,7 +3893,7 @@ void game::mon_info_update( )
     ZoneScoped;
 
     int newseen = 0;
-    const int safe_proxy_dist = get_option<int>( "SAFEMODEPROXIMITY" );
+    const int safe_proxy_dist = get_option( option::SAFEMODEPROXIMITY );
     const int iProxyDist = ( safe_proxy_dist <= 0 ) ? MAX_VIEW_DISTANCE :
                            safe_proxy_dist;
 
@@ -4033,10 +4077,11 @@ void game::mon_info_update( )
         if( safe_mode == SAFE_MODE_ON ) {
             set_safe_mode( SAFE_MODE_STOP );
         }
-    } else if( calendar::turn > previous_turn && get_option<bool>( "AUTOSAFEMODE" ) &&
+    } else if( calendar::turn > previous_turn && get_option( option::AUTOSAFEMODE ) &&
                newseen == 0 ) { // Auto-safe mode, but only if it's a new turn
         turnssincelastmon += to_turns<int>( calendar::turn - previous_turn );
-        if( turnssincelastmon >= get_option<int>( "AUTOSAFEMODETURNS" ) && safe_mode == SAFE_MODE_OFF ) {
+        if( turnssincelastmon >= get_option( option::AUTOSAFEMODETURNS ) &&
+            safe_mode == SAFE_MODE_OFF ) {
             set_safe_mode( SAFE_MODE_ON );
             add_msg( m_info, _( "Safe mode ON!" ) );
         }
@@ -4087,7 +4132,7 @@ void game::cleanup_dead()
 
 void game::monmove()
 {
-    ZoneScoped;
+    ZoneScopedN( "game::monmove" );
     cleanup_dead();
 
     for( monster &critter : all_monsters() ) {
@@ -6156,7 +6201,7 @@ void game::zones_manager()
             ui.position( point_zero, point_zero );
             return;
         }
-        offsetX = get_option<std::string>( "SIDEBAR_POSITION" ) != "left" ?
+        offsetX = get_option( option::SIDEBAR_POSITION ) != "left" ?
                   TERMX - width : 0;
         const int w_zone_height = TERMY - zone_ui_height;
         max_rows = w_zone_height - 2;
@@ -6647,7 +6692,7 @@ look_around_result game::look_around( bool show_window, tripoint &center,
             int la_x = TERMX - panel_width;
             std::string position = get_option<std::string>( "LOOKAROUND_POSITION" );
             if( position == "left" ) {
-                if( get_option<std::string>( "SIDEBAR_POSITION" ) == "right" ) {
+                if( get_option( option::SIDEBAR_POSITION ) == "right" ) {
                     la_x = panel_manager::get_manager().get_width_left();
                 } else {
                     la_x = panel_manager::get_manager().get_width_left() - panel_width;
@@ -8032,7 +8077,7 @@ game::vmenu_ret game::list_monsters( const std::vector<Creature *> &monster_list
                 const auto m = dynamic_cast<monster *>( cCurMon );
                 const std::string monName = ( m != nullptr ) ? m->name() : "human";
 
-                get_safemode().add_rule( monName, Attitude::A_ANY, get_option<int>( "SAFEMODEPROXIMITY" ),
+                get_safemode().add_rule( monName, Attitude::A_ANY, get_option( option::SAFEMODEPROXIMITY ),
                                          RULE_BLACKLISTED );
             }
         } else if( action == "look" ) {
@@ -9356,7 +9401,7 @@ point game::place_player( const tripoint &dest_loc )
                     bool got_it = false;
                     for( size_t i = 0; i < names.size(); ++i ) {
                         if( by_charges && next_tname == names[i] ) {
-                            counts[i] += tmpitem->charges;
+                            counts[i] += tmpitem->charges();
                             got_it = true;
                             break;
                         } else if( next_dname == names[i] ) {
@@ -9367,8 +9412,8 @@ point game::place_player( const tripoint &dest_loc )
                     }
                     if( !got_it ) {
                         if( by_charges ) {
-                            names.push_back( tmpitem->tname( tmpitem->charges ) );
-                            counts.push_back( tmpitem->charges );
+                            names.push_back( tmpitem->tname( tmpitem->charges() ) );
+                            counts.push_back( tmpitem->charges() );
                         } else {
                             names.push_back( tmpitem->display_name( 1 ) );
                             counts.push_back( 1 );
@@ -9800,7 +9845,7 @@ void game::fling_creature( Creature *c, const units::angle &dir, float flvel, bo
     bool thru = true;
     const bool is_u = ( c == &u );
     // Don't animate critters getting bashed if animations are off
-    const bool animate = is_u || get_option<bool>( "ANIMATIONS" );
+    const bool animate = is_u || get_option( option::ANIMATIONS );
 
     player *p = dynamic_cast<player *>( c );
 
@@ -11435,7 +11480,7 @@ void game::quickload()
 void game::autosave()
 {
     //Don't autosave if the min-autosave interval has not passed since the last autosave/quicksave.
-    if( time( nullptr ) < last_save_timestamp + 60 * get_option<int>( "AUTOSAVE_MINUTES" ) ) {
+    if( time( nullptr ) < last_save_timestamp + 60 * get_option( option::AUTOSAVE_MINUTES ) ) {
         return;
     }
     quicksave();    //Driving checks are handled by quicksave()
@@ -11467,13 +11512,13 @@ void game::process_artifact( item &it, player &p )
                     case ARTC_TIME:
                         // Once per hour
                         if( calendar::once_every( 1_hours ) ) {
-                            it.charges++;
+                            it.set_charges( it.charges() + 1 );
                         }
                         break;
                     case ARTC_SOLAR:
                         if( calendar::once_every( 10_minutes ) &&
                             is_in_sunlight( p.pos() ) ) {
-                            it.charges++;
+                            it.set_charges( it.charges() + 1 );
                         }
                         break;
                     // Artifacts can inflict pain even on Deadened folks.
@@ -11483,14 +11528,14 @@ void game::process_artifact( item &it, player &p )
                         if( calendar::once_every( 1_minutes ) ) {
                             add_msg( m_bad, _( "You suddenly feel sharp pain for no reason." ) );
                             p.mod_pain_noresist( 3 * rng( 1, 3 ) );
-                            it.charges++;
+                            it.set_charges( it.charges() + 1 );
                         }
                         break;
                     case ARTC_HP:
                         if( calendar::once_every( 1_minutes ) ) {
                             add_msg( m_bad, _( "You feel your body decaying." ) );
                             p.hurtall( 1, nullptr );
-                            it.charges++;
+                            it.set_charges( it.charges() + 1 );
                         }
                         break;
                     case ARTC_FATIGUE:
@@ -11498,7 +11543,7 @@ void game::process_artifact( item &it, player &p )
                             add_msg( m_bad, _( "You feel fatigue seeping into your body." ) );
                             u.mod_fatigue( 3 * rng( 1, 3 ) );
                             u.mod_stamina( -90 * rng( 1, 3 ) * rng( 1, 3 ) * rng( 2, 3 ) );
-                            it.charges++;
+                            it.set_charges( it.charges() + 1 );
                         }
                         break;
                     // Portals are energetic enough to charge the item.
@@ -11509,7 +11554,7 @@ void game::process_artifact( item &it, player &p )
                             if( m.tr_at( dest ).loadid == tr_portal ) {
                                 add_msg( m_good, _( "The portal collapses!" ) );
                                 m.remove_trap( dest );
-                                it.charges++;
+                                it.set_charges( it.charges() + 1 );
                                 break;
                             }
                         }
@@ -399,7 +399,7 @@ item *game_menus::inv::container_for( avatar &you, const item &liquid, int radiu
     };
 
     return inv_internal( you, inventory_filter_preset( filter ),
-                         string_format( _( "Container for %s" ), liquid.display_name( liquid.charges ) ), radius,
+                         string_format( _( "Container for %s" ), liquid.display_name( liquid.charges() ) ), radius,
                          string_format( _( "You don't have a suitable container for carrying %s." ),
                                         liquid.tname() ) );
 }
@@ -519,7 +519,7 @@ class comestible_inventory_preset : public inventory_selector_preset
                 const item &it = get_consumable_item( loc );
 
                 int converted_volume_scale = 0;
-                const int charges = std::max( it.charges, 1 );
+                const int charges = std::max( it.charges(), 1 );
                 const double converted_volume = round_up( convert_volume( it.volume().value() / charges,
                                                 &converted_volume_scale ), 2 );
 
@@ -83,6 +83,7 @@
 #include "string_id.h"
 #include "string_input_popup.h"
 #include "translations.h"
+#include "typed_options.h"
 #include "ui.h"
 #include "ui_manager.h"
 #include "url_utility.h"
@@ -284,7 +285,7 @@ input_context game::get_player_input( std::string &action )
     bool animate_weather = false;
     bool animate_sct = false;
     bool do_animations = [&]() {
-        if( get_option<bool>( "ANIMATIONS" ) ) {
+        if( get_option( option::ANIMATIONS ) ) {
             const bool weather_has_anim = init_weather_anim( get_weather().weather_id, wPrint );
 
             animate_weather = weather_has_anim && get_option<bool>( "ANIMATION_RAIN" );
@@ -1034,7 +1035,7 @@ static void sleep()
     std::vector<std::string> active;
     for( auto &it : u.inv_dump() ) {
         if( it->has_flag( flag_LITCIG ) ||
-            ( it->active && ( it->charges > 0 || it->units_remaining( u ) > 0 ) && it->is_tool() &&
+            ( it->active && ( it->charges() > 0 || it->units_remaining( u ) > 0 ) && it->is_tool() &&
               !it->has_flag( flag_SLEEP_IGNORE ) ) ) {
             active.push_back( it->tname() );
         }
@@ -2230,7 +2231,7 @@ bool game::handle_action()
                 } else {
                     turnssincelastmon = 0;
                     set_safe_mode( SAFE_MODE_OFF );
-                    add_msg( m_info, get_option<bool>( "AUTOSAFEMODE" )
+                    add_msg( m_info, get_option( option::AUTOSAFEMODE )
                              ? _( "Safe mode OFF!  (Auto safe mode still enabled!)" ) : _( "Safe mode OFF!" ) );
                 }
                 if( u.has_effect( effect_laserlocked ) ) {
@@ -87,21 +87,21 @@ void handle_all_liquid( detached_ptr<item> &&liquid, const int radius )
 
 bool consume_liquid( item &liquid, const int radius )
 {
-    const auto original_charges = liquid.charges;
-    while( liquid.charges > 0 && handle_liquid( liquid, radius ) ) {
+    const auto original_charges = liquid.charges();
+    while( liquid.charges() > 0 && handle_liquid( liquid, radius ) ) {
         // try again with the remaining charges
     }
-    return original_charges != liquid.charges;
+    return original_charges != liquid.charges();
 }
 
 bool consume_liquid( detached_ptr<item> &&liquid, const int radius )
 {
-    const auto original_charges = liquid->charges;
+    const auto original_charges = liquid->charges();
     // NOLINTNEXTLINE(bugprone-use-after-move)
     while( liquid && handle_liquid( std::move( liquid ), radius ) ) {
         // try again with the remaining charges
     }
-    return !liquid || ( original_charges != liquid->charges );
+    return !liquid || ( original_charges != liquid->charges() );
 }
 
 static bool get_liquid_target( item &liquid, const int radius, liquid_dest_opt &target )
@@ -115,7 +115,7 @@ static bool get_liquid_target( item &liquid, const int radius, liquid_dest_opt &
     uilist menu;
 
     map &here = get_map();
-    const std::string liquid_name = liquid.display_name( liquid.charges );
+    const std::string liquid_name = liquid.display_name( liquid.charges() );
 
     if( liquid.is_loaded() ) {
         menu.text = string_format( pgettext( "liquid", "What to do with the %1$s from %2$s?" ), liquid_name,
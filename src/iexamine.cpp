@@ -525,7 +525,7 @@ class atm_menu
             }
 
             detached_ptr<item> card = item::spawn( "cash_card", calendar::turn );
-            card->charges = 0;
+            card->set_charges( 0 );
             u.i_add( std::move( card ) );
             u.cash -= 1000;
             u.moves -= to_turns<int>( 5_seconds );
@@ -586,7 +586,7 @@ class atm_menu
                 return false;
             }
 
-            dst->charges += amount;
+            dst->set_charges( dst->charges() + amount );
             u.cash -= amount;
             u.moves -= to_turns<int>( 10_seconds );
             finish_interaction();
@@ -614,7 +614,7 @@ class atm_menu
             }
 
             for( auto &i : u.inv_dump() ) {
-                if( i == dst || i->charges <= 0 || i->typeId() != itype_cash_card ) {
+                if( i == dst || i->charges() <= 0 || i->typeId() != itype_cash_card ) {
                     continue;
                 }
                 if( u.moves < 0 ) {
@@ -626,8 +626,8 @@ class atm_menu
                     break;
                 }
 
-                dst->charges += i->charges;
-                i->charges = 0;
+                dst->set_charges( dst->charges() + i->charges() );
+                i->set_charges( 0 );
                 u.moves -= 10;
             }
 
@@ -2120,7 +2120,7 @@ std::vector<seed_tuple> iexamine::get_seed_entries( const std::vector<item *> &s
 {
     std::map<itype_id, int> seed_map;
     for( auto &seed : seed_inv ) {
-        seed_map[seed->typeId()] += ( seed->charges > 0 ? seed->charges : 1 );
+        seed_map[seed->typeId()] += ( seed->charges() > 0 ? seed->charges() : 1 );
     }
 
     std::vector<seed_tuple> seed_entries;
@@ -2260,10 +2260,10 @@ std::vector<detached_ptr<item>> iexamine::get_harvest_items( const itype &type,
         //TODO!:check
         detached_ptr<item> new_item = item::spawn( id, calendar::turn );
         if( new_item->count_by_charges() && count > 0 ) {
-            new_item->charges *= count;
-            new_item->charges /= seed_data.fruit_div;
-            if( new_item->charges <= 0 ) {
-                new_item->charges = 1;
+            new_item->set_charges( new_item->charges() * count );
+            new_item->set_charges( new_item->charges() / seed_data.fruit_div );
+            if( new_item->charges() <= 0 ) {
+                new_item->set_charges( 1 );
             }
             result.push_back( std::move( new_item ) );
         } else {
@@ -2564,7 +2564,7 @@ void iexamine::kiln_empty( player &p, const tripoint &examp )
     here.i_clear( examp );
     here.furn_set( examp, next_kiln_type );
     detached_ptr<item> result = item::spawn( itype_unfinished_charcoal, calendar::turn );
-    result->charges = char_charges;
+    result->set_charges( char_charges );
     here.add_item( examp, std::move( result ) );
     add_msg( _( "You fire the charcoal kiln." ) );
 }
@@ -2620,8 +2620,8 @@ void iexamine::kiln_full( player &, const tripoint &examp )
         }
     }
     detached_ptr<item> result = item::spawn( itype_charcoal, calendar::turn );
-    result->charges = itype_charcoal->charges_per_volume( total_volume );
-    add_msg( _( "It has finished burning, yielding %d charcoal." ), result->charges );
+    result->set_charges( itype_charcoal->charges_per_volume( total_volume ) );
+    add_msg( _( "It has finished burning, yielding %d charcoal." ), result->charges() );
     here.add_item( examp, std::move( result ) );
     here.furn_set( examp, next_kiln_type );
 }
@@ -2694,7 +2694,7 @@ void iexamine::arcfurnace_empty( player &p, const tripoint &examp )
     here.i_clear( examp );
     here.furn_set( examp, next_arcfurnace_type );
     detached_ptr<item> result = item::spawn( itype_unfinished_cac2, calendar::turn );
-    result->charges = char_charges;
+    result->set_charges( char_charges );
     here.add_item( examp, std::move( result ) );
     add_msg( _( "You turn on the furnace." ) );
 }
@@ -2749,9 +2749,9 @@ void iexamine::arcfurnace_full( player &, const tripoint &examp )
     }
 
     detached_ptr<item> result = item::spawn( itype_chem_carbide, calendar::turn );
-    result->charges = itype_chem_carbide->charges_per_volume( total_volume );
+    result->set_charges( itype_chem_carbide->charges_per_volume( total_volume ) );
 
-    add_msg( _( "It has finished burning, yielding %d calcium carbide." ), result->charges );
+    add_msg( _( "It has finished burning, yielding %d calcium carbide." ), result->charges() );
     here.add_item( examp, std::move( result ) );
     here.furn_set( examp, next_arcfurnace_type );
 }
@@ -2988,9 +2988,9 @@ void iexamine::fvat_empty( player &p, const tripoint &examp )
         item &brew = here.i_at( examp ).only_item();
         brew_type = brew.typeId();
         brew_nname = item::nname( brew_type );
-        charges_on_ground = brew.charges;
+        charges_on_ground = brew.charges();
         add_msg( _( "This keg contains %s (%d), %0.f%% full." ),
-                 brew.tname(), brew.charges, brew.volume() * 100.0 / vat_volume );
+                 brew.tname(), brew.charges(), brew.volume() * 100.0 / vat_volume );
         enum options { ADD_BREW, REMOVE_BREW, START_FERMENT };
         uilist selectmenu;
         selectmenu.text = _( "Select an action" );
@@ -3021,17 +3021,17 @@ void iexamine::fvat_empty( player &p, const tripoint &examp )
     if( to_deposit ) {
         detached_ptr<item> brew = item::spawn( brew_type, calendar::start_of_cataclysm );
         int charges_held = p.charges_of( brew_type );
-        brew->charges = charges_on_ground;
+        brew->set_charges( charges_on_ground );
         for( int i = 0; i < charges_held && !vat_full; i++ ) {
             p.use_charges( brew_type, 1 );
-            brew->charges++;
+            brew->set_charges( brew->charges() + 1 );
             if( brew->volume() >= vat_volume ) {
                 vat_full = true;
             }
         }
         add_msg( _( "Set %s in the vat." ), brew_nname );
         add_msg( _( "The keg now contains %s (%d), %0.f%% full." ),
-                 brew->tname(), brew->charges, brew->volume() * 100.0 / vat_volume );
+                 brew->tname(), brew->charges(), brew->volume() * 100.0 / vat_volume );
         here.i_clear( examp );
         //This is needed to bypass NOITEM
         here.add_item( examp, std::move( brew ) );
@@ -3104,7 +3104,7 @@ void iexamine::fvat_full( player &p, const tripoint &examp )
             here.i_clear( examp );
             for( const auto &result : results ) {
                 // TODO: Different age based on settings
-                detached_ptr<item> booze = item::spawn( result, brew_i.birthday(), brew_i.charges );
+                detached_ptr<item> booze = item::spawn( result, brew_i.birthday(), brew_i.charges() );
                 if( booze->made_of( LIQUID ) ) {
                     add_msg( _( "The %s is now ready for bottling." ), booze->tname() );
                 }
@@ -3234,11 +3234,11 @@ void iexamine::keg( player &p, const tripoint &examp )
         int charges_held = p.charges_of( drink_type );
         detached_ptr<item> drink = item::spawn( drink_type, calendar::start_of_cataclysm );
         drink->set_relative_rot( drink_rot[ drink_index ] );
-        drink->charges = 0;
+        drink->set_charges( 0 );
         bool keg_full = false;
         for( int i = 0; i < charges_held && !keg_full; i++ ) {
             g->u.use_charges( drink->typeId(), 1 );
-            drink->charges++;
+            drink->set_charges( drink->charges() + 1 );
             keg_full = drink->volume() >= keg_cap;
         }
         if( keg_full ) {
@@ -3290,7 +3290,7 @@ void iexamine::keg( player &p, const tripoint &examp )
                     return; // They didn't actually drink
                 }
 
-                if( drink.charges == 0 ) {
+                if( drink.charges() == 0 ) {
                     add_msg( _( "You squeeze the last drops of %1$s from the %2$s." ),
                              drink_tname, keg_name );
                     here.i_clear( examp );
@@ -3311,7 +3311,7 @@ void iexamine::keg( player &p, const tripoint &examp )
                 }
                 detached_ptr<item> tmp = item::spawn( drink.typeId(), calendar::turn, charges_held );
                 tmp = pour_into_keg( examp, std::move( tmp ) );
-                p.use_charges( drink.typeId(), charges_held - tmp->charges );
+                p.use_charges( drink.typeId(), charges_held - tmp->charges() );
                 add_msg( _( "You fill the %1$s with %2$s." ), keg_name, drink_nname );
                 p.moves -= to_moves<int>( 10_seconds );
                 return;
@@ -3319,7 +3319,7 @@ void iexamine::keg( player &p, const tripoint &examp )
 
             case EXAMINE: {
                 add_msg( m_info, _( "It contains %s (%d), %0.f%% full." ),
-                         drink_tname, drink.charges, drink.volume() * 100.0 / keg_cap );
+                         drink_tname, drink.charges(), drink.volume() * 100.0 / keg_cap );
                 return;
             }
 
@@ -3346,17 +3346,17 @@ detached_ptr<item> iexamine::pour_into_keg( const tripoint &pos, detached_ptr<it
 
     map_stack stack = here.i_at( pos );
     if( stack.empty() ) {
-        int charges = liquid->charges;
+        int charges = liquid->charges();
         here.add_item( pos, std::move( liquid ) );
-        obj.charges = 0;
+        obj.set_charges( 0 );
         while( charges > 0 && obj.volume() < keg_cap ) {
-            obj.charges++;
+            obj.set_charges( obj.charges() + 1 );
             charges--;
         }
         add_msg( _( "You pour %1$s into the %2$s." ), obj.tname(), keg_name );
         if( charges > 0 ) {
             detached_ptr<item> ret = item::spawn( obj );
-            ret->charges = charges;
+            ret->set_charges( charges );
             return ret;
         }
         return detached_ptr<item>();
@@ -3370,9 +3370,9 @@ detached_ptr<item> iexamine::pour_into_keg( const tripoint &pos, detached_ptr<it
             add_msg( _( "The %s is full." ), keg_name );
             return std::move( liquid );
         }
-        while( liquid->charges > 0 && drink.volume() < keg_cap ) {
-            drink.charges++;
-            liquid->charges--;
+        while( liquid->charges() > 0 && drink.volume() < keg_cap ) {
+            drink.set_charges( drink.charges() + 1 );
+            liquid->set_charges( liquid->charges() - 1 );
         }
         add_msg( _( "You pour %1$s into the %2$s." ), obj.tname(), keg_name );
     }
@@ -3496,7 +3496,7 @@ void iexamine::tree_maple_tapped( player &p, const tripoint &examp )
 
             if( !it.is_container_empty() && it.contents.front().typeId() == itype_maple_sap ) {
                 has_sap = true;
-                charges = it.contents.front().charges;
+                charges = it.contents.front().charges();
             }
         }
     }
@@ -3843,7 +3843,7 @@ static int count_charges_in_list( const itype *type, const map_stack &items )
 {
     for( const auto &candidate : items ) {
         if( candidate->type == type ) {
-            return candidate->charges;
+            return candidate->charges();
         }
     }
     return 0;
@@ -3936,7 +3936,7 @@ void iexamine::reload_furniture( player &p, const tripoint &examp )
     auto items = here.i_at( examp );
     for( auto &itm : items ) {
         if( itm->type == cur_ammo ) {
-            itm->charges += amount;
+            itm->set_charges( itm->charges() + amount );
             amount = 0;
             break;
         }
@@ -4011,25 +4011,25 @@ void iexamine::use_furn_fake_item( player &p, const tripoint &examp )
     };
 
     charges_type charge_type = charges_type::none;
-    fake_item.charges = 0;
+    fake_item.set_charges( 0 );
 
     if( fake_item.has_flag( flag_USES_GRID_POWER ) ) {
         const distribution_grid &grid = get_distribution_grid_tracker().grid_at( abspos );
-        fake_item.charges = grid.get_resource();
+        fake_item.set_charges( grid.get_resource() );
         charge_type = charges_type::grid;
     } else if( ammo != itype_id::NULL_ID() ) {
-        fake_item.charges = count_charges_in_list( &*ammo, m.i_at( examp ) );
+        fake_item.set_charges( count_charges_in_list( &*ammo, m.i_at( examp ) ) );
         charge_type = charges_type::ammo_from_map;
     }
 
-    const int original_charges = fake_item.charges;
+    const int original_charges = fake_item.charges();
     p.invoke_item( &fake_item );
 
     // HACK: Evil hack incoming
     activity_handlers::repair_activity_hack::patch_activity_for_furniture( *g->u.activity, examp,
             cur_tool.get_id() );
 
-    const int discharged_ammo = original_charges - fake_item.charges;
+    const int discharged_ammo = original_charges - fake_item.charges();
 
     if( discharged_ammo == 0 ) {
         return;
@@ -4060,7 +4060,7 @@ void iexamine::use_furn_fake_item( player &p, const tripoint &examp )
         case charges_type::none:
             debugmsg( "Somehow changed charges of fake item %s without ammo type to %d.",
                       cur_tool.get_id().c_str(),
-                      fake_item.charges
+                      fake_item.charges()
                     );
             return;
     }
@@ -4126,7 +4126,7 @@ void iexamine::sign( player &p, const tripoint &examp )
     // Allow chance to modify message.
     std::vector<tool_comp> tools;
     std::vector<item *> filter = p.crafting_inventory().items_with( []( const item & it ) {
-        return it.has_flag( flag_WRITE_MESSAGE ) && it.charges > 0;
+        return it.has_flag( flag_WRITE_MESSAGE ) && it.charges() > 0;
     } );
     tools.reserve( filter.size() );
     for( const item *writing_item : filter ) {
@@ -4199,7 +4199,7 @@ std::optional<tripoint> iexamine::getNearFilledGasTank( const tripoint &center,
             if( k->made_of( LIQUID ) ) {
                 distance = new_distance;
                 tank_loc.emplace( tmp );
-                gas_units = k->charges;
+                gas_units = k->charges();
                 break;
             }
         }
@@ -4300,18 +4300,18 @@ bool iexamine::toPumpFuel( const tripoint &src, const tripoint &dst, int units )
     for( auto item_it = items.begin(); item_it != items.end(); ++item_it ) {
         item *content = *item_it;
         if( content->made_of( LIQUID ) ) {
-            if( content->charges < units ) {
+            if( content->charges() < units ) {
                 return false;
             }
 
-            content->charges -= units;
+            content->set_charges( content->charges() - units );
 
             const auto backup_pump = here.ter( dst );
             here.ter_set( dst, ter_str_id::NULL_ID() );
             here.add_item_or_charges( dst, item::spawn( content->type, calendar::turn, units ) );
             here.ter_set( dst, backup_pump );
 
-            if( content->charges < 1 ) {
+            if( content->charges() < 1 ) {
                 items.erase( item_it );
             }
 
@@ -4334,11 +4334,11 @@ static int fromPumpFuel( const tripoint &dst, const tripoint &src )
             // add the charges to the destination
             const auto backup_tank = here.ter( dst );
             here.ter_set( dst, ter_str_id::NULL_ID() );
-            here.add_item_or_charges( dst, item::spawn( content->type, calendar::turn, content->charges ) );
+            here.add_item_or_charges( dst, item::spawn( content->type, calendar::turn, content->charges() ) );
             here.ter_set( dst, backup_tank );
 
             // remove the liquid from the pump
-            int amount = content->charges;
+            int amount = content->charges();
             items.erase( item_it );
             return amount;
         }
@@ -4520,7 +4520,7 @@ void iexamine::pay_gas( player &p, const tripoint &examp )
         if( amount >= 0 ) {
             sounds::sound( p.pos(), 6, sounds::sound_t::activity, _( "Glug Glug Glug" ), true, "tool",
                            "gaspump" );
-            cashcard->charges += amount * pricePerUnit / 1000.0f;
+            cashcard->set_charges( cashcard->charges() + amount * pricePerUnit / 1000.0f );
             add_msg( m_info, _( "Your cash cards now hold %s." ),
                      format_money( p.charges_of( itype_cash_card ) ) );
             p.moves -= to_moves<int>( 5_seconds );
@@ -5406,11 +5406,11 @@ static void smoker_activate( player &p, const tripoint &examp )
         }
     }
     here.furn_set( examp, next_smoker_type );
-    if( charcoal->charges == char_charges ) {
+    if( charcoal->charges() == char_charges ) {
         //TODO!: check
         here.i_rem( examp, charcoal );
     } else {
-        charcoal->charges -= char_charges;
+        charcoal->set_charges( charcoal->charges() - char_charges );
     }
     detached_ptr<item> result = item::spawn( "fake_smoke_plume", calendar::turn );
     result->item_counter = to_turns<int>( 6_hours );
@@ -5456,7 +5456,7 @@ void iexamine::mill_finalize( player &, const tripoint &examp, const time_point
                     result->set_flag( f );
                 }
             }
-            result->recipe_charges = result->charges;
+            result->recipe_charges = result->charges();
             // Set flag to tell set_relative_rot() to calc from bday not now
             result->set_flag( flag_PROCESSING_RESULT );
             result->set_relative_rot( it->get_relative_rot() );
@@ -5506,7 +5506,7 @@ static void smoker_finalize( player &, const tripoint &examp, const time_point &
                 it->mod_last_rot_check( 6_hours );
 
                 detached_ptr<item> result = item::spawn( it->get_comestible()->smoking_result, start_time + 6_hours,
-                                            it->charges );
+                                            it->charges() );
 
                 // Set flag to tell set_relative_rot() to calc from bday not now
                 result->set_flag( flag_PROCESSING_RESULT );
@@ -5526,7 +5526,7 @@ static void smoker_finalize( player &, const tripoint &examp, const time_point &
                         det = item::spawn( it->get_comestible()->cooks_like, it->birthday(), 1 );
                     }
                     // Smoking is always 1:1, so these must be equal for correct kcal/vitamin calculation.
-                    result->recipe_charges = det->charges;
+                    result->recipe_charges = det->charges();
                     result->add_component( std::move( det ) );
                     result->set_flag_recursive( flag_COOKED );
                 }
@@ -6098,7 +6098,7 @@ void iexamine::smoker_options( player &p, const tripoint &examp )
                         continue;
                     }
                     pop += "-> " + item::nname( it->typeId(),
-                                                it->charges ) + " (" + std::to_string( it->charges ) + ")\n";
+                                                it->charges() ) + " (" + std::to_string( it->charges() ) + ")\n";
                 }
             }
             popup( pop, PF_NONE );
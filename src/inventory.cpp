@@ -422,7 +422,7 @@ void inventory::restack( player &p )
         for( invstack::iterator other = iter; other != items.end(); ++other ) {
             if( iter != other && iter->front()->stacks_with( *other->front() ) ) {
                 if( other->front()->count_by_charges() ) {
-                    iter->front()->charges += other->front()->charges;
+                    iter->front()->set_charges( iter->front()->charges() + other->front()->charges() );
                 } else {
                     for( auto &elem : *other ) {
                         iter->push_back( elem );
@@ -456,7 +456,7 @@ static int count_charges_in_list( const itype *type, const map_stack &items )
 {
     for( const auto &candidate : items ) {
         if( candidate->type == type ) {
-            return candidate->charges;
+            return candidate->charges();
         }
     }
     return 0;
@@ -518,9 +518,10 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                     if( furn_item.has_flag( flag_USES_GRID_POWER ) ) {
                         // TODO: The grid tracker should correspond to map!
                         auto &grid = get_distribution_grid_tracker().grid_at( tripoint_abs_ms( m.getabs( p ) ) );
-                        furn_item.charges = grid.get_resource();
+                        furn_item.set_charges( grid.get_resource() );
                     } else {
-                        furn_item.charges = ammo ? count_charges_in_list( &*ammo, m.i_at( p ) ) : 0;
+                        furn_item.set_charges( ammo ? count_charges_in_list( &*ammo, m.i_at( p ) ) :
+                                               0 );
                     }
                     add_item_by_items_type_cache( furn_item, false, true, false );
                 }
@@ -542,7 +543,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
         // Kludges for now!
         if( m.has_nearby_fire( p, 0 ) ) {
             item &fire = *item::spawn_temporary( "fire", bday );
-            fire.charges = 1;
+            fire.set_charges( 1 );
             add_item_by_items_type_cache( fire, false, true, false );
         }
         // Handle any water from infinite map sources.
@@ -562,7 +563,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                     break;
                 }
             }
-            if( waterp != nullptr && waterp->charges > 0 ) {
+            if( waterp != nullptr && waterp->charges() > 0 ) {
                 add_item_by_items_type_cache( *waterp, false, true, false );
             }
         }
@@ -600,7 +601,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
             for( const auto &it : veh->fuels_left() ) {
                 item &fuel = *item::spawn_temporary( it.first, bday );
                 if( fuel.made_of( LIQUID ) ) {
-                    fuel.charges = it.second;
+                    fuel.set_charges( it.second );
                     add_item_by_items_type_cache( fuel, false, true, false );
                 }
             }
@@ -610,10 +611,10 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
         static const flag_id flag_HEATS_FOOD( "HEATS_FOOD" );
         if( kpart ) {
             item &hotplate = *item::spawn_temporary( "hotplate", bday );
-            hotplate.charges = veh->fuel_left( itype_battery, true );
-            hotplate.item_tags.insert( flag_PSEUDO );
+            hotplate.set_charges( veh->fuel_left( itype_battery, true ) );
+            hotplate.set_flag( flag_PSEUDO );
             // TODO: Allow disabling
-            hotplate.item_tags.insert( flag_HEATS_FOOD );
+            hotplate.set_flag( flag_HEATS_FOOD );
             add_item_by_items_type_cache( hotplate );
 
             item &pot = *item::spawn_temporary( "pot", bday );
@@ -625,63 +626,63 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
         }
         if( weldpart ) {
             item &welder = *item::spawn_temporary( "welder", bday );
-            welder.charges = veh->fuel_left( itype_battery, true );
-            welder.item_tags.insert( flag_PSEUDO );
+            welder.set_charges( veh->fuel_left( itype_battery, true ) );
+            welder.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( welder );
 
             item &soldering_iron = *item::spawn_temporary( "soldering_iron", bday );
-            soldering_iron.charges = veh->fuel_left( itype_battery, true );
-            soldering_iron.item_tags.insert( flag_PSEUDO );
+            soldering_iron.set_charges( veh->fuel_left( itype_battery, true ) );
+            soldering_iron.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( soldering_iron );
         }
         if( craftpart ) {
             item &vac_sealer = *item::spawn_temporary( "vac_sealer", bday );
-            vac_sealer.charges = veh->fuel_left( itype_battery, true );
-            vac_sealer.item_tags.insert( flag_PSEUDO );
+            vac_sealer.set_charges( veh->fuel_left( itype_battery, true ) );
+            vac_sealer.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( vac_sealer );
 
             item &dehydrator = *item::spawn_temporary( "dehydrator", bday );
-            dehydrator.charges = veh->fuel_left( itype_battery, true );
-            dehydrator.item_tags.insert( flag_PSEUDO );
+            dehydrator.set_charges( veh->fuel_left( itype_battery, true ) );
+            dehydrator.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( dehydrator );
 
             item &food_processor = *item::spawn_temporary( "food_processor", bday );
-            food_processor.charges = veh->fuel_left( itype_battery, true );
-            food_processor.item_tags.insert( flag_PSEUDO );
+            food_processor.set_charges( veh->fuel_left( itype_battery, true ) );
+            food_processor.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( food_processor );
 
             item &press = *item::spawn_temporary( "press", bday );
-            press.charges = veh->fuel_left( itype_battery, true );
+            press.set_charges( veh->fuel_left( itype_battery, true ) );
             press.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( press );
         }
         if( forgepart ) {
             item &forge = *item::spawn_temporary( "forge", bday );
-            forge.charges = veh->fuel_left( itype_battery, true );
-            forge.item_tags.insert( flag_PSEUDO );
+            forge.set_charges( veh->fuel_left( itype_battery, true ) );
+            forge.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( forge );
         }
         if( kilnpart ) {
             item &kiln = *item::spawn_temporary( "kiln", bday );
-            kiln.charges = veh->fuel_left( itype_battery, true );
-            kiln.item_tags.insert( flag_PSEUDO );
+            kiln.set_charges( veh->fuel_left( itype_battery, true ) );
+            kiln.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( kiln );
         }
         if( chempart ) {
             item &chemistry_set = *item::spawn_temporary( "chemistry_set", bday );
-            chemistry_set.charges = veh->fuel_left( itype_battery, true );
-            chemistry_set.item_tags.insert( flag_PSEUDO );
+            chemistry_set.set_charges( veh->fuel_left( itype_battery, true ) );
+            chemistry_set.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( chemistry_set );
 
             item &electrolysis_kit = *item::spawn_temporary( "electrolysis_kit", bday );
-            electrolysis_kit.charges = veh->fuel_left( itype_battery, true );
-            electrolysis_kit.item_tags.insert( flag_PSEUDO );
+            electrolysis_kit.set_charges( veh->fuel_left( itype_battery, true ) );
+            electrolysis_kit.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( electrolysis_kit );
         }
         if( autoclavepart ) {
             item &autoclave = *item::spawn_temporary( "autoclave", bday );
-            autoclave.charges = veh->fuel_left( itype_battery, true );
-            autoclave.item_tags.insert( flag_PSEUDO );
+            autoclave.set_charges( veh->fuel_left( itype_battery, true ) );
+            autoclave.set_flag( flag_PSEUDO );
             add_item_by_items_type_cache( autoclave );
         }
     }
@@ -1050,7 +1051,7 @@ void for_each_item_in_both(
         if( representative.count_by_charges() ) {
             //TODO!: what the shit is this used for
             item &copy = *item::spawn_temporary( representative );
-            copy.charges = std::min( copy.charges, num_to_count );
+            copy.set_charges( std::min( copy.charges(), num_to_count ) );
             f( copy );
         } else {
             for( const auto &elem_stack_iter : elem ) {
@@ -1144,7 +1145,7 @@ void inventory::update_quality_cache()
     visit_items( [ this ]( const item * e ) {
         const std::map<quality_id, int> &item_qualities = e->get_qualities();
         for( const std::pair<const quality_id, int> &quality : item_qualities ) {
-            const int item_count = e->count_by_charges() ? e->charges : 1;
+            const int item_count = e->count_by_charges() ? e->charges() : 1;
             // quality.first is the id of the quality, quality.second is the quality level
             // the value is the number of items with that quality level
             quality_cache[quality.first][quality.second] += item_count;
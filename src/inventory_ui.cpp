@@ -136,7 +136,7 @@ int inventory_entry::get_total_charges() const
 {
     int result = 0;
     for( const item *location : locations ) {
-        result += location->charges;
+        result += location->charges();
     }
     return result;
 }
@@ -147,7 +147,7 @@ int inventory_entry::get_selected_charges() const
     int result = 0;
     for( size_t i = 0; i < chosen_count; ++i ) {
         const item *location = locations[i];
-        result += location->charges;
+        result += location->charges();
     }
     return result;
 }
@@ -99,6 +99,7 @@
 #include "string_utils.h"
 #include "text_snippets.h"
 #include "translations.h"
+#include "typed_options.h"
 #include "units.h"
 #include "units_temperature.h"
 #include "units_utility.h"
@@ -184,6 +185,10 @@ static const activity_id ACT_PICKUP( "ACT_PICKUP" );
 
 static const matec_id rapid_strike( "RAPID" );
 
+static const item_var_id var_dirt( "dirt" );
+static const item_var_id var_item_note( "item_note" );
+static const item_var_id var_name( "name" );
+
 class npc_class;
 
 using npc_class_id = string_id<npc_class>;
@@ -269,7 +274,7 @@ item::item() : contents( this ),
     bday( calendar::start_of_cataclysm )
 {
     type = nullitem();
-    charges = 0;
+    charges_ = 0;
 }
 
 item::item( const itype *type, time_point turn, int qty ) : type( type ),
@@ -280,13 +285,13 @@ item::item( const itype *type, time_point turn, int qty ) : type( type ),
     item_counter = type->countdown_interval;
 
     if( qty >= 0 ) {
-        charges = qty;
+        charges_ = qty;
     } else {
         if( type->tool && type->tool->rand_charges.size() > 1 ) {
             const int charge_roll = rng( 1, type->tool->rand_charges.size() - 1 );
-            charges = rng( type->tool->rand_charges[charge_roll - 1], type->tool->rand_charges[charge_roll] );
+            charges_ = rng( type->tool->rand_charges[charge_roll - 1], type->tool->rand_charges[charge_roll] );
         } else {
-            charges = type->charges_default();
+            charges_ = type->charges_default();
         }
     }
 
@@ -411,13 +416,13 @@ item::item( const item &source ) : game_object<item>( source ), contents( this )
     faults = source.faults;
     item_tags = source.item_tags;
     curammo = source.curammo;
-    item_vars = source.item_vars;
+    vars = source.vars;
     corpse = source.corpse;
     corpse_name = source.corpse_name;
     techniques = source.techniques;
     craft_data_ = source.craft_data_;
     relic_data = source.relic_data;
-    charges = source.charges;
+    charges_ = source.charges();
     energy = source.energy;
     recipe_charges = source.recipe_charges;
     burnt = source.burnt;
@@ -456,13 +461,13 @@ item &item::operator=( const item &source )
     faults = source.faults;
     item_tags = source.item_tags;
     curammo = source.curammo;
-    item_vars = source.item_vars;
+    vars = source.vars;
     corpse = source.corpse;
     corpse_name = source.corpse_name;
     techniques = source.techniques;
     craft_data_ = source.craft_data_;
     relic_data = source.relic_data;
-    charges = source.charges;
+    charges_ = source.charges();
     energy = source.energy;
     recipe_charges = source.recipe_charges;
     burnt = source.burnt;
@@ -497,6 +502,7 @@ item &item::operator=( const item &source )
     for( item * const &it : source.components ) {
         components.push_back( item::spawn( *it ) );
     }
+    invalidate_caches();
     return *this;
 }
 
@@ -522,6 +528,7 @@ detached_ptr<item> item::make_corpse( const mtype_id &mt, time_point turn, const
     detached_ptr<item> result = item::spawn( corpse_type, turn );
 
     result->corpse = &mt.obj();
+    result->invalidate_caches();
 
     if( result->corpse->has_flag( MF_REVIVES ) ) {
         if( one_in( 20 ) ) {
@@ -541,6 +548,7 @@ void item::convert( const itype_id &new_type )
 {
     type = &*new_type;
     relic_data = type->relic_data;
+    invalidate_caches();
 }
 
 void item::deactivate( const Character *ch, bool alert )
@@ -594,6 +602,7 @@ units::energy item::mod_energy( const units::energy &qty )
 
 void item::ammo_set( const itype_id &ammo, int qty )
 {
+    invalidate_caches();
     if( qty < 0 ) {
         // completely fill an integral or existing magazine
         if( magazine_integral() || magazine_current() ) {
@@ -619,7 +628,7 @@ void item::ammo_set( const itype_id &ammo, int qty )
     if( ( ammo.is_null() && ammo_types().empty() ) || is_money() ) {
         if( ( is_tool() || is_gun() ) && magazine_integral() ) {
             curammo = nullptr;
-            charges = std::min( qty, ammo_capacity() );
+            set_charges( std::min( qty, ammo_capacity() ) );
         }
         return;
     }
@@ -643,7 +652,7 @@ void item::ammo_set( const itype_id &ammo, int qty )
 
     } else if( magazine_integral() ) {
         curammo = atype;
-        charges = std::min( qty, ammo_capacity() );
+        set_charges( std::min( qty, ammo_capacity() ) );
 
     } else {
         if( !magazine_current() ) {
@@ -684,13 +693,14 @@ void item::ammo_set( const itype_id &ammo, int qty )
 
 void item::ammo_unset()
 {
+    invalidate_caches();
     if( !is_tool() && !is_gun() && !is_magazine() ) {
         // do nothing
     } else if( is_magazine() ) {
         contents.clear_items();
     } else if( magazine_integral() ) {
         curammo = nullptr;
-        charges = 0;
+        set_charges( 0 );
     } else if( magazine_current() ) {
         magazine_current()->ammo_unset();
     }
@@ -723,12 +733,12 @@ void item::set_damage( int qty )
 
 detached_ptr<item> item::split( int qty )
 {
-    if( qty <= 0 || !count_by_charges() || qty >= charges ) {
+    if( qty <= 0 || !count_by_charges() || qty >= charges_ ) {
         return detach();
     }
     detached_ptr<item> res = item::spawn( *this );
-    res->charges = qty;
-    charges -= qty;
+    res->set_charges( qty );
+    set_charges( charges_ - qty );
     return res;
 }
 
@@ -738,18 +748,18 @@ detached_ptr<item> item::unsafe_split( int qty )
         debugmsg( "Attempted to unsafe_split a non-count by charges item." );
         return detached_ptr<item>();
     }
-    if( qty == 0 || qty >= charges ) {
-        qty = charges;
+    if( qty == 0 || qty >= charges_ ) {
+        qty = charges_;
     }
     detached_ptr<item> res = item::spawn( *this );
-    res->charges = qty;
-    charges -= qty;
+    res->set_charges( qty );
+    set_charges( charges_ - qty );
     return res;
 }
 
 void item::unsafe_rejoin( item &old )
 {
-    if( old.charges != 0 ) {
+    if( old.charges() != 0 ) {
         return;
     }
 
@@ -775,7 +785,7 @@ bool item::attempt_split( int qty,
         return false;
     }
     item &after_split = *det;
-    int starting_charges = after_split.charges;
+    int starting_charges = after_split.charges();
     det = cb( std::move( det ) );
     bool ret = true;
     bool changed = false;
@@ -783,11 +793,11 @@ bool item::attempt_split( int qty,
         if( det->type->get_id() != type->get_id() ) {
             debugmsg( "attempt_split returned the wrong item type" );
         } else {
-            changed |= det->charges != starting_charges;
+            changed |= det->charges() != starting_charges;
             //Copy any changed properties from the new item, except the charges
-            int old_charges = charges;
+            int old_charges = charges_;
             *this = *det;
-            charges = old_charges;
+            set_charges( old_charges );
             merge_charges( std::move( det ), true );
         }
         ret = false;
@@ -927,7 +937,8 @@ detached_ptr<item> item::in_container( const itype_id &cont, detached_ptr<item>
         if( obj.made_of( LIQUID ) && ret->is_container() ) {
             // Note: we can't use any of the normal container functions as they check the
             // container being suitable (seals, watertight etc.)
-            ret->contents.back().charges = obj.charges_per_volume( ret->get_container_capacity() );
+            ret->contents.back().set_charges(
+                obj.charges_per_volume( ret->get_container_capacity() ) );
         }
         return ret;
     } else {
@@ -968,13 +979,13 @@ bool item::stacks_with( const item &rhs, bool check_components, bool skip_type_c
     if( is_relic() && rhs.is_relic() && !( *relic_data == *rhs.relic_data ) ) {
         return false;
     }
-    if( charges != 0 && rhs.charges != 0 && is_money() ) {
+    if( charges_ != 0 && rhs.charges() != 0 && is_money() ) {
         // Dealing with nonempty cash cards
         return true;
     }
     // This function is also used to test whether items counted by charges should be merged, for that
     // check the, the charges must be ignored. In all other cases (tools/guns), the charges are important.
-    if( !count_by_charges() && charges != rhs.charges ) {
+    if( !count_by_charges() && charges_ != rhs.charges() ) {
         return false;
     }
     if( is_favorite != rhs.is_favorite ) {
@@ -998,7 +1009,7 @@ bool item::stacks_with( const item &rhs, bool check_components, bool skip_type_c
     if( techniques != rhs.techniques ) {
         return false;
     }
-    if( item_vars != rhs.item_vars ) {
+    if( vars != rhs.vars ) {
         return false;
     }
     if( goes_bad() && rhs.goes_bad() ) {
@@ -1067,10 +1078,10 @@ namespace
 
 time_duration weighted_averaged_rot( const item *a, const item *b )
 {
-    const int base_charges = a->charges + b->charges;
+    const int base_charges = a->charges() + b->charges();
 
     return base_charges > 0
-           ? ( a->get_rot() * a->charges + b->get_rot() * b->charges ) / base_charges
+           ? ( a->get_rot() * a->charges() + b->get_rot() * b->charges() ) / base_charges
            : 0_seconds;
 }
 
@@ -1092,16 +1103,16 @@ bool item::merge_charges( detached_ptr<item> &&rhs, bool force )
     const auto new_rot = weighted_averaged_rot( this, &obj );
 
     // Prevent overflow when either item has "near infinite" charges.
-    if( charges >= INFINITE_CHARGES / 2 || obj.charges >= INFINITE_CHARGES / 2 ) {
-        charges = INFINITE_CHARGES;
+    if( charges_ >= INFINITE_CHARGES / 2 || obj.charges() >= INFINITE_CHARGES / 2 ) {
+        set_charges( INFINITE_CHARGES );
         return true;
     }
     // We'll just hope that the item counter represents the same thing for both items
     if( item_counter > 0 || obj.item_counter > 0 ) {
-        item_counter = ( static_cast<double>( item_counter ) * charges + static_cast<double>
-                         ( obj.item_counter ) * obj.charges ) / ( charges + obj.charges );
+        item_counter = ( static_cast<double>( item_counter ) * charges_ + static_cast<double>
+                         ( obj.item_counter ) * obj.charges() ) / ( charges_ + obj.charges() );
     }
-    charges += obj.charges;
+    set_charges( charges_ + obj.charges() );
 
     rot = new_rot;
     set_age( std::max( age(), obj.age() ) );
@@ -1121,57 +1132,70 @@ void item::put_in( detached_ptr<item> &&payload )
     contents.insert_item( std::move( payload ) );
 }
 
+void item::on_var_changed( const std::string &name )
+{
+    // Only these override what weight() and volume() compute
+    if( name == "weight" || name == "integral_weight" || name == "volume" ) {
+        invalidate_mass_cache();
+    }
+}
+
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    vars.set( name, item_var_value( static_cast<long long>( value ) ) );
+    on_var_changed( name );
 }
 
 void item::set_var( const std::string &name, const long long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    vars.set( name, item_var_value( value ) );
+    on_var_changed( name );
 }
 
 // NOLINTNEXTLINE(cata-no-long)
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    vars.set( name, item_var_value( static_cast<long long>( value ) ) );
+    on_var_changed( name );
 }
 
 void item::set_var( const std::string &name, const double value )
 {
-    item_vars[name] = string_format( "%f", value );
+    vars.set( name, item_var_value( value ) );
+    on_var_changed( name );
 }
 
 double item::get_var( const std::string &name, const double default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    const item_var_value *value = vars.find( name );
+    if( value == nullptr ) {
         return default_value;
     }
-    return atof( it->second.c_str() );
+    return value->to_double();
+}
+
+double item::get_var( const item_var_id &name, const double default_value ) const
+{
+    const item_var_value *value = vars.find( name );
+    if( value == nullptr ) {
+        return default_value;
+    }
+    return value->to_double();
 }
 
 void item::set_var( const std::string &name, const tripoint &value )
 {
-    item_vars[name] = string_format( "%d,%d,%d", value.x, value.y, value.z );
+    vars.set( name, item_var_value( string_format( "%d,%d,%d", value.x, value.y, value.z ) ) );
+    on_var_changed( name );
 }
 
 tripoint item::get_var( const std::string &name, const tripoint &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    const item_var_value *value = vars.find( name );
+    if( value == nullptr ) {
         return default_value;
     }
-    std::vector<std::string> values = string_split( it->second, ',' );
+    std::vector<std::string> values = string_split( value->str(), ',' );
     return tripoint( atoi( values[0].c_str() ),
                      atoi( values[1].c_str() ),
                      atoi( values[2].c_str() ) );
@@ -1179,16 +1203,17 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
 
 void item::set_var( const std::string &name, const std::string &value )
 {
-    item_vars[name] = value;
+    vars.set( name, item_var_value( value ) );
+    on_var_changed( name );
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    const item_var_value *value = vars.find( name );
+    if( value == nullptr ) {
         return default_value;
     }
-    return it->second;
+    return value->str();
 }
 
 std::string item::get_var( const std::string &name ) const
@@ -1198,17 +1223,19 @@ std::string item::get_var( const std::string &name ) const
 
 bool item::has_var( const std::string &name ) const
 {
-    return item_vars.count( name ) > 0;
+    return vars.find( name ) != nullptr;
 }
 
 void item::erase_var( const std::string &name )
 {
-    item_vars.erase( name );
+    vars.erase( name );
+    on_var_changed( name );
 }
 
 void item::clear_vars()
 {
-    item_vars.clear();
+    vars.clear();
+    invalidate_mass_cache();
 }
 
 // TODO: Get rid of, handle multiple types gracefully
@@ -1646,14 +1673,13 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
 
     if( parts->test( iteminfo_parts::DESCRIPTION ) ) {
         insert_separation_line( info );
-        const std::map<std::string, std::string>::const_iterator idescription =
-            item_vars.find( "description" );
+        const item_var_value *idescription = vars.find( "description" );
         const std::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
             info.emplace_back( "DESCRIPTION", snippet.value().translated() );
-        } else if( idescription != item_vars.end() ) {
-            info.emplace_back( "DESCRIPTION", idescription->second );
+        } else if( idescription != nullptr ) {
+            info.emplace_back( "DESCRIPTION", idescription->str() );
         } else {
             if( is_craft() ) {
                 const std::string desc = _( "This is an in progress %s.  "
@@ -1666,24 +1692,23 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
                 info.emplace_back( "DESCRIPTION", type->description.translated() );
             }
         }
-        std::map<std::string, std::string>::const_iterator item_note = item_vars.find( "item_note" );
-        std::map<std::string, std::string>::const_iterator item_note_tool =
-            item_vars.find( "item_note_tool" );
+        const item_var_value *item_note = vars.find( "item_note" );
+        const item_var_value *item_note_tool = vars.find( "item_note_tool" );
 
-        if( item_note != item_vars.end() && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
+        if( item_note != nullptr && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
             std::string ntext;
             const inscribe_actor *use_actor = nullptr;
-            if( item_note_tool != item_vars.end() ) {
-                const use_function *use_func = itype_id( item_note_tool->second )->get_use( "inscribe" );
+            if( item_note_tool != nullptr ) {
+                const use_function *use_func = itype_id( item_note_tool->str() )->get_use( "inscribe" );
                 use_actor = dynamic_cast<const inscribe_actor *>( use_func->get_actor_ptr() );
             }
             if( use_actor ) {
                 //~ %1$s: gerund (e.g. carved), %2$s: item name, %3$s: inscription text
                 ntext = string_format( pgettext( "carving", "<info>%1$s on the %2$s is:</info> %3$s" ),
-                                       use_actor->gerund, tname(), item_note->second );
+                                       use_actor->gerund, tname(), item_note->str() );
             } else {
                 //~ %1$s: inscription text
-                ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note->second );
+                ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note->str() );
             }
             info.emplace_back( "DESCRIPTION", ntext );
         }
@@ -1738,7 +1763,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
     if( count_by_charges() && !is_food() && !is_medication() &&
         parts->test( iteminfo_parts::BASE_AMOUNT ) ) {
         info.emplace_back( "BASE", _( "Amount: " ), "<num>", iteminfo::no_flags,
-                           charges * batch );
+                           charges_ * batch );
     }
     if( debug && parts->test( iteminfo_parts::BASE_DEBUG ) ) {
         if( g != nullptr ) {
@@ -1747,7 +1772,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
             info.emplace_back( "BASE", _( "age (hours): " ), "", iteminfo::lower_is_better,
                                to_hours<int>( age() ) );
             info.emplace_back( "BASE", _( "charges: " ), "", iteminfo::lower_is_better,
-                               charges );
+                               charges_ );
             info.emplace_back( "BASE", _( "damage: " ), "", iteminfo::lower_is_better,
                                damage_ );
             info.emplace_back( "BASE", _( "active: " ), "", iteminfo::lower_is_better,
@@ -1763,10 +1788,10 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
             const std::string tags_listed = enumerate_as_string( item_tags, f, enumeration_conjunction::none );
             info.emplace_back( "BASE", string_format( _( "tags: %s" ), tags_listed ) );
 
-            for( auto const &imap : item_vars ) {
+            for( const item_vars::entry &var : vars ) {
                 info.emplace_back( "BASE",
-                                   string_format( _( "item var: %s, %s" ), imap.first,
-                                                  imap.second ) );
+                                   string_format( _( "item var: %s, %s" ), var.id.str(),
+                                                  var.value.str() ) );
             }
 
             const item *food = get_food();
@@ -1809,7 +1834,7 @@ void item::med_info( const item *med_item, std::vector<iteminfo> &info, const it
 
     if( parts->test( iteminfo_parts::MED_PORTIONS ) ) {
         info.emplace_back( "MED", _( "Portions: " ),
-                           std::abs( static_cast<int>( med_item->charges ) * batch ) );
+                           std::abs( static_cast<int>( med_item->charges() ) * batch ) );
     }
 
     if( med_com->addict && parts->test( iteminfo_parts::DESCRIPTION_MED_ADDICTING ) ) {
@@ -1868,7 +1893,7 @@ void item::food_info( const item *food_item, std::vector<iteminfo> &info,
 
     if( parts->test( iteminfo_parts::FOOD_PORTIONS ) ) {
         info.emplace_back( "FOOD", _( "Portions: " ),
-                           std::abs( static_cast<int>( food_item->charges ) * batch ) );
+                           std::abs( static_cast<int>( food_item->charges() ) * batch ) );
     }
     if( food_item->corpse != nullptr && parts->test( iteminfo_parts::FOOD_SMELL ) &&
         ( debug || ( g != nullptr && ( you.has_trait( trait_CARNIVORE ) ||
@@ -3869,7 +3894,7 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query &parts_
                 info.emplace_back( "DESCRIPTION",
                                    string_format( _( "* Fermenting this will produce "
                                                      "<neutral>%s</neutral>." ),
-                                                  nname( res, brewed.charges ) ) );
+                                                  nname( res, brewed.charges() ) ) );
             }
         }
     }
@@ -4589,7 +4614,7 @@ void item::on_damage( int qty, damage_type )
 
 std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int truncate ) const
 {
-    int dirt_level = get_var( "dirt", 0 ) / 2000;
+    int dirt_level = get_var( var_dirt, 0 ) / 2000;
     std::string dirt_symbol;
     // TODO: MATERIALS put this in json
 
@@ -4623,10 +4648,10 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
     // for portions of string that have <color_ etc in them, this aims to truncate the whole string correctly
     unsigned int truncate_override = 0;
 
-    if( ( damage() != 0 || ( get_option<bool>( "ITEM_HEALTH_BAR" ) && is_armor() ) ) && !is_null() &&
+    if( ( damage() != 0 || ( get_option( option::ITEM_HEALTH_BAR ) && is_armor() ) ) && !is_null() &&
         with_prefix ) {
         damtext = durability_indicator();
-        if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+        if( get_option( option::ITEM_HEALTH_BAR ) ) {
             // get the utf8 width of the tags
             truncate_override = utf8_width( damtext, false ) - utf8_width( damtext, true );
         }
@@ -4660,12 +4685,12 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
     }
 
     std::string maintext;
-    if( is_corpse() || typeId() == itype_blood || item_vars.find( "name" ) != item_vars.end() ) {
+    if( is_corpse() || typeId() == itype_blood || vars.find( var_name ) != nullptr ) {
         maintext = type_name( quantity );
     } else if( is_craft() ) {
         maintext = string_format( _( "in progress %s" ), craft_data_->making->result_name() );
-        if( charges > 1 ) {
-            maintext += string_format( " (%d)", charges );
+        if( charges_ > 1 ) {
+            maintext += string_format( " (%d)", charges_ );
         }
         const int percent_progress = item_counter / 100000;
         maintext += string_format( " (%d%%)", percent_progress );
@@ -4696,8 +4721,8 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
             const item &contents_item = contents.front();
             const unsigned contents_count =
                 ( ( contents_item.made_of( LIQUID ) || contents_item.is_food() ) &&
-                  contents_item.charges > 1 )
-                ? contents_item.charges
+                  contents_item.charges() > 1 )
+                ? contents_item.charges()
                 : quantity;
             maintext = string_format( pgettext( "item name", "%2$s (%1$s)" ), labeltext,
                                       contents_item.tname( contents_count, with_prefix ) );
@@ -4845,7 +4870,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
         ret = utf8_truncate( ret, truncate + truncate_override );
     }
 
-    if( item_vars.find( "item_note" ) != item_vars.end() ) {
+    if( vars.find( var_item_note ) != nullptr ) {
         //~ %s is an item name. This style is used to denote items with notes.
         return string_format( _( "*%s*" ), ret );
     } else {
@@ -4900,7 +4925,7 @@ std::string item::display_name( unsigned int quantity ) const
     bool show_amt = false;
     // We should handle infinite charges properly in all cases.
     if( contains ) {
-        amount = contents.front().charges;
+        amount = contents.front().charges();
         max_amount = contents.front().charges_per_volume( get_container_capacity() );
     } else if( is_book() && get_chapters() > 0 ) {
         // a book which has remaining unread chapters
@@ -4913,7 +4938,7 @@ std::string item::display_name( unsigned int quantity ) const
         show_amt = !has_flag( flag_RELOAD_AND_SHOOT );
     } else if( count_by_charges() && !has_infinite_charges() ) {
         // A chargeable item
-        amount = charges;
+        amount = charges_;
         max_amount = ammo_capacity();
     } else if( is_battery() ) {
         show_amt = true;
@@ -4998,11 +5023,11 @@ int item::price( bool practical ) const
 
         if( e->count_by_charges() || e->made_of( LIQUID ) ) {
             // price from json data is for default-sized stack
-            child *= e->charges / static_cast<double>( e->type->stack_size );
+            child *= e->charges() / static_cast<double>( e->type->stack_size );
 
         } else if( e->magazine_integral() && e->ammo_remaining() && e->ammo_data() ) {
             // items with integral magazines may contain ammunition which can affect the price
-            child += item( e->ammo_data(), calendar::turn, e->charges ).price( practical );
+            child += item( e->ammo_data(), calendar::turn, e->charges() ).price( practical );
 
         } else if( e->is_tool() && e->ammo_types().empty() && e->ammo_capacity() ) {
             // if tool has no ammo (e.g. spray can) reduce price proportional to remaining charges
@@ -5016,8 +5041,19 @@ int item::price( bool practical ) const
     return res;
 }
 
-// TODO: MATERIALS add a density field to materials.json
 units::mass item::weight( bool include_contents, bool integral ) const
+{
+    if( !include_contents || integral ) {
+        return calc_weight( include_contents, integral );
+    }
+    if( !cached_weight ) {
+        cached_weight = calc_weight( include_contents, integral );
+    }
+    return *cached_weight;
+}
+
+// TODO: MATERIALS add a density field to materials.json
+units::mass item::calc_weight( bool include_contents, bool integral ) const
 {
     if( is_null() ) {
         return 0_gram;
@@ -5056,7 +5092,7 @@ units::mass item::weight( bool include_contents, bool integral ) const
     }
 
     if( count_by_charges() ) {
-        ret *= charges;
+        ret *= charges_;
 
     } else if( is_corpse() ) {
         assert( corpse ); // To appease static analysis
@@ -5088,7 +5124,7 @@ units::mass item::weight( bool include_contents, bool integral ) const
         const auto &linkage = type->magazine->linkage;
         if( linkage ) {
             item links( *linkage );
-            links.charges = ammo_remaining();
+            links.set_charges( ammo_remaining() );
             ret += links.weight();
         }
     }
@@ -5167,6 +5203,17 @@ units::volume item::base_volume() const
 }
 
 units::volume item::volume( bool integral ) const
+{
+    if( integral ) {
+        return calc_volume( integral );
+    }
+    if( !cached_volume ) {
+        cached_volume = calc_volume( integral );
+    }
+    return *cached_volume;
+}
+
+units::volume item::calc_volume( bool integral ) const
 {
     if( is_null() ) {
         return 0_ml;
@@ -5196,7 +5243,7 @@ units::volume item::volume( bool integral ) const
 
     if( count_by_charges() || made_of( LIQUID ) ) {
         units::quantity<int64_t, units::volume_in_milliliter_tag> num = ret * static_cast<int64_t>
-                ( charges );
+                ( charges_ );
         if( type->stack_size <= 0 ) {
             debugmsg( "Item type %s has invalid stack_size %d", typeId().str(), type->stack_size );
             ret = num;
@@ -5362,6 +5409,7 @@ bool item::can_shatter() const
 void item::unset_flags()
 {
     item_tags.clear();
+    invalidate_caches();
 }
 
 bool item::has_fault( const fault_id &fault ) const
@@ -5376,35 +5424,56 @@ bool item::has_own_flag( const flag_id &f ) const
 
 bool item::has_flag( const flag_id &f ) const
 {
-    // Check if we have any gun/toolmods with the flag, and if we do
-    // check if that flag should be inherited.
-    // `json_flag::get` is pretty expensive so it's faster to do it
-    // last as frequently there are no gun/toolmods with the flag f
-    auto mods = is_gun() ? gunmods() : toolmods();
-
-    const auto flag_in_mods = [&f]( const auto & mods ) -> bool {
-        return std::any_of( mods.begin(), mods.end(), [&f]( const item * e )-> bool {
-            return ( !e->is_gun() && e->has_flag( f ) );
-        } );
-    };
+    const int index = json_flag::index( f );
+    if( index < 0 ) {
+        // Not a loaded flag, so it can't be inherited either
+        return type->has_flag( f ) || has_own_flag( f );
+    }
+    return get_cached_flags().test( index );
+}
 
-    if( f->inherit() && flag_in_mods( mods ) ) {
-        return true;
+const flag_bitset &item::get_cached_flags() const
+{
+    if( cached_flags_valid ) {
+        return cached_flags;
+    }
+    cached_flags = type->get_flag_bits();
+    for( const flag_id &f : item_tags ) {
+        cached_flags.set( f );
+    }
+    // Gun/toolmods contribute the flags that are inherited
+    for( const item *mod : is_gun() ? gunmods() : toolmods() ) {
+        if( !mod->is_gun() ) {
+            flag_bitset inherited = mod->get_cached_flags();
+            inherited &= json_flag::inherited_flags();
+            cached_flags |= inherited;
+        }
     }
+    cached_flags_valid = true;
+    return cached_flags;
+}
 
-    // other item type flags
-    if( type->has_flag( f ) ) {
-        return true;
+void item::invalidate_caches()
+{
+    for( item *it = this; it != nullptr; it = it->parent_item() ) {
+        it->cached_flags_valid = false;
     }
+    invalidate_mass_cache();
+}
 
-    // now check for item specific flags
-    return has_own_flag( f );
+void item::invalidate_mass_cache()
+{
+    for( item *it = this; it != nullptr; it = it->parent_item() ) {
+        it->cached_weight.reset();
+        it->cached_volume.reset();
+    }
 }
 
 void item::set_flag( const flag_id &flag )
 {
     if( flag.is_valid() ) {
         item_tags.insert( flag );
+        invalidate_caches();
     } else {
         debugmsg( "Attempted to set invalid flag_id %s", flag.str() );
     }
@@ -5413,6 +5482,7 @@ void item::set_flag( const flag_id &flag )
 void item::unset_flag( const flag_id &flag )
 {
     item_tags.erase( flag );
+    invalidate_caches();
 }
 
 void item::set_flag_recursive( const flag_id &flag )
@@ -6146,7 +6216,7 @@ bool item::count_by_charges() const
 
 int item::count() const
 {
-    return count_by_charges() ? charges : 1;
+    return count_by_charges() ? charges_ : 1;
 }
 
 bool item::craft_has_charges()
@@ -6364,8 +6434,8 @@ bool item::mod_damage( int qty, damage_type dt )
     bool destroy = false;
 
     if( count_by_charges() ) {
-        charges -= std::min( type->stack_size * qty / itype::damage_scale, charges );
-        destroy |= charges == 0;
+        set_charges( charges_ - std::min( type->stack_size * qty / itype::damage_scale, charges_ ) );
+        destroy |= charges_ == 0;
     }
 
     if( qty > 0 ) {
@@ -6454,7 +6524,7 @@ std::string item::durability_indicator( bool include_intact ) const
     std::string outputstring;
 
     if( damage() < 0 )  {
-        if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+        if( get_option( option::ITEM_HEALTH_BAR ) ) {
             outputstring = colorize( damage_symbol() + "\u00A0", damage_color() );
         } else if( is_gun() ) {
             outputstring = pgettext( "damage adjective", "accurized " );
@@ -6478,7 +6548,7 @@ std::string item::durability_indicator( bool include_intact ) const
                     break;
             }
         }
-    } else if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+    } else if( get_option( option::ITEM_HEALTH_BAR ) ) {
         outputstring = colorize( damage_symbol() + "\u00A0", damage_color() );
     } else {
         outputstring = string_format( "%s ", get_base_material().dmg_adj( damage_level( 4 ) ) );
@@ -6794,6 +6864,7 @@ void item::set_mtype( const mtype *const m )
         return;
     }
     corpse = m;
+    invalidate_caches();
 }
 
 bool item::is_ammo_container() const
@@ -7309,9 +7380,9 @@ bool item::operator<( const item &other ) const
 
         if( me_type->get_id() == rhs_type->get_id() ) {
             if( me->is_money() ) {
-                return me->charges > rhs->charges;
+                return me->charges() > rhs->charges();
             }
-            return me->charges < rhs->charges;
+            return me->charges() < rhs->charges();
         } else {
             std::string n1 = me_type->nname( 1 );
             std::string n2 = rhs_type->nname( 1 );
@@ -7521,13 +7592,13 @@ int item::ammo_remaining() const
             int power = units::to_kilojoule( get_avatar().get_power_level() );
             return power;
         }
-        return charges;
+        return charges_;
     }
 
     if( is_magazine() || is_bandolier() ) {
         int res = 0;
         for( const item *e : contents.all_items_top() ) {
-            res += e->charges;
+            res += e->charges();
         }
         return res;
     }
@@ -7630,12 +7701,12 @@ int item::ammo_consume( int qty, const tripoint &pos )
         int need = qty;
         while( !contents.empty() ) {
             item &e = contents.front();
-            if( need >= e.charges ) {
-                need -= e.charges;
+            if( need >= e.charges() ) {
+                need -= e.charges();
                 remove_item( contents.front() );
                 e.destroy();
             } else {
-                e.charges -= need;
+                e.set_charges( e.charges() - need );
                 need = 0;
                 break;
             }
@@ -7643,14 +7714,14 @@ int item::ammo_consume( int qty, const tripoint &pos )
         return qty - need;
 
     } else if( is_tool() || is_gun() ) {
-        qty = std::min( qty, charges );
+        qty = std::min( qty, charges_ );
         if( has_flag( flag_USES_BIONIC_POWER ) ) {
             avatar &you = get_avatar();
-            charges = units::to_kilojoule( you.get_power_level() );
+            set_charges( units::to_kilojoule( you.get_power_level() ) );
             you.mod_power_level( units::from_kilojoule( -qty ) );
         }
-        charges -= qty;
-        if( charges == 0 ) {
+        set_charges( charges_ - qty );
+        if( charges_ == 0 ) {
             curammo = nullptr;
         }
         return qty;
@@ -8146,7 +8217,7 @@ item *item::get_usable_item( const std::string &use_name )
 int item::units_remaining( const Character &ch, int limit ) const
 {
     if( count_by_charges() ) {
-        return std::min( static_cast<int>( charges ), limit );
+        return std::min( static_cast<int>( charges_ ), limit );
     }
 
     int res = ammo_remaining();
@@ -8234,7 +8305,7 @@ void item_reload_option::qty( int val )
     }
 
     bool ammo_by_charges = ammo_obj.is_ammo() || ammo_in_liquid_container;
-    int available_ammo = ammo_by_charges ? ammo_obj.charges : ammo_obj.ammo_remaining();
+    int available_ammo = ammo_by_charges ? ammo_obj.charges() : ammo_obj.ammo_remaining();
     // constrain by available ammo, target capacity and other external factors (max_qty)
     // @ref max_qty is currently set when reloading ammo belts and limits to available linkages
     qty_ = std::min( { val, available_ammo, remaining_capacity, max_qty } );
@@ -8273,6 +8344,7 @@ bool item::reload( player &u, item &loc, int qty )
         return false;
     }
     item *ammo = &loc;
+    invalidate_caches();
     if( ammo->is_null() ) {
         debugmsg( "Tried to reload using non-existent ammo" );
         return false;
@@ -8304,7 +8376,7 @@ bool item::reload( player &u, item &loc, int qty )
     } );
 
     if( is_magazine() ) {
-        qty = std::min( qty, ammo->charges );
+        qty = std::min( qty, ammo->charges() );
 
         if( is_ammo_belt() ) {
             const auto &linkage = type->magazine->linkage;
@@ -8357,24 +8429,24 @@ bool item::reload( player &u, item &loc, int qty )
             curammo = ammo->contents.front().type;
             qty = std::min( qty, ammo->ammo_remaining() );
             ammo->ammo_consume( qty, tripoint_zero );
-            charges += qty;
+            set_charges( charges_ + qty );
         } else if( ammo->ammo_type() == ammo_plutonium ) {
             curammo = ammo->type;
-            ammo->charges -= qty;
+            ammo->set_charges( ammo->charges() - qty );
 
             // any excess is wasted rather than overfilling the item
-            charges += qty * PLUTONIUM_CHARGES;
-            charges = std::min( charges, ammo_capacity() );
+            set_charges( charges_ + qty * PLUTONIUM_CHARGES );
+            set_charges( std::min( charges_, ammo_capacity() ) );
         } else {
             curammo = ammo->type;
-            qty = std::min( qty, ammo->charges );
-            ammo->charges -= qty;
-            charges += qty;
+            qty = std::min( qty, ammo->charges() );
+            ammo->set_charges( ammo->charges() - qty );
+            set_charges( charges_ + qty );
         }
         // we have transfered ammo from the container to the item
         // therefore, we erase the 0-charge item inside container
         // TODO: why don't we just remove 0-charge items?
-        if( ammo->charges == 0 && !ammo->has_flag( flag_SPEEDLOADER ) ) {
+        if( ammo->charges() == 0 && !ammo->has_flag( flag_SPEEDLOADER ) ) {
             ammo->detach();
             if( container != nullptr ) {
                 u.inv_restack();
@@ -8448,13 +8520,13 @@ bool item::burn( fire_data &frd )
 
     if( count_by_charges() ) {
         if( type->volume == 0_ml ) {
-            charges = 0;
+            set_charges( 0 );
         } else {
-            charges -= roll_remainder( burn_added * units::legacy_volume_factor * type->stack_size /
-                                       ( 3.0 * type->volume ) );
+            set_charges( charges_ - roll_remainder( burn_added * units::legacy_volume_factor *
+                                                   type->stack_size / ( 3.0 * type->volume ) ) );
         }
 
-        return charges <= 0;
+        return charges_ <= 0;
     }
 
     if( is_corpse() ) {
@@ -8462,6 +8534,7 @@ bool item::burn( fire_data &frd )
         if( active && mt != nullptr && burnt + burn_added > mt->hp &&
             !mt->burn_into.is_null() && mt->burn_into.is_valid() ) {
             corpse = &get_mtype()->burn_into.obj();
+            invalidate_caches();
             // Delay rezing
             set_age( 0_turns );
             burnt = 0;
@@ -8615,7 +8688,7 @@ int item::get_remaining_capacity_for_liquid( const item &liquid, bool allow_buck
         }
         remaining_capacity = liquid.charges_per_volume( get_container_capacity() );
         if( !contents.empty() ) {
-            remaining_capacity -= contents.front().charges;
+            remaining_capacity -= contents.front().charges();
         }
     } else {
         return error( string_format( _( "That %1$s won't hold %2$s." ), tname(),
@@ -8715,7 +8788,7 @@ detached_ptr<item> item::fill_with( detached_ptr<item> &&liquid, int amount )
         amount = INT_MAX;
     }
     amount = std::min( get_remaining_capacity_for_liquid( *liquid, true ),
-                       std::min( amount, liquid->charges ) );
+                       std::min( amount, liquid->charges() ) );
     if( amount <= 0 ) {
         return std::move( liquid );
     }
@@ -8738,13 +8811,13 @@ detached_ptr<item> item::fill_with( detached_ptr<item> &&liquid, int amount )
         cts.mod_charges( amount );
     } else {
         detached_ptr<item> liquid_copy = item::spawn( *liquid );
-        liquid_copy->charges = amount;
+        liquid_copy->set_charges( amount );
         put_in( std::move( liquid_copy ) );
     }
 
     liquid->mod_charges( -amount );
     on_contents_changed();
-    if( liquid->charges > 0 ) {
+    if( liquid->charges() > 0 ) {
         return std::move( liquid );
     }
     return detached_ptr<item>();
@@ -8760,7 +8833,7 @@ void item::set_countdown( int num_turns )
         debugmsg( "Tried to set countdown on an item with ammo." );
         return;
     }
-    charges = num_turns;
+    set_charges( num_turns );
 }
 
 detached_ptr<item> item::use_charges( detached_ptr<item> &&self, const itype_id &what, int &qty,
@@ -8787,14 +8860,14 @@ detached_ptr<item> item::use_charges( detached_ptr<item> &&self, const itype_id
             }
         } else if( e->count_by_charges() ) {
             if( e->typeId() == what ) {
-                if( e->charges > qty ) {
-                    e->charges -= qty;
+                if( e->charges() > qty ) {
+                    e->set_charges( e->charges() - qty );
                     detached_ptr<item> split = item::spawn( *e );
-                    split->charges = qty;
+                    split->set_charges( qty );
                     used.push_back( std::move( split ) );
                     qty = 0;
                 } else {
-                    qty -= e->charges;
+                    qty -= e->charges();
                     used.push_back( std::move( e ) );
                     return detached_ptr<item>();
                 }
@@ -8910,7 +8983,7 @@ detached_ptr<item> item::detonate( detached_ptr<item> &&self, const tripoint &p,
         return detached_ptr<item>();
     } else if( self->type->ammo && ( self->type->ammo->special_cookoff ||
                                      self->type->ammo->cookoff ) ) {
-        int charges_remaining = self->charges;
+        int charges_remaining = self->charges();
         const int rounds_exploded = rng( 1, charges_remaining );
         // Yank the exploding item off the map for the duration of the explosion
         // so it doesn't blow itself up.
@@ -8923,7 +8996,7 @@ detached_ptr<item> item::detonate( detached_ptr<item> &&self, const tripoint &p,
         charges_remaining -= rounds_exploded;
         if( charges_remaining > 0 ) {
             detached_ptr<item> temp_item = item::spawn( *self );
-            temp_item->charges = charges_remaining;
+            temp_item->set_charges( charges_remaining );
             drops.push_back( std::move( temp_item ) );
         }
 
@@ -8990,7 +9063,7 @@ bool item_ptr_compare_by_charges( const item *left, const item *right )
     } else if( right->contents.empty() ) {
         return true;
     } else {
-        return right->contents.front().charges < left->contents.front().charges;
+        return right->contents.front().charges() < left->contents.front().charges();
     }
 }
 
@@ -9002,26 +9075,27 @@ bool item_compare_by_charges( const item &left, const item &right )
 static const std::string USED_BY_IDS( "USED_BY_IDS" );
 bool item::already_used_by_player( const player &p ) const
 {
-    const auto it = item_vars.find( USED_BY_IDS );
-    if( it == item_vars.end() ) {
+    const item_var_value *it = vars.find( USED_BY_IDS );
+    if( it == nullptr ) {
         return false;
     }
     // USED_BY_IDS always starts *and* ends with a ';', the search string
     // ';<id>;' matches at most one part of USED_BY_IDS, and only when exactly that
     // id has been added.
     const std::string needle = string_format( ";%d;", p.getID().get_value() );
-    return it->second.find( needle ) != std::string::npos;
+    return it->str().find( needle ) != std::string::npos;
 }
 
 void item::mark_as_used_by_player( const player &p )
 {
-    std::string &used_by_ids = item_vars[ USED_BY_IDS ];
+    std::string used_by_ids = get_var( USED_BY_IDS );
     if( used_by_ids.empty() ) {
         // *always* start with a ';'
         used_by_ids = ";";
     }
     // and always end with a ';'
     used_by_ids += string_format( "%d;", p.getID().get_value() );
+    set_var( USED_BY_IDS, used_by_ids );
 }
 
 bool item::can_holster( const item &obj, bool ignore ) const
@@ -9279,6 +9353,7 @@ detached_ptr<item> item::process_corpse( detached_ptr<item> &&self, player *carr
     if( self->corpse->zombify_into && self->rotten() && !self->has_flag( flag_PULPED ) ) {
         self->rot -= self->get_shelf_life();
         self->corpse = &*self->corpse->zombify_into;
+        self->invalidate_caches();
         return std::move( self );
     }
     if( !self->ready_to_revive( pos ) ) {
@@ -9583,9 +9658,9 @@ detached_ptr<item> item::process_cable( detached_ptr<item> &&self, player *carri
 
     int distance = rl_dist( pos, *source );
     int max_charges = self->type->maximum_charges();
-    self->charges = max_charges - distance;
+    self->set_charges( max_charges - distance );
 
-    if( self->charges < 1 ) {
+    if( self->charges() < 1 ) {
         if( carrier->has_item( *self ) ) {
             carrier->add_msg_if_player( m_bad, _( "The over-extended cable breaks loose!" ) );
         }
@@ -9605,11 +9680,11 @@ void item::reset_cable( player *p )
     erase_var( "source_y" );
     erase_var( "source_z" );
     active = false;
-    charges = max_charges;
+    set_charges( max_charges );
 
     if( p != nullptr ) {
         p->add_msg_if_player( m_info, _( "You reel in the cable." ) );
-        p->moves -= charges * 10;
+        p->moves -= charges_ * 10;
     }
 }
 
@@ -9937,6 +10012,14 @@ detached_ptr<item> item::process_internal( detached_ptr<item> &&self, player *ca
     return std::move( self );
 }
 
+void item::set_charges( const int value )
+{
+    if( charges_ != value ) {
+        charges_ = value;
+        invalidate_mass_cache();
+    }
+}
+
 void item::mod_charges( int mod )
 {
     if( has_infinite_charges() ) {
@@ -9945,13 +10028,14 @@ void item::mod_charges( int mod )
 
     if( !count_by_charges() ) {
         debugmsg( "Tried to remove %s by charges, but item is not counted by charges.", tname() );
-    } else if( mod < 0 && charges + mod < 0 ) {
+    } else if( mod < 0 && charges_ + mod < 0 ) {
         debugmsg( "Tried to remove charges that do not exist, removing maximum available charges instead." );
-        charges = 0;
-    } else if( mod > 0 && charges >= INFINITE_CHARGES - mod ) {
-        charges = INFINITE_CHARGES - 1; // Highly unlikely, but finite charges should not become infinite.
+        set_charges( 0 );
+    } else if( mod > 0 && charges_ >= INFINITE_CHARGES - mod ) {
+        // Highly unlikely, but finite charges should not become infinite.
+        set_charges( INFINITE_CHARGES - 1 );
     } else {
-        charges += mod;
+        set_charges( charges_ + mod );
     }
 }
 
@@ -10074,7 +10158,7 @@ bool item::is_reloadable() const
 
 std::string item::type_name( unsigned int quantity ) const
 {
-    const auto iter = item_vars.find( "name" );
+    const item_var_value *iter = vars.find( "name" );
     std::string ret_name;
     if( typeId() == itype_blood ) {
         if( corpse == nullptr || corpse->id.is_null() ) {
@@ -10084,8 +10168,8 @@ std::string item::type_name( unsigned int quantity ) const
                                              "%s blood",  quantity ),
                                   corpse->nname() );
         }
-    } else if( iter != item_vars.end() ) {
-        return iter->second;
+    } else if( iter != nullptr ) {
+        return iter->str();
     } else {
         ret_name = type->nname( quantity );
     }
@@ -10189,7 +10273,7 @@ std::string item::label( unsigned int quantity ) const
 
 bool item::has_infinite_charges() const
 {
-    return charges == INFINITE_CHARGES;
+    return charges_ == INFINITE_CHARGES;
 }
 
 skill_id item::contextualize_skill( const skill_id &id ) const
@@ -10459,6 +10543,7 @@ item *item::parent_item() const
 
 std::vector<detached_ptr<item>> item::remove_components()
 {
+    invalidate_caches();
     return components.clear();
 }
 
@@ -10468,6 +10553,7 @@ detached_ptr<item> item::remove_component( item &it )
         if( *iter == &it ) {
             detached_ptr<item> ret;
             components.erase( iter, &ret );
+            invalidate_caches();
             return ret;
         }
     }
@@ -10478,6 +10564,7 @@ detached_ptr<item> item::remove_component( item &it )
 void item::add_component( detached_ptr<item> &&comp )
 {
     components.push_back( std::move( comp ) );
+    invalidate_caches();
 }
 
 const location_vector<item> &item::get_components() const
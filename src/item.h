@@ -18,11 +18,13 @@
 #include "cata_arena.h"
 #include "detached_ptr.h"
 #include "enums.h"
+#include "flag_bitset.h"
 #include "flat_set.h"
 #include "game_object.h"
 #include "gun_mode.h"
 #include "io_tags.h"
 #include "item_contents.h"
+#include "item_vars.h"
 #include "location_vector.h"
 #include "pimpl.h"
 #include "safe_reference.h"
@@ -833,6 +835,11 @@ class item : public location_visitable<item>, public game_object<item>
          * @param mod How many charges should be removed.
          */
         void mod_charges( int mod );
+        int charges() const {
+            return charges_;
+        }
+        /** Sets @ref charges, dropping the cached weight and volume if they change. */
+        void set_charges( int value );
         /**
          * Whether the item has to be removed as it has rotten away completely. May change the item as it calls process_rot()
          * @param pnt The position of the item on the current map.
@@ -1450,7 +1457,8 @@ class item : public location_visitable<item>, public game_object<item>
          * Each item variable is referred to by its name, so make sure you use a name that is not
          * already used somewhere.
          * You can directly store integer, floating point and string values. Data of other types
-         * must be converted to one of those to be stored.
+         * must be converted to one of those to be stored. Numbers are stored as numbers, so
+         * reading them back is cheap.
          * The set_var functions override the existing value.
          * The get_var function return the value (if the variable exists), or the default value
          * otherwise.  The type of the default value determines which get_var function is used.
@@ -1471,6 +1479,8 @@ class item : public location_visitable<item>, public game_object<item>
         void set_var( const std::string &name, long value );
         void set_var( const std::string &name, double value );
         double get_var( const std::string &name, double default_value ) const;
+        /** Same as above without looking up the name, for hot paths. */
+        double get_var( const item_var_id &name, double default_value ) const;
         void set_var( const std::string &name, const tripoint &value );
         tripoint get_var( const std::string &name, const tripoint &default_value ) const;
         void set_var( const std::string &name, const std::string &value );
@@ -1529,6 +1539,14 @@ class item : public location_visitable<item>, public game_object<item>
 
         /** Removes all item specific flags. */
         void unset_flags();
+
+        /**
+         * Drops the flags cached by @ref has_flag and the weight and volume cached by
+         * @ref weight and @ref volume for this item and the items containing it.
+         * Called whenever the type, the item specific flags or the contents change.
+         * Changes of charges go through @ref set_charges instead.
+         */
+        void invalidate_caches();
         /*@}*/
 
         /**Does this item have the specified fault*/
@@ -2262,7 +2280,7 @@ class item : public location_visitable<item>, public game_object<item>
         detached_ptr<item> unsafe_split( int qty = 0 );
 
         /**
-         * Used with unsafe_split to handle the 0 charge items that can be created by it. It does nothing if old.charges isn't 0.
+         * Used with unsafe_split to handle the 0 charge items that can be created by it. It does nothing if old.charges() isn't 0.
          * The typical flow of calls is to use unsafe_split. Then use functions like pour_into etc. Then use merge_charges to merge any remaining charges back into the old item.
          * Then finally use this function to handle the case that no charges are remaining.
          */
@@ -2329,11 +2347,25 @@ class item : public location_visitable<item>, public game_object<item>
     private:
         location_vector<item> components;
         const itype *curammo = nullptr;
-        std::map<std::string, std::string> item_vars;
+        item_vars vars;
         const mtype *corpse = nullptr;
         std::string corpse_name;       // Name of the late lamented
         std::set<matec_id> techniques; // item specific techniques
 
+        // Flags of the type, the item and the inherited flags of its mods, see has_flag
+        mutable flag_bitset cached_flags;
+        mutable bool cached_flags_valid = false;
+        const flag_bitset &get_cached_flags() const;
+
+        // weight() and volume() with the default arguments
+        mutable std::optional<units::mass> cached_weight;
+        mutable std::optional<units::volume> cached_volume;
+        /** Drops the cached weight and volume of this item and the items containing it. */
+        void invalidate_mass_cache();
+        void on_var_changed( const std::string &name );
+        units::mass calc_weight( bool include_contents, bool integral ) const;
+        units::volume calc_volume( bool integral ) const;
+
         /**
          * Data for items that represent in-progress crafts.
          */
@@ -2356,8 +2388,9 @@ class item : public location_visitable<item>, public game_object<item>
 
         // any relic data specific to this item
         cata::value_ptr<relic> relic_data;
+        // Written through set_charges, so the cached weight and volume stay valid
+        int charges_;
     public:
-        int charges;
         units::energy energy;      // Amount of energy currently stored in a battery
 
         int recipe_charges = 1;    // The number of charges a recipe creates.
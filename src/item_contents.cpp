@@ -14,12 +14,12 @@
 
 struct tripoint;
 
-item_contents::item_contents( item *container ) : items( new contents_item_location(
-                container ) ) {}
+item_contents::item_contents( item *container ) : container( container ),
+    items( new contents_item_location( container ) ) {}
 /** used to aid migration */
 item_contents::item_contents( item *container,
-                              std::vector<detached_ptr<item>> &items ) : items( new contents_item_location( container ),
-                                          items ) {}
+                              std::vector<detached_ptr<item>> &items ) : container( container ),
+    items( new contents_item_location( container ), items ) {}
 
 item_contents::~item_contents() = default;
 
@@ -45,6 +45,7 @@ ret_val<bool> item_contents::insert_item( detached_ptr<item> &&it )
         // NOLINTNEXTLINE(bugprone-use-after-move)
         items.push_back( std::move( it ) );
     }
+    on_changed();
 
     return ret_val<bool>::make_success();
 }
@@ -59,6 +60,7 @@ bool item_contents::spill_contents( const tripoint &pos )
     for( detached_ptr<item> &it : items.clear() ) {
         get_map().add_item_or_charges( pos, std::move( it ) );
     }
+    on_changed();
     return true;
 }
 
@@ -75,6 +77,7 @@ void item_contents::handle_liquid_or_spill( Character &guy )
             guy.i_add_or_drop( std::move( det ) );
         }
     }
+    on_changed();
 }
 
 void item_contents::casings_handle( const std::function < detached_ptr<item>
@@ -91,11 +94,14 @@ void item_contents::casings_handle( const std::function < detached_ptr<item>
         }
         return std::move( it );
     } );
+    on_changed();
 }
 
 std::vector<detached_ptr<item>> item_contents::clear_items()
 {
-    return items.clear();
+    std::vector<detached_ptr<item>> ret = items.clear();
+    on_changed();
+    return ret;
 }
 
 void item_contents::on_destroy()
@@ -113,7 +119,7 @@ void item_contents::set_item_defaults()
                 contained_item->ammo_default(), contained_item->ammo_capacity() / 2
             );
         } else { //Contents are batteries or food
-            contained_item->charges = contained_item->typeId()->charges_default();
+            contained_item->set_charges( contained_item->typeId()->charges_default() );
         }
     }
 }
@@ -138,7 +144,7 @@ bool item_contents::stacks_with( const item_contents &rhs ) const
 {
     return std::equal( items.begin(), items.end(), rhs.items.begin(), []( const item * const & a,
     const item * const & b ) {
-        return a->charges == b->charges && a->stacks_with( *b );
+        return a->charges() == b->charges() && a->stacks_with( *b );
     } );
 }
 
@@ -166,13 +172,16 @@ detached_ptr<item> item_contents::remove_top( item *it )
     } );
     detached_ptr<item> ret;
     items.erase( iter, &ret );
+    on_changed();
     return ret;
 }
 
 location_vector<item>::iterator item_contents::remove_top( location_vector<item>::iterator &it,
         detached_ptr<item> *removed )
 {
-    return items.erase( it, removed );
+    location_vector<item>::iterator ret = items.erase( it, removed );
+    on_changed();
+    return ret;
 }
 
 std::vector<item *> item_contents::all_items_ptr()
@@ -276,3 +285,8 @@ void item_contents::remove_top_items_with( const std::function < detached_ptr<it
         return VisitResponse::SKIP;
     } );
 }
+
+void item_contents::on_changed()
+{
+    container->invalidate_caches();
+}
@@ -113,6 +113,10 @@ class item_contents
 
         void on_destroy();
     private:
+        /** Lets the container know its contents changed, see @ref item::invalidate_caches. */
+        void on_changed();
+
+        item *container;
         location_vector<item> items;
 };
 
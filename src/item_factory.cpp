@@ -632,6 +632,7 @@ void Item_factory::finalize_post( itype &obj )
         }
         return false;
     } );
+    obj.finalize_flag_bits();
 
     // handle complex firearms as a special case
     if( obj.gun && !obj.has_flag( flag_PRIMITIVE_RANGED_WEAPON ) ) {
@@ -2896,7 +2897,7 @@ void Item_factory::migrate_item( const itype_id &id, item &obj )
             obj.set_flag( flag_id( f ) );
         }
         if( iter->second.charges > 0 ) {
-            obj.charges = iter->second.charges;
+            obj.set_charges( iter->second.charges );
         }
 
         obj.contents.migrate_item( obj, iter->second.contents );
@@ -2905,7 +2906,7 @@ void Item_factory::migrate_item( const itype_id &id, item &obj )
         if( obj.is_container() && !obj.contents.empty() ) {
             item &child = obj.contents.back();
             const int capacity = child.charges_per_volume( obj.get_container_capacity() );
-            child.charges = std::min( child.charges, capacity );
+            child.set_charges( std::min( child.charges(), capacity ) );
         }
     }
 }
@@ -301,7 +301,7 @@ detached_ptr<item> Item_modifier::modify( detached_ptr<item> &&new_item ) const
         ch = charges_min == charges_max ? charges_min : rng( charges_min,
                 charges_max );
     } else if( cont != nullptr && !cont->is_null() && new_item->made_of( LIQUID ) ) {
-        new_item->charges = std::max( 1, max_capacity );
+        new_item->set_charges( std::max( 1, max_capacity ) );
     }
 
     if( ch != -1 ) {
@@ -309,15 +309,15 @@ detached_ptr<item> Item_modifier::modify( detached_ptr<item> &&new_item ) const
             // food, ammo
             // count_by_charges requires that charges is at least 1. It makes no sense to
             // spawn a "water (0)" item.
-            new_item->charges = std::max( 1, ch );
+            new_item->set_charges( std::max( 1, ch ) );
         } else if( new_item->is_tool() ) {
             const int qty = std::min( ch, new_item->ammo_capacity() );
-            new_item->charges = qty;
+            new_item->set_charges( qty );
             if( !new_item->ammo_types().empty() && qty > 0 ) {
                 new_item->ammo_set( new_item->ammo_default(), qty );
             }
         } else if( new_item->type->can_have_charges() ) {
-            new_item->charges = ch;
+            new_item->set_charges( ch );
         }
     }
 
@@ -333,9 +333,9 @@ detached_ptr<item> Item_modifier::modify( detached_ptr<item> &&new_item ) const
         }
         // Make sure the item is in valid state
         if( new_item->ammo_data() && new_item->magazine_integral() ) {
-            new_item->charges = std::min( new_item->charges, new_item->ammo_capacity() );
+            new_item->set_charges( std::min( new_item->charges(), new_item->ammo_capacity() ) );
         } else {
-            new_item->charges = 0;
+            new_item->set_charges( 0 );
         }
     }
 
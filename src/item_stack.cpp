@@ -98,7 +98,7 @@ int item_stack::amount_can_fit( const item &it ) const
     }
     // Call max because a tile may have been overfilled to begin with (e.g. #14115)
     const int ret = std::max( 0, it.charges_per_volume( free_volume() ) );
-    return it.count_by_charges() ? std::min( ret, it.charges ) : ret;
+    return it.count_by_charges() ? std::min( ret, it.charges() ) : ret;
 }
 
 item *item_stack::stacks_with( const item &it )
@@ -64,7 +64,7 @@ class item_stack
          * could be added without violating either the volume or itemcount limits.
          *
          * @returns Value of zero or greater for all items. For items counted by charges, it is always at
-         * most it.charges.
+         * most it.charges().
          */
         int amount_can_fit( const item &it ) const;
         /** Return the item (or nullptr) that stacks with the argument */
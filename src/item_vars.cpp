@@ -0,0 +1,241 @@
+#include "item_vars.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "json.h"
+
+namespace
+{
+
+struct item_var_names {
+    std::unordered_map<std::string, std::uint32_t> ids;
+    std::vector<std::string> names;
+};
+
+item_var_names &get_item_var_names()
+{
+    static item_var_names table;
+    return table;
+}
+
+// Doesn't intern @p name, variables that were never set can't be found anyway
+bool find_item_var_id( const std::string &name, std::uint32_t &id )
+{
+    const item_var_names &table = get_item_var_names();
+    const auto iter = table.ids.find( name );
+    if( iter == table.ids.end() ) {
+        return false;
+    }
+    id = iter->second;
+    return true;
+}
+
+std::string integer_to_string( long long value )
+{
+    std::ostringstream tmpstream;
+    tmpstream.imbue( std::locale::classic() );
+    tmpstream << value;
+    return tmpstream.str();
+}
+
+// Shortest text that strtod reads back as exactly @p value
+std::string number_to_string( double value )
+{
+    std::string result;
+    for( int precision = std::numeric_limits<double>::digits10;
+         precision <= std::numeric_limits<double>::max_digits10; precision++ ) {
+        std::ostringstream tmpstream;
+        tmpstream.imbue( std::locale::classic() );
+        tmpstream << std::setprecision( precision ) << value;
+        result = tmpstream.str();
+        if( std::strtod( result.c_str(), nullptr ) == value ) {
+            break;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+item_var_id::item_var_id( const std::string &name )
+{
+    item_var_names &table = get_item_var_names();
+    const auto iter = table.ids.find( name );
+    if( iter != table.ids.end() ) {
+        id = iter->second;
+        return;
+    }
+    id = static_cast<std::uint32_t>( table.names.size() );
+    table.ids.emplace( name, id );
+    table.names.push_back( name );
+}
+
+const std::string &item_var_id::str() const
+{
+    return get_item_var_names().names[id];
+}
+
+item_var_value::item_var_value( long long value ) : type( kind::integer ), integer( value ) {}
+
+item_var_value::item_var_value( double value ) : type( kind::number ), number( value ) {}
+
+item_var_value::item_var_value( std::string value ) : type( kind::text ), text( std::move( value ) ) {}
+
+item_var_value item_var_value::from_string( const std::string &text )
+{
+    if( text.empty() ) {
+        return item_var_value( text );
+    }
+    const char *begin = text.c_str();
+    char *end = nullptr;
+    errno = 0;
+    const long long integer = std::strtoll( begin, &end, 10 );
+    if( errno == 0 && end == begin + text.size() ) {
+        item_var_value result( integer );
+        // Only if it's written back the same, "+1" or "007" have to stay what they are
+        if( result.str() == text ) {
+            return result;
+        }
+    }
+    const double number = std::strtod( begin, &end );
+    if( end == begin + text.size() ) {
+        item_var_value result( number );
+        if( result.str() == text ) {
+            return result;
+        }
+    }
+    return item_var_value( text );
+}
+
+std::string item_var_value::str() const
+{
+    switch( type ) {
+        case kind::integer:
+            return integer_to_string( integer );
+        case kind::number:
+            return number_to_string( number );
+        case kind::text:
+            break;
+    }
+    return text;
+}
+
+double item_var_value::to_double() const
+{
+    switch( type ) {
+        case kind::integer:
+            return static_cast<double>( integer );
+        case kind::number:
+            return number;
+        case kind::text:
+            break;
+    }
+    return std::atof( text.c_str() );
+}
+
+bool item_var_value::operator==( const item_var_value &rhs ) const
+{
+    if( type == kind::integer && rhs.type == kind::integer ) {
+        return integer == rhs.integer;
+    }
+    if( type == kind::text && rhs.type == kind::text ) {
+        return text == rhs.text;
+    }
+    // Values were compared as strings before they were typed, keep numbers that are
+    // written the same equal
+    return str() == rhs.str();
+}
+
+static bool entry_less( const item_vars::entry &e, std::uint32_t id )
+{
+    return e.id.to_i() < id;
+}
+
+const item_var_value *item_vars::find( const std::string &name ) const
+{
+    std::uint32_t id = 0;
+    if( !find_item_var_id( name, id ) ) {
+        return nullptr;
+    }
+    return find( id );
+}
+
+const item_var_value *item_vars::find( const item_var_id &id ) const
+{
+    return find( id.to_i() );
+}
+
+const item_var_value *item_vars::find( const std::uint32_t id ) const
+{
+    const auto iter = std::lower_bound( entries.begin(), entries.end(), id, entry_less );
+    if( iter == entries.end() || iter->id.to_i() != id ) {
+        return nullptr;
+    }
+    return &iter->value;
+}
+
+void item_vars::set( const std::string &name, item_var_value value )
+{
+    const item_var_id id( name );
+    const auto iter = std::lower_bound( entries.begin(), entries.end(), id.to_i(), entry_less );
+    if( iter != entries.end() && iter->id == id ) {
+        iter->value = std::move( value );
+    } else {
+        entries.insert( iter, entry{ id, std::move( value ) } );
+    }
+}
+
+void item_vars::erase( const std::string &name )
+{
+    std::uint32_t id = 0;
+    if( !find_item_var_id( name, id ) ) {
+        return;
+    }
+    const auto iter = std::lower_bound( entries.begin(), entries.end(), id, entry_less );
+    if( iter != entries.end() && iter->id.to_i() == id ) {
+        entries.erase( iter );
+    }
+}
+
+void item_vars::erase_if( const std::function<bool( const std::string & )> &pred )
+{
+    entries.erase( std::remove_if( entries.begin(), entries.end(), [&pred]( const entry & e ) {
+        return pred( e.id.str() );
+    } ), entries.end() );
+}
+
+bool item_vars::operator==( const item_vars &rhs ) const
+{
+    return entries.size() == rhs.entries.size() &&
+           std::equal( entries.begin(), entries.end(), rhs.entries.begin(),
+    []( const entry & lhs, const entry & rhs ) {
+        return lhs.id == rhs.id && lhs.value == rhs.value;
+    } );
+}
+
+void item_vars::serialize( JsonOut &json ) const
+{
+    std::map<std::string, std::string> sorted;
+    for( const entry &e : entries ) {
+        sorted.emplace( e.id.str(), e.value.str() );
+    }
+    json.write( sorted );
+}
+
+void item_vars::deserialize( JsonIn &jsin )
+{
+    entries.clear();
+    JsonObject data = jsin.get_object();
+    for( const JsonMember member : data ) {
+        set( member.name(), item_var_value::from_string( member.get_string() ) );
+    }
+}
@@ -0,0 +1,135 @@
+#pragma once
+#ifndef CATA_SRC_ITEM_VARS_H
+#define CATA_SRC_ITEM_VARS_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class JsonIn;
+class JsonOut;
+
+/**
+ * Interned name of an item variable.
+ * There are many items but only a few distinct variable names, so each name is
+ * stored once and items refer to it by index.
+ */
+class item_var_id
+{
+    public:
+        explicit item_var_id( const std::string &name );
+
+        const std::string &str() const;
+        std::uint32_t to_i() const {
+            return id;
+        }
+
+        bool operator==( const item_var_id &rhs ) const {
+            return id == rhs.id;
+        }
+        bool operator!=( const item_var_id &rhs ) const {
+            return id != rhs.id;
+        }
+
+    private:
+        friend class item_vars;
+        item_var_id() = default;
+
+        std::uint32_t id = 0;
+};
+
+/**
+ * Value of an item variable. Numbers are stored as numbers, so reading them back doesn't
+ * parse a string every time. @ref str gives the same text integers were saved as before
+ * values were typed, floating point numbers are written with as many digits as they need
+ * to be read back exactly.
+ */
+class item_var_value
+{
+    public:
+        item_var_value() = default;
+        explicit item_var_value( long long value );
+        explicit item_var_value( double value );
+        explicit item_var_value( std::string value );
+
+        /**
+         * Value as saved in @p text. Integers and numbers written by @ref str become numbers
+         * again, anything else stays text.
+         */
+        static item_var_value from_string( const std::string &text );
+
+        std::string str() const;
+        /** Numeric value, text is parsed like atof did. */
+        double to_double() const;
+
+        bool operator==( const item_var_value &rhs ) const;
+        bool operator!=( const item_var_value &rhs ) const {
+            return !( *this == rhs );
+        }
+
+    private:
+        enum class kind : std::uint8_t {
+            integer,
+            number,
+            text,
+        };
+        kind type = kind::text;
+        union {
+            long long integer;
+            double number = 0;
+        };
+        std::string text;
+};
+
+/**
+ * Variables of an item, see @ref item::set_var.
+ * Items usually have none or a few, so they're kept in a vector sorted by id.
+ */
+class item_vars
+{
+    public:
+        struct entry {
+            item_var_id id;
+            item_var_value value;
+        };
+
+        bool empty() const {
+            return entries.empty();
+        }
+        void clear() {
+            entries.clear();
+        }
+
+        /** The value of variable @p name, or nullptr if it isn't set. */
+        const item_var_value *find( const std::string &name ) const;
+        /** Same as above without looking up the name, for hot callers with a static id. */
+        const item_var_value *find( const item_var_id &id ) const;
+        void set( const std::string &name, item_var_value value );
+        void erase( const std::string &name );
+        /** Erases the variables whose name matches @p pred. */
+        void erase_if( const std::function<bool( const std::string & )> &pred );
+
+        std::vector<entry>::const_iterator begin() const {
+            return entries.begin();
+        }
+        std::vector<entry>::const_iterator end() const {
+            return entries.end();
+        }
+
+        bool operator==( const item_vars &rhs ) const;
+        bool operator!=( const item_vars &rhs ) const {
+            return !( *this == rhs );
+        }
+
+        /** Written as an object of strings, ordered by name, like the std::map it replaced. */
+        void serialize( JsonOut &json ) const;
+        void deserialize( JsonIn &jsin );
+
+    private:
+        const item_var_value *find( std::uint32_t id ) const;
+
+        std::vector<entry> entries;
+};
+
+#endif // CATA_SRC_ITEM_VARS_H
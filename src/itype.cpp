@@ -3,6 +3,7 @@
 #include <cstdlib>
 
 #include "debug.h"
+#include "flag.h"
 #include "item.h"
 #include "make_static.h"
 #include "player.h"
@@ -146,7 +147,16 @@ bool itype::has_use() const
 
 bool itype::has_flag( const flag_id &flag ) const
 {
-    return item_tags.count( flag );
+    if( !flag_bits_ready ) {
+        // Still being finalized by Item_factory
+        return item_tags.count( flag );
+    }
+    const int index = json_flag::index( flag );
+    if( index < 0 ) {
+        // Not a loaded json flag, so it has no bit
+        return item_tags.count( flag );
+    }
+    return flag_bits.test( index );
 }
 
 const itype::FlagsSetType &itype::get_flags() const
@@ -154,6 +164,20 @@ const itype::FlagsSetType &itype::get_flags() const
     return item_tags;
 }
 
+const flag_bitset &itype::get_flag_bits() const
+{
+    return flag_bits;
+}
+
+void itype::finalize_flag_bits()
+{
+    flag_bits.clear();
+    for( const flag_id &f : item_tags ) {
+        flag_bits.set( f );
+    }
+    flag_bits_ready = true;
+}
+
 bool itype::can_use( const std::string &iuse_name ) const
 {
     return get_use( iuse_name ) != nullptr;
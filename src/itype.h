@@ -19,6 +19,7 @@
 #include "damage.h"
 #include "enums.h" // point
 #include "explosion.h"
+#include "flag_bitset.h"
 #include "game_constants.h"
 #include "iuse.h" // use_function
 #include "mapdata.h"
@@ -874,6 +875,10 @@ struct itype {
         int damage_max_ = +4000;
         /// @}
 
+        /** @ref item_tags as a bitset, see @ref finalize_flag_bits. */
+        flag_bitset flag_bits;
+        bool flag_bits_ready = false;
+
     protected:
         itype_id id = itype_id::NULL_ID(); /** unique string identifier for this type */
 
@@ -1062,6 +1067,10 @@ struct itype {
 
         // returns read-only set of all item tags/flags
         const FlagsSetType &get_flags() const;
+        /** Same as @ref get_flags, one bit per @ref json_flag::index. */
+        const flag_bitset &get_flag_bits() const;
+        /** Rebuilds @ref get_flag_bits from the final @ref item_tags, called by Item_factory. */
+        void finalize_flag_bits();
 
         bool can_use( const std::string &iuse_name ) const;
         const use_function *get_use( const std::string &iuse_name ) const;
@@ -643,7 +643,7 @@ int iuse::eyedrops( player *p, item *it, bool, const tripoint & )
         p->add_msg_if_player( m_info, _( "You can't do that while underwater." ) );
         return 0;
     }
-    if( it->charges < it->type->charges_to_use() ) {
+    if( it->charges() < it->type->charges_to_use() ) {
         p->add_msg_if_player( _( "You're out of %s." ), it->tname() );
         return 0;
     }
@@ -1786,8 +1786,8 @@ int iuse::fish_trap( player *p, item *it, bool t, const tripoint &pos )
             return 0;
         }
 
-        if( it->charges < 0 ) {
-            it->charges = 0;
+        if( it->charges() < 0 ) {
+            it->set_charges( 0 );
             return 0;
         }
         if( p->is_mounted() ) {
@@ -1799,7 +1799,7 @@ int iuse::fish_trap( player *p, item *it, bool t, const tripoint &pos )
             return 0;
         }
 
-        if( it->charges == 0 ) {
+        if( it->charges() == 0 ) {
             p->add_msg_if_player( _( "Fish are not foolish enough to go in here without bait." ) );
             return 0;
         }
@@ -1827,7 +1827,7 @@ int iuse::fish_trap( player *p, item *it, bool t, const tripoint &pos )
 
     } else {
         // Handle processing fish trap over time.
-        if( it->charges == 0 ) {
+        if( it->charges() == 0 ) {
             it->active = false;
             return 0;
         }
@@ -1840,15 +1840,15 @@ int iuse::fish_trap( player *p, item *it, bool t, const tripoint &pos )
 
             int success = -50;
             const int surv = p->get_skill_level( skill_survival );
-            const int attempts = rng( it->charges, it->charges * it->charges );
+            const int attempts = rng( it->charges(), it->charges() * it->charges() );
             for( int i = 0; i < attempts; i++ ) {
                 /** @EFFECT_SURVIVAL randomly increases number of fish caught in fishing trap */
                 success += rng( surv, surv * surv );
             }
 
-            it->charges = rng( -1, it->charges );
-            if( it->charges < 0 ) {
-                it->charges = 0;
+            it->set_charges( rng( -1, it->charges() ) );
+            if( it->charges() < 0 ) {
+                it->set_charges( 0 );
             }
 
             int fishes = 0;
@@ -1864,7 +1864,7 @@ int iuse::fish_trap( player *p, item *it, bool t, const tripoint &pos )
             }
 
             if( fishes == 0 ) {
-                it->charges = 0;
+                it->set_charges( 0 );
                 p->practice( skill_survival, rng( 5, 15 ) );
 
                 return 0;
@@ -2061,7 +2061,7 @@ int iuse::water_purifier( player *p, item *it, bool, const tripoint & )
     }
 
     item &liquid = obj->contents.front();
-    const auto used_charges = std::max( liquid.charges / purification_efficiency, 1 );
+    const auto used_charges = std::max( liquid.charges() / purification_efficiency, 1 );
     if( !it->units_sufficient( *p, used_charges ) ) {
         p->add_msg_if_player( m_info, _( "That volume of water is too large to purify." ) );
         return 0;
@@ -3455,8 +3455,8 @@ int iuse::can_goo( player *p, item *it, bool, const tripoint & )
             g->m.trap_set( goop, tr_goo );
         }
     }
-    if( it->charges <= it->type->charges_to_use() ) {
-        it->charges = 0;
+    if( it->charges() <= it->type->charges_to_use() ) {
+        it->set_charges( 0 );
         it->convert( itype_canister_empty );
         return 0;
     }
@@ -3478,7 +3478,7 @@ int iuse::throwable_extinguisher_act( player *, item *it, bool, const tripoint &
                 g->m.mod_field_intensity( dest, fd_fire, 0 - rng( 0, 2 ) );
             }
         }
-        it->charges = -1;
+        it->set_charges( -1 );
         return 1;
     }
     it->active = false;
@@ -3489,7 +3489,7 @@ int iuse::granade( player *p, item *it, bool, const tripoint & )
 {
     p->add_msg_if_player( _( "You pull the pin on the Granade." ) );
     it->convert( itype_granade_act );
-    it->charges = 5;
+    it->set_charges( 5 );
     it->active = true;
     return it->type->charges_to_use();
 }
@@ -3503,7 +3503,7 @@ int iuse::granade_act( player *p, item *it, bool t, const tripoint &pos )
         // Vol 0 = only heard if you hold it
         sounds::sound( pos, 0, sounds::sound_t::electronic_speech, _( "Merged!" ),
                        true, "speech", it->typeId().str() );
-    } else if( it->charges > 0 ) {
+    } else if( it->charges() > 0 ) {
         p->add_msg_if_player( m_info, _( "You've already pulled the %s's pin, try throwing it instead." ),
                               it->tname() );
         return 0;
@@ -3649,7 +3649,7 @@ int iuse::c4( player *p, item *it, bool, const tripoint & )
     }
     p->add_msg_if_player( _( "You set the timer to %d." ), time );
     it->convert( itype_c4armed );
-    it->charges = time;
+    it->set_charges( time );
     it->active = true;
     return it->type->charges_to_use();
 }
@@ -3657,7 +3657,7 @@ int iuse::c4( player *p, item *it, bool, const tripoint & )
 int iuse::acidbomb_act( player *p, item *it, bool, const tripoint &pos )
 {
     if( !p->has_item( *it ) ) {
-        it->charges = -1;
+        it->set_charges( -1 );
         for( const tripoint &tmp : g->m.points_in_radius( pos.x == -999 ? p->pos() : pos, 1 ) ) {
             g->m.add_field( tmp, fd_acid, 3 );
         }
@@ -3675,7 +3675,7 @@ int iuse::grenade_inc_act( player *p, item *it, bool t, const tripoint &pos )
     if( t ) { // Simple timer effects
         // Vol 0 = only heard if you hold it
         sounds::sound( pos, 0, sounds::sound_t::alarm, _( "Tick!" ), true, "misc", "bomb_ticking" );
-    } else if( it->charges > 0 ) {
+    } else if( it->charges() > 0 ) {
         p->add_msg_if_player( m_info, _( "You've already released the handle, try throwing it instead." ) );
         return 0;
     } else {  // blow up
@@ -3713,13 +3713,13 @@ int iuse::arrow_flammable( player *p, item *it, bool, const tripoint & )
     }
     p->add_msg_if_player( _( "You light the arrow!" ) );
     p->moves -= to_moves<int>( 1_seconds );
-    if( it->charges == 1 ) {
+    if( it->charges() == 1 ) {
         it->convert( itype_arrow_flamming );
         return 0;
     }
     detached_ptr<item> lit_arrow = item::spawn( *it );
     lit_arrow->convert( itype_arrow_flamming );
-    lit_arrow->charges = 1;
+    lit_arrow->set_charges( 1 );
     p->i_add( std::move( lit_arrow ) );
     return 1;
 }
@@ -3739,12 +3739,12 @@ int iuse::molotov_lit( player *p, item *it, bool t, const tripoint &pos )
             p->add_msg_if_player( m_good, _( "Fire…  Good…" ) );
         }
         return 1;
-    } else if( it->charges > 0 ) {
+    } else if( it->charges() > 0 ) {
         p->add_msg_if_player( m_info, _( "You've already lit the %s, try throwing it instead." ),
                               it->tname() );
         return 0;
-    } else if( p->has_item( *it ) && it->charges == 0 ) {
-        it->charges += 1;
+    } else if( p->has_item( *it ) && it->charges() == 0 ) {
+        it->set_charges( it->charges() + 1 );
         if( one_in( 5 ) ) {
             p->add_msg_if_player( _( "Your lit Molotov goes out." ) );
             it->convert( itype_molotov );
@@ -3767,7 +3767,7 @@ int iuse::firecracker_pack( player *p, item *it, bool, const tripoint & )
     }
     p->add_msg_if_player( _( "You light the pack of firecrackers." ) );
     it->convert( itype_firecracker_pack_act );
-    it->charges = 26;
+    it->set_charges( 26 );
     it->set_age( 0_turns );
     it->active = true;
     return 0; // don't use any charges at all. it has became a new item
@@ -3779,19 +3779,19 @@ int iuse::firecracker_pack_act( player *, item *it, bool, const tripoint &pos )
     if( timer < 2_turns ) {
         sounds::sound( pos, 0, sounds::sound_t::alarm, _( "ssss…" ), true, "misc", "lit_fuse" );
         it->inc_damage();
-    } else if( it->charges > 0 ) {
+    } else if( it->charges() > 0 ) {
         int ex = rng( 4, 6 );
         int i = 0;
-        if( ex > it->charges ) {
-            ex = it->charges;
+        if( ex > it->charges() ) {
+            ex = it->charges();
         }
         for( i = 0; i < ex; i++ ) {
             sounds::sound( pos, 20, sounds::sound_t::combat, _( "Bang!" ), false, "explosion", "small" );
         }
-        it->charges -= ex;
+        it->set_charges( it->charges() - ex );
     }
-    if( it->charges == 0 ) {
-        it->charges = -1;
+    if( it->charges() == 0 ) {
+        it->set_charges( -1 );
     }
     return 0;
 }
@@ -3808,7 +3808,7 @@ int iuse::firecracker( player *p, item *it, bool, const tripoint & )
     }
     p->add_msg_if_player( _( "You light the firecracker." ) );
     it->convert( itype_firecracker_act );
-    it->charges = 2;
+    it->set_charges( 2 );
     it->active = true;
     return it->type->charges_to_use();
 }
@@ -3820,7 +3820,7 @@ int iuse::firecracker_act( player *p, item *it, bool t, const tripoint &pos )
     }
     if( t ) { // Simple timer effects
         sounds::sound( pos, 0,  sounds::sound_t::alarm, _( "ssss…" ), true, "misc", "lit_fuse" );
-    } else if( it->charges > 0 ) {
+    } else if( it->charges() > 0 ) {
         p->add_msg_if_player( m_info, _( "You've already lit the %s, try throwing it instead." ),
                               it->tname() );
         return 0;
@@ -3842,7 +3842,7 @@ int iuse::mininuke( player *p, item *it, bool, const tripoint & )
                           to_string( time_duration::from_turns( time ) ) );
     g->events().send<event_type::activates_mininuke>( p->getID() );
     it->convert( itype_mininuke_act );
-    it->charges = time;
+    it->set_charges( time );
     it->active = true;
     return it->type->charges_to_use();
 }
@@ -3981,7 +3981,7 @@ int iuse::tazer2( player *p, item *it, bool b, const tripoint &pos )
         // Instead of having a ctrl+c+v of the function above, spawn a fake tazer and use it
         // Ugly, but less so than copied blocks
         item *fake = item::spawn_temporary( "tazer", calendar::start_of_cataclysm );
-        fake->charges = 100;
+        fake->set_charges( 100 );
         return tazer( p, fake, b, pos );
     } else {
         p->add_msg_if_player( m_info, _( "Insufficient power" ) );
@@ -4143,7 +4143,7 @@ int iuse::dive_tank( player *p, item *it, bool t, const tripoint & )
             if( one_in( 15 ) ) {
                 p->add_msg_if_player( m_bad, _( "You take a deep breath from your %s." ), it->tname() );
             }
-            if( it->charges == 0 ) {
+            if( it->charges() == 0 ) {
                 p->add_msg_if_player( m_bad, _( "Air in your %s runs out." ), it->tname() );
                 it->set_var( "overwrite_env_resist", 0 );
                 it->convert( itype_id( it->typeId().str().substr( 0,
@@ -4158,7 +4158,7 @@ int iuse::dive_tank( player *p, item *it, bool t, const tripoint & )
         }
 
     } else { // Turning it on/off
-        if( it->charges == 0 ) {
+        if( it->charges() == 0 ) {
             p->add_msg_if_player( _( "Your %s is empty." ), it->tname() );
         } else if( it->active ) { //off
             p->add_msg_if_player( _( "You turn off the regulator and close the air valve." ) );
@@ -4177,7 +4177,7 @@ int iuse::dive_tank( player *p, item *it, bool t, const tripoint & )
             }
         }
     }
-    if( it->charges == 0 ) {
+    if( it->charges() == 0 ) {
         it->set_var( "overwrite_env_resist", 0 );
         it->convert( itype_id( it->typeId().str().substr( 0,
                                it->typeId().str().size() - 3 ) ) );
@@ -4246,7 +4246,7 @@ int iuse::gasmask( player *p, item *it, bool t, const tripoint &pos )
                 it->ammo_consume( 1, p->pos() );
                 it->set_var( "gas_absorbed", 0 );
             }
-            if( it->charges == 0 ) {
+            if( it->charges() == 0 ) {
                 p->add_msg_player_or_npc(
                     m_bad,
                     _( "Your %s requires new filter!" ),
@@ -4255,7 +4255,7 @@ int iuse::gasmask( player *p, item *it, bool t, const tripoint &pos )
             }
         }
     } else { // activate
-        if( it->charges == 0 ) {
+        if( it->charges() == 0 ) {
             p->add_msg_if_player( _( "Your %s don't have a filter." ), it->tname() );
         } else {
             p->add_msg_if_player( _( "You prepared your %s." ), it->tname() );
@@ -4263,7 +4263,7 @@ int iuse::gasmask( player *p, item *it, bool t, const tripoint &pos )
             it->set_var( "overwrite_env_resist", it->get_base_env_resist_w_filter() );
         }
     }
-    if( it->charges == 0 ) {
+    if( it->charges() == 0 ) {
         it->set_var( "overwrite_env_resist", 0 );
         it->active = false;
     }
@@ -7593,7 +7593,7 @@ int iuse::ehandcuffs( player *p, item *it, bool t, const tripoint &pos )
             return it->type->charges_to_use();
         }
 
-        if( it->charges == 0 ) {
+        if( it->charges() == 0 ) {
 
             sounds::sound( pos, 2, sounds::sound_t::combat, "Click.", true, "tools", "handcuffs" );
             it->unset_flag( flag_NO_UNWIELD );
@@ -7648,9 +7648,9 @@ int iuse::ehandcuffs( player *p, item *it, bool t, const tripoint &pos )
                 add_msg( m_bad, _( "The %s spark with electricity!" ), it->tname() );
             }
 
-            it->charges -= 50;
-            if( it->charges < 1 ) {
-                it->charges = 1;
+            it->set_charges( it->charges() - 50 );
+            if( it->charges() < 1 ) {
+                it->set_charges( 1 );
             }
 
             it->set_var( "HANDCUFFS_X", pos.x );
@@ -7989,7 +7989,7 @@ static bool hackveh( player &p, item &it, vehicle &veh )
     if( effort == 0 && !query_yn( _( "Try to hack this car's security system?" ) ) ) {
         // Scanning for security systems isn't free
         p.moves -= to_moves<int>( 1_seconds );
-        it.charges -= 1;
+        it.set_charges( it.charges() - 1 );
         return false;
     }
 
@@ -8008,7 +8008,7 @@ static bool hackveh( player &p, item &it, vehicle &veh )
     }
 
     p.moves -= to_moves<int>( time_duration::from_seconds( effort ) );
-    it.charges -= effort;
+    it.set_charges( it.charges() - effort );
     if( success && advanced ) { // Unlock controls, but only if they're drive-by-wire
         veh.is_locked = false;
     }
@@ -8317,7 +8317,7 @@ int iuse::multicooker( player *p, item *it, bool t, const tripoint &pos )
         if( mc_take == choice ) {
 
             detached_ptr<item> dish = it->remove_item( *dish_it );
-            const std::string dish_name = dish->tname( dish->charges, false );
+            const std::string dish_name = dish->tname( dish->charges(), false );
             if( dish->made_of( LIQUID ) ) {
                 if( !p->check_eligible_containers_for_crafting( *recipe_id( it->get_var( "RECIPE" ) ), 1 ) ) {
                     p->add_msg_if_player( m_info, _( "You don't have a suitable container to store your %s." ),
@@ -9507,12 +9507,12 @@ int iuse::toggle_heats_food( player *p, item *it, bool, const tripoint & )
 {
     static const flag_id json_flag_HEATS_FOOD( flag_HEATS_FOOD );
     if( !it->has_flag( json_flag_HEATS_FOOD ) ) {
-        it->item_tags.insert( json_flag_HEATS_FOOD );
+        it->set_flag( json_flag_HEATS_FOOD );
         p->add_msg_if_player(
             _( "You will try to use %s to heat food next time you eat something that should be eaten hot." ),
             it->tname().c_str() );
     } else {
-        it->item_tags.erase( json_flag_HEATS_FOOD );
+        it->unset_flag( json_flag_HEATS_FOOD );
         p->add_msg_if_player( _( "You will no longer use %s to heat food." ), it->tname().c_str() );
     }
 
@@ -9523,12 +9523,12 @@ int iuse::toggle_ups_charging( player *p, item *it, bool, const tripoint & )
 {
     static const flag_id json_flag_USE_UPS( flag_USE_UPS );
     if( !it->has_flag( json_flag_USE_UPS ) ) {
-        it->item_tags.insert( json_flag_USE_UPS );
+        it->set_flag( json_flag_USE_UPS );
         p->add_msg_if_player(
             _( "You will recharge the %s using any available Unified Power System." ),
             it->tname().c_str() );
     } else {
-        it->item_tags.erase( json_flag_USE_UPS );
+        it->unset_flag( json_flag_USE_UPS );
         p->add_msg_if_player( _( "You will no longer recharge the %s via UPS." ), it->tname().c_str() );
     }
 
@@ -568,7 +568,7 @@ int explosion_iuse::use( player &p, item &it, bool t, const tripoint &pos ) cons
         }
         return 0;
     }
-    if( it.charges > 0 ) {
+    if( it.charges() > 0 ) {
         if( p.has_item( it ) ) {
             if( no_deactivate_msg.empty() ) {
                 p.add_msg_if_player( m_warning,
@@ -1076,14 +1076,14 @@ int place_monster_iuse::use( player &p, item &it, bool, const tripoint &pos ) co
                 continue;
             }
             // Don't load more than the default from the monster definition.
-            ammo_item.charges = std::min( available, amdef.second );
-            p.use_charges( amdef.first, ammo_item.charges );
+            ammo_item.set_charges( std::min( available, amdef.second ) );
+            p.use_charges( amdef.first, ammo_item.charges() );
             //~ First %s is the ammo item (with plural form and count included), second is the monster name
             p.add_msg_if_player( vgettext( "You load %1$d x %2$s round into the %3$s.",
-                                           "You load %1$d x %2$s rounds into the %3$s.", ammo_item.charges ),
-                                 ammo_item.charges, ammo_item.type_name( ammo_item.charges ),
+                                           "You load %1$d x %2$s rounds into the %3$s.", ammo_item.charges() ),
+                                 ammo_item.charges(), ammo_item.type_name( ammo_item.charges() ),
                                  newmon.name() );
-            amdef.second = ammo_item.charges;
+            amdef.second = ammo_item.charges();
         }
     }
     int skill_offset = 0;
@@ -2185,7 +2185,7 @@ int fireweapon_off_actor::use( player &p, item &it, bool t, const tripoint & ) c
         return 0;
     }
 
-    if( it.charges <= 0 ) {
+    if( it.charges() <= 0 ) {
         p.add_msg_if_player( _( lacks_fuel_message ) );
         return 0;
     }
@@ -2209,7 +2209,7 @@ int fireweapon_off_actor::use( player &p, item &it, bool t, const tripoint & ) c
 ret_val<bool> fireweapon_off_actor::can_use( const Character &p, const item &it, bool,
         const tripoint & ) const
 {
-    if( it.charges < it.type->charges_to_use() ) {
+    if( it.charges() < it.type->charges_to_use() ) {
         return ret_val<bool>::make_failure( _( "This tool doesn't have enough charges." ) );
     }
 
@@ -2242,7 +2242,7 @@ std::unique_ptr<iuse_actor> fireweapon_on_actor::clone() const
 int fireweapon_on_actor::use( player &p, item &it, bool t, const tripoint & ) const
 {
     bool extinguish = true;
-    if( it.charges == 0 ) {
+    if( it.charges() == 0 ) {
         p.add_msg_if_player( m_bad, _( charges_extinguish_message ) );
     } else if( p.is_underwater() ) {
         p.add_msg_if_player( m_bad, _( water_extinguish_message ) );
@@ -2288,7 +2288,7 @@ int manualnoise_actor::use( player &p, item &it, bool t, const tripoint & ) cons
     if( t ) {
         return 0;
     }
-    if( it.type->charges_to_use() != 0 && it.charges < it.type->charges_to_use() ) {
+    if( it.type->charges_to_use() != 0 && it.charges() < it.type->charges_to_use() ) {
         p.add_msg_if_player( _( no_charges_message ) );
         return 0;
     }
@@ -2306,7 +2306,7 @@ int manualnoise_actor::use( player &p, item &it, bool t, const tripoint & ) cons
 ret_val<bool> manualnoise_actor::can_use( const Character &, const item &it, bool,
         const tripoint & ) const
 {
-    if( it.charges < it.type->charges_to_use() ) {
+    if( it.charges() < it.type->charges_to_use() ) {
         return ret_val<bool>::make_failure( _( "This tool doesn't have enough charges." ) );
     }
 
@@ -2861,7 +2861,7 @@ bool bandolier_actor::is_valid_ammo_type( const itype &t ) const
 bool bandolier_actor::can_store( const item &bandolier, const item &obj ) const
 {
     if( !bandolier.contents.empty() && ( bandolier.contents.front().typeId() != obj.typeId() ||
-                                         bandolier.contents.front().charges >= capacity ) ) {
+                                         bandolier.contents.front().charges() >= capacity ) ) {
         return false;
     }
 
@@ -2902,9 +2902,9 @@ bool bandolier_actor::reload( player &p, item &obj ) const
     if( obj.contents.empty() ) {
         obj.put_in( sel.ammo->split( sel.qty() ) );
     } else {
-        obj.contents.front().charges += sel.qty();
-        if( sel.ammo->charges > sel.qty() ) {
-            sel.ammo->charges -= sel.qty();
+        obj.contents.front().set_charges( obj.contents.front().charges() + sel.qty() );
+        if( sel.ammo->charges() > sel.qty() ) {
+            sel.ammo->set_charges( sel.ammo->charges() - sel.qty() );
         } else {
             sel.ammo->detach();
         }
@@ -2930,7 +2930,7 @@ int bandolier_actor::use( player &p, item &it, bool, const tripoint & ) const
 
     std::vector<std::function<void()>> actions;
 
-    menu.addentry( -1, it.contents.empty() || it.contents.front().charges < capacity,
+    menu.addentry( -1, it.contents.empty() || it.contents.front().charges() < capacity,
                    'r', _( "Store ammo in %s" ), it.type_name() );
 
     actions.emplace_back( [&] { reload( p, it ); } );
@@ -3803,15 +3803,15 @@ int heal_actor::finish_using( player &healer, player &patient, item &it, hp_part
     if( !used_up_item_id.is_empty() ) {
         // If the item is a tool, `make` it the new form
         // Otherwise it probably was consumed, so create a new one
-        if( it.is_tool() || ( it.count_by_charges() && it.charges <= used_up_item_charges ) ) {
+        if( it.is_tool() || ( it.count_by_charges() && it.charges() <= used_up_item_charges ) ) {
             it.convert( used_up_item_id );
             copy_flags( it );
         } else {
-            if( it.count_by_charges() && it.charges > used_up_item_charges ) {
-                it.charges -= used_up_item_charges;
+            if( it.count_by_charges() && it.charges() > used_up_item_charges ) {
+                it.set_charges( it.charges() - used_up_item_charges );
             }
             item *used_up = item::spawn_temporary( used_up_item_id, it.birthday() );
-            used_up->charges = used_up_item_charges;
+            used_up->set_charges( used_up_item_charges );
             copy_flags( *used_up );
             for( int count = 0; count < used_up_item_quantity; count++ ) {
                 healer.i_add_or_drop( item::spawn( *used_up ) );
@@ -4188,7 +4188,7 @@ void emit_actor::load( const JsonObject &obj )
 int emit_actor::use( player &, item &it, bool, const tripoint &pos ) const
 {
     map &here = get_map();
-    const float scaling = scale_qty ? it.charges : 1;
+    const float scaling = scale_qty ? it.charges() : 1;
     for( const auto &e : emits ) {
         here.emit_field( pos, e, scaling );
     }
@@ -4885,7 +4885,7 @@ int sew_advanced_actor::use( player &p, item &it, bool, const tripoint & ) const
                 //~ %1$s: modification desc, %2$s: mod name
                 prompt = string_format( _( "Can't %1$s (incompatible with %2$s)" ), tolower( obj.implement_prompt ),
                                         mod.tname( 1, false ) );
-            } else if( it.charges < thread_needed ) {
+            } else if( it.charges() < thread_needed ) {
                 //~ %1$s: modification desc, %2$d: number of thread needed
                 prompt = string_format( _( "Can't %1$s (need %2$d thread loaded)" ),
                                         tolower( obj.implement_prompt ), thread_needed );
@@ -116,29 +116,28 @@ void kill_tracker::clear()
     npc_kills.clear();
 }
 
-void kill_tracker::notify( const cata::event &e )
+enum_bitset<event_type> kill_tracker::notified_types() const
 {
-    switch( e.type() ) {
-        case event_type::character_kills_monster: {
-            character_id killer = e.get<character_id>( "killer" );
-            if( killer != get_avatar().getID() ) {
-                // TODO: add a kill counter for npcs?
-                break;
-            }
-            mtype_id victim_type = e.get<mtype_id>( "victim_type" );
-            kills[victim_type]++;
-            break;
+    return enum_bitset<event_type>();
+}
+
+void kill_tracker::listen_to( event_bus &bus )
+{
+    using kills_monster = cata::typed_event<event_type::character_kills_monster>;
+    bus.listen<event_type::character_kills_monster>( this, [this]( const kills_monster & e ) {
+        const character_id &killer = e.get<kills_monster::field( "killer" )>();
+        if( killer != get_avatar().getID() ) {
+            // TODO: add a kill counter for npcs?
+            return;
         }
-        case event_type::character_kills_character: {
-            character_id killer = e.get<character_id>( "killer" );
-            if( killer != get_avatar().getID() ) {
-                break;
-            }
-            std::string victim_name = e.get<cata_variant_type::string>( "victim_name" );
-            npc_kills.push_back( victim_name );
-            break;
+        kills[e.get<kills_monster::field( "victim_type" )>()]++;
+    } );
+    using kills_character = cata::typed_event<event_type::character_kills_character>;
+    bus.listen<event_type::character_kills_character>( this, [this]( const kills_character & e ) {
+        const character_id &killer = e.get<kills_character::field( "killer" )>();
+        if( killer != get_avatar().getID() ) {
+            return;
         }
-        default:
-            break;
-    }
+        npc_kills.push_back( e.get<kills_character::field( "victim_name" )>() );
+    } );
 }
@@ -11,11 +11,6 @@
 
 class JsonIn;
 class JsonOut;
-namespace cata
-{
-class event;
-}  // namespace cata
-
 class kill_tracker : public event_subscriber
 {
         /**
@@ -40,7 +35,8 @@ class kill_tracker : public event_subscriber
 
         void clear();
 
-        void notify( const cata::event & ) override;
+        enum_bitset<event_type> notified_types() const override;
+        void listen_to( event_bus & ) override;
 
         void serialize( JsonOut & ) const;
         void deserialize( JsonIn & );
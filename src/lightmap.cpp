@@ -1,6 +1,8 @@
 #include "lightmap.h" // IWYU pragma: associated
 #include "shadowcasting.h" // IWYU pragma: associated
 
+#include <algorithm>
+#include <bitset>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -197,7 +199,9 @@ bool map::build_transparency_cache( const int zlev )
             }
         }
     }
+    map_cache.static_light_transparency_dirty |= map_cache.transparency_cache_dirty;
     map_cache.transparency_cache_dirty.reset();
+    map_cache.vehicle_footprints_stale = true;
     return true;
 }
 
@@ -634,12 +638,13 @@ void map::generate_lightmap( const int zlev )
       This may seem like extra work, but take a 12x12 raging inferno:
         unbuffered: (12^2)*(160*4) = apply_light_ray x 92160
         buffered:   (12*4)*(160)   = apply_light_ray x 7680
+      Their light is kept between turns and only recast where something changed.
     */
-    const tripoint cache_start( 0, 0, zlev );
-    const tripoint cache_end( LIGHTMAP_CACHE_X, LIGHTMAP_CACHE_Y, zlev );
-    for( const tripoint &p : points_in_rectangle( cache_start, cache_end ) ) {
-        if( light_source_buffer[p.x][p.y] > 0.0 ) {
-            apply_light_source( p, light_source_buffer[p.x][p.y] );
+    update_static_lightmap( zlev );
+    for( int x = 0; x < LIGHTMAP_CACHE_X; x++ ) {
+        for( int y = 0; y < LIGHTMAP_CACHE_Y; y++ ) {
+            lm[x][y] = elementwise_max( lm[x][y], map_cache.static_lm[x][y] );
+            sm[x][y] = std::max( sm[x][y], map_cache.static_sm[x][y] );
         }
     }
     for( const std::pair<tripoint, float> &elem : lm_override ) {
@@ -647,6 +652,160 @@ void map::generate_lightmap( const int zlev )
     }
 }
 
+static void cast_light_source( level_cache &cache, four_quadrants( &lm )[MAPSIZE_X][MAPSIZE_Y],
+                               float ( &sm )[MAPSIZE_X][MAPSIZE_Y], const point &p2, float luminance );
+
+// Set of tiles on a single z-level
+using tile_mask = std::bitset<LIGHTMAP_CACHE_X * LIGHTMAP_CACHE_Y>;
+
+static size_t tile_index( int x, int y )
+{
+    return static_cast<size_t>( x * LIGHTMAP_CACHE_Y + y );
+}
+
+// Answers "is any tile in this rectangle marked" in constant time
+class marked_tile_sums
+{
+    public:
+        explicit marked_tile_sums( const tile_mask &mask )
+            : sums( ( LIGHTMAP_CACHE_X + 1 ) * ( LIGHTMAP_CACHE_Y + 1 ), 0 ) {
+            for( int x = 0; x < LIGHTMAP_CACHE_X; x++ ) {
+                for( int y = 0; y < LIGHTMAP_CACHE_Y; y++ ) {
+                    at( x + 1, y + 1 ) = ( mask[tile_index( x, y )] ? 1 : 0 ) +
+                                         at( x, y + 1 ) + at( x + 1, y ) - at( x, y );
+                }
+            }
+        }
+
+        // Inclusive bounds, clipped to the map
+        bool any( point min, point max ) const {
+            min = point( std::max( min.x, 0 ), std::max( min.y, 0 ) );
+            max = point( std::min( max.x, LIGHTMAP_CACHE_X - 1 ), std::min( max.y, LIGHTMAP_CACHE_Y - 1 ) );
+            if( min.x > max.x || min.y > max.y ) {
+                return false;
+            }
+            return at( max.x + 1, max.y + 1 ) - at( min.x, max.y + 1 ) - at( max.x + 1, min.y ) +
+                   at( min.x, min.y ) > 0;
+        }
+
+    private:
+        std::vector<int> sums;
+
+        int &at( int x, int y ) {
+            return sums[x * ( LIGHTMAP_CACHE_Y + 1 ) + y];
+        }
+        int at( int x, int y ) const {
+            return sums[x * ( LIGHTMAP_CACHE_Y + 1 ) + y];
+        }
+};
+
+// Distance past which a source can't light anything.  Light falls off at least
+// as fast as luminance / distance and stops below LIGHT_AMBIENT_LOW; one more tile
+// covers the diagonal vehicle blocks read next to the lit ones.
+static int light_source_radius( float luminance )
+{
+    return static_cast<int>( std::ceil( std::max( luminance, 1.49f ) / LIGHT_AMBIENT_LOW ) ) + 2;
+}
+
+void map::update_static_lightmap( const int zlev )
+{
+    level_cache &map_cache = get_cache( zlev );
+    const auto &sources = map_cache.light_source_buffer;
+    auto &old_sources = map_cache.static_light_sources;
+    const auto &transparency = map_cache.transparency_cache;
+    const auto &obscured = map_cache.vehicle_obscured_cache;
+
+    tile_mask dirty;
+    if( !map_cache.static_light_valid ) {
+        dirty.set();
+    } else {
+        // Tiles where anything a light cast reads has changed
+        tile_mask changed;
+        for( int x = 0; x < LIGHTMAP_CACHE_X; x++ ) {
+            for( int y = 0; y < LIGHTMAP_CACHE_Y; y++ ) {
+                const diagonal_blocks &a = obscured[x][y];
+                const diagonal_blocks &b = map_cache.static_light_obscured[x][y];
+                if( sources[x][y] != old_sources[x][y] || a.nw != b.nw || a.ne != b.ne ) {
+                    changed.set( tile_index( x, y ) );
+                }
+            }
+        }
+        const auto &dirty_submaps = map_cache.static_light_transparency_dirty;
+        for( int smx = 0; smx < my_MAPSIZE && dirty_submaps.any(); ++smx ) {
+            for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+                if( !dirty_submaps[smx * MAPSIZE + smy] ) {
+                    continue;
+                }
+                for( int x = smx * SEEX; x < ( smx + 1 ) * SEEX; x++ ) {
+                    for( int y = smy * SEEY; y < ( smy + 1 ) * SEEY; y++ ) {
+                        if( transparency[x][y] != map_cache.static_light_transparency[x][y] ) {
+                            changed.set( tile_index( x, y ) );
+                        }
+                    }
+                }
+            }
+        }
+        if( changed.none() ) {
+            map_cache.static_light_transparency_dirty.reset();
+            return;
+        }
+
+        // Everything lit by a source, old or new, that could see a changed tile
+        const marked_tile_sums changed_sums( changed );
+        for( int x = 0; x < LIGHTMAP_CACHE_X; x++ ) {
+            for( int y = 0; y < LIGHTMAP_CACHE_Y; y++ ) {
+                const float luminance = std::max( sources[x][y], old_sources[x][y] );
+                if( luminance <= 0.0f ) {
+                    continue;
+                }
+                const int r = light_source_radius( luminance );
+                if( !changed_sums.any( point( x - r, y - r ), point( x + r, y + r ) ) ) {
+                    continue;
+                }
+                for( int dx = std::max( x - r, 0 ); dx <= std::min( x + r, LIGHTMAP_CACHE_X - 1 ); dx++ ) {
+                    for( int dy = std::max( y - r, 0 ); dy <= std::min( y + r, LIGHTMAP_CACHE_Y - 1 ); dy++ ) {
+                        dirty.set( tile_index( dx, dy ) );
+                    }
+                }
+            }
+        }
+    }
+
+    // Clear the dirty area and recast every source that reaches into it.
+    // Sources that only overlap it cast the same light outside of it as before.
+    constexpr four_quadrants four_zeros( 0.0f );
+    for( int x = 0; x < LIGHTMAP_CACHE_X; x++ ) {
+        for( int y = 0; y < LIGHTMAP_CACHE_Y; y++ ) {
+            if( dirty[tile_index( x, y )] ) {
+                map_cache.static_lm[x][y] = four_zeros;
+                map_cache.static_sm[x][y] = 0.0f;
+            }
+        }
+    }
+    const marked_tile_sums dirty_sums( dirty );
+    for( int x = 0; x < LIGHTMAP_CACHE_X; x++ ) {
+        for( int y = 0; y < LIGHTMAP_CACHE_Y; y++ ) {
+            const float luminance = sources[x][y];
+            if( luminance <= 0.0f ) {
+                continue;
+            }
+            const int r = light_source_radius( luminance );
+            if( dirty_sums.any( point( x - r, y - r ), point( x + r, y + r ) ) ) {
+                cast_light_source( map_cache, map_cache.static_lm, map_cache.static_sm, point( x, y ),
+                                   luminance );
+            }
+        }
+    }
+
+    std::copy_n( &sources[0][0], LIGHTMAP_CACHE_X * LIGHTMAP_CACHE_Y, &old_sources[0][0] );
+    std::copy_n( &transparency[0][0], LIGHTMAP_CACHE_X * LIGHTMAP_CACHE_Y,
+                 &map_cache.static_light_transparency[0][0] );
+    std::copy_n( &obscured[0][0], LIGHTMAP_CACHE_X * LIGHTMAP_CACHE_Y,
+                 &map_cache.static_light_obscured[0][0] );
+    map_cache.static_light_transparency_dirty.reset();
+    map_cache.static_light_valid = true;
+}
+
 void map::add_light_source( const tripoint &p, float luminance )
 {
     auto &light_source_buffer = get_cache( p.z ).light_source_buffer;
@@ -1751,15 +1910,17 @@ static float light_from_lookup( const float &numerator, const float &transparenc
 void map::apply_light_source( const tripoint &p, float luminance )
 {
     auto &cache = get_cache( p.z );
-    four_quadrants( &lm )[MAPSIZE_X][MAPSIZE_Y] = cache.lm;
-    float ( &sm )[MAPSIZE_X][MAPSIZE_Y] = cache.sm;
+    cast_light_source( cache, cache.lm, cache.sm, p.xy(), luminance );
+}
+
+static void cast_light_source( level_cache &cache, four_quadrants( &lm )[MAPSIZE_X][MAPSIZE_Y],
+                               float ( &sm )[MAPSIZE_X][MAPSIZE_Y], const point &p2, float luminance )
+{
     float ( &transparency_cache )[MAPSIZE_X][MAPSIZE_Y] = cache.transparency_cache;
     float ( &light_source_buffer )[MAPSIZE_X][MAPSIZE_Y] = cache.light_source_buffer;
     diagonal_blocks( &blocked_cache )[MAPSIZE_X][MAPSIZE_Y] = cache.vehicle_obscured_cache;
 
-    const point p2( p.xy() );
-
-    if( inbounds( p ) ) {
+    if( lightmap_boundaries.contains( p2 ) ) {
         const float min_light = std::max( static_cast<float>( lit_level::LOW ), luminance );
         lm[p2.x][p2.y] = elementwise_max( lm[p2.x][p2.y], min_light );
         sm[p2.x][p2.y] = std::max( sm[p2.x][p2.y], luminance );
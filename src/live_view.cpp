@@ -12,6 +12,7 @@
 #include "output.h"
 #include "panels.h"
 #include "translations.h"
+#include "typed_options.h"
 #include "ui_manager.h"
 
 namespace
@@ -42,7 +43,7 @@ void live_view::show( const tripoint &p )
         ui = std::make_unique<ui_adaptor>();
         ui->on_screen_resize( [this]( ui_adaptor & ui ) {
             auto &mgr = panel_manager::get_manager();
-            const bool sidebar_right = get_option<std::string>( "SIDEBAR_POSITION" ) == "right";
+            const bool sidebar_right = get_option( option::SIDEBAR_POSITION ) == "right";
             const int width = sidebar_right ? mgr.get_width_right() : mgr.get_width_left();
 
             const int max_height = TERMY / 2;
@@ -23,11 +23,11 @@ namespace
 
 const item *cost_split_helper( const item *it, int qty )
 {
-    if( !it->count_by_charges() || qty <= 0 || qty >= it->charges ) {
+    if( !it->count_by_charges() || qty <= 0 || qty >= it->charges() ) {
         return it;
     }
     item *split = item::spawn_temporary( *it );
-    split->charges = qty;
+    split->set_charges( qty );
     return split;
 }
 
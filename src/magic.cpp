@@ -2137,30 +2137,29 @@ bool fake_spell::operator==( const fake_spell &rhs ) const
            npc_trigger_message == rhs.npc_trigger_message;
 }
 
-void spell_events::notify( const cata::event &e )
-{
-    switch( e.type() ) {
-        case event_type::player_levels_spell: {
-            spell_id sid = e.get<spell_id>( "spell" );
-            int slvl = e.get<int>( "new_level" );
-            spell_type spell_cast = spell_factory.obj( sid );
-            for( std::map<std::string, int>::iterator it = spell_cast.learn_spells.begin();
-                 it != spell_cast.learn_spells.end(); ++it ) {
-                std::string learn_spell_id = it->first;
-                int learn_at_level = it->second;
-                if( learn_at_level == slvl ) {
-                    g->u.magic->learn_spell( learn_spell_id, g->u );
-                    spell_type spell_learned = spell_factory.obj( spell_id( learn_spell_id ) );
-                    add_msg(
-                        _( "Your experience and knowledge in creating and manipulating magical energies to cast %s have opened your eyes to new possibilities, you can now cast %s." ),
-                        spell_cast.name,
-                        spell_learned.name );
-                }
+enum_bitset<event_type> spell_events::notified_types() const
+{
+    return enum_bitset<event_type>();
+}
+
+void spell_events::listen_to( event_bus &bus )
+{
+    using levels_spell = cata::typed_event<event_type::player_levels_spell>;
+    bus.listen<event_type::player_levels_spell>( this, []( const levels_spell & e ) {
+        const spell_id &sid = e.get<levels_spell::field( "spell" )>();
+        const int slvl = e.get<levels_spell::field( "new_level" )>();
+        const spell_type &spell_cast = spell_factory.obj( sid );
+        for( const std::pair<const std::string, int> &learn : spell_cast.learn_spells ) {
+            const std::string &learn_spell_id = learn.first;
+            int learn_at_level = learn.second;
+            if( learn_at_level == slvl ) {
+                g->u.magic->learn_spell( learn_spell_id, g->u );
+                const spell_type &spell_learned = spell_factory.obj( spell_id( learn_spell_id ) );
+                add_msg(
+                    _( "Your experience and knowledge in creating and manipulating magical energies to cast %s have opened your eyes to new possibilities, you can now cast %s." ),
+                    spell_cast.name,
+                    spell_learned.name );
             }
-            break;
         }
-        default:
-            break;
-
-    }
+    } );
 }
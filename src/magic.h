@@ -126,7 +126,8 @@ struct fake_spell {
 class spell_events : public event_subscriber
 {
     public:
-        void notify( const cata::event & ) override;
+        enum_bitset<event_type> notified_types() const override;
+        void listen_to( event_bus & ) override;
 };
 
 class spell_type
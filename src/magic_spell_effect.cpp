@@ -749,7 +749,7 @@ void spell_effect::spawn_ethereal_item( const spell &sp, Creature &caster, const
         granted->set_flag( flag_id( "ETHEREAL_ITEM" ) );
     }
     if( granted->count_by_charges() && sp.damage() > 0 ) {
-        granted->charges = sp.damage();
+        granted->set_charges( sp.damage() );
     }
     avatar &you = get_avatar();
     if( granted->made_of( LIQUID ) ) {
@@ -12,6 +12,7 @@
 #include <ctime>
 #include <optional>
 
+#include "async_file_writer.h"
 #include "auto_pickup.h"
 #include "avatar.h"
 #include "cata_utility.h"
@@ -871,6 +872,7 @@ bool main_menu::new_character_tab()
             if( res == "DELETE" &&
                 query_yn( _( "Are you sure you want to delete %s?" ), templates[opt_val] ) ) {
                 const auto path = PATH_INFO::templatedir() + templates[opt_val] + ".template";
+                get_async_file_writer().wait();
                 if( !remove_file( path ) ) {
                     popup( _( "Sorry, something went wrong." ) );
                 } else {
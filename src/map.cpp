@@ -331,6 +331,25 @@ void map::reset_vehicle_cache( )
     }
 }
 
+static uint32_t vehicle_slot( level_cache &ch, vehicle *veh )
+{
+    const auto it = std::find( ch.veh_slots.begin(), ch.veh_slots.end(), veh );
+    if( it != ch.veh_slots.end() ) {
+        return static_cast<uint32_t>( std::distance( ch.veh_slots.begin(), it ) );
+    }
+    ch.veh_slots.push_back( veh );
+    return static_cast<uint32_t>( ch.veh_slots.size() - 1 );
+}
+
+static void erase_overlapped_parts( level_cache &ch, point p, const vehicle *veh )
+{
+    auto &overlapped = ch.veh_overlapped_parts;
+    overlapped.erase( std::remove_if( overlapped.begin(), overlapped.end(),
+    [&]( const std::pair<point, vehicle_part_slot> &e ) {
+        return e.first == p && ch.veh_slots[e.second.slot] == veh;
+    } ), overlapped.end() );
+}
+
 void map::add_vehicle_to_cache( vehicle *veh )
 {
     if( veh == nullptr ) {
@@ -338,6 +357,9 @@ void map::add_vehicle_to_cache( vehicle *veh )
         return;
     }
 
+    // Parts are nearly always on a single z-level, so the slot rarely has to be looked up again
+    int slot_z = INT_MIN;
+    uint32_t slot = 0;
     // Get parts
     for( const vpart_reference &vpr : veh->get_all_parts() ) {
         if( vpr.part().removed ) {
@@ -346,10 +368,21 @@ void map::add_vehicle_to_cache( vehicle *veh )
         const tripoint p = veh->global_part_pos3( vpr.part() );
         level_cache &ch = get_cache( p.z );
         ch.veh_in_active_range = true;
-        ch.veh_cached_parts[p] = std::make_pair( veh,  static_cast<int>( vpr.part_index() ) );
-        if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = true;
+        if( !inbounds( p ) ) {
+            continue;
+        }
+        if( p.z != slot_z ) {
+            slot_z = p.z;
+            slot = vehicle_slot( ch, veh );
         }
+        vehicle_part_slot &cached = ch.veh_parts_at[p.x][p.y];
+        if( ch.veh_exists_at[p.x][p.y] && cached.slot != slot ) {
+            erase_overlapped_parts( ch, p.xy(), veh );
+            ch.veh_overlapped_parts.emplace_back( p.xy(), cached );
+        }
+        cached.slot = slot;
+        cached.part = static_cast<int>( vpr.part_index() );
+        ch.veh_exists_at[p.x][p.y] = true;
     }
 
     last_full_vehicle_list_dirty = true;
@@ -361,16 +394,28 @@ void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint &pt )
         debugmsg( "Tried to clear null vehicle from cache" );
         return;
     }
+    if( !inbounds( pt ) ) {
+        return;
+    }
 
     level_cache &ch = get_cache( pt.z );
-    if( inbounds( pt ) ) {
-        ch.veh_exists_at[pt.x][pt.y] = false;
+    const vehicle_part_slot &cached = ch.veh_parts_at[pt.x][pt.y];
+    if( !ch.veh_exists_at[pt.x][pt.y] || ch.veh_slots[cached.slot] != veh ) {
+        erase_overlapped_parts( ch, pt.xy(), veh );
+        return;
     }
-    auto it = ch.veh_cached_parts.find( pt );
-    if( it != ch.veh_cached_parts.end() && it->second.first == veh ) {
-        ch.veh_cached_parts.erase( it );
+    // Uncover the part of a vehicle this one overlapped, if any
+    auto &overlapped = ch.veh_overlapped_parts;
+    const auto it = std::find_if( overlapped.begin(), overlapped.end(),
+    [&]( const std::pair<point, vehicle_part_slot> &e ) {
+        return e.first == pt.xy();
+    } );
+    if( it != overlapped.end() ) {
+        ch.veh_parts_at[pt.x][pt.y] = it->second;
+        overlapped.erase( it );
+    } else {
+        ch.veh_exists_at[pt.x][pt.y] = false;
     }
-
 }
 
 void map::clear_vehicle_cache( )
@@ -379,13 +424,10 @@ void map::clear_vehicle_cache( )
     const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int zlev = zmin; zlev <= zmax; zlev++ ) {
         level_cache &ch = get_cache( zlev );
-        while( !ch.veh_cached_parts.empty() ) {
-            const auto part = ch.veh_cached_parts.begin();
-            const auto &p = part->first;
-            if( inbounds( p ) ) {
-                ch.veh_exists_at[p.x][p.y] = false;
-            }
-            ch.veh_cached_parts.erase( part );
+        if( !ch.veh_slots.empty() ) {
+            std::fill_n( &ch.veh_exists_at[0][0], MAPSIZE_X * MAPSIZE_Y, false );
+            ch.veh_slots.clear();
+            ch.veh_overlapped_parts.clear();
         }
         ch.veh_in_active_range = false;
     }
@@ -478,7 +520,7 @@ void map::on_vehicle_moved( const int smz )
 
 void map::vehmove()
 {
-    ZoneScoped;
+    ZoneScopedN( "map::vehmove" );
 
     // give vehicles movement points
     VehicleList vehicle_list;
@@ -1102,15 +1144,9 @@ const vehicle *map::veh_at_internal( const tripoint &p, int &part_num ) const
         return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
     }
 
-    const auto it = ch.veh_cached_parts.find( p );
-    if( it != ch.veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
-    }
-
-    debugmsg( "vehicle part cache indicated vehicle not found: %d %d %d", p.x, p.y, p.z );
-    part_num = -1;
-    return nullptr;
+    const vehicle_part_slot &cached = ch.veh_parts_at[p.x][p.y];
+    part_num = cached.part;
+    return ch.veh_slots[cached.slot];
 }
 
 vehicle *map::veh_at_internal( const tripoint &p, int &part_num )
@@ -2461,6 +2497,35 @@ bool map::has_flag_ter_or_furn( const ter_bitflags flag, const tripoint &p ) con
              current_submap->get_furn( l ).obj().has_flag( flag ) );
 }
 
+bool map::has_flag( const ter_furn_flag &flag, const tripoint &p ) const
+{
+    return has_flag_ter_or_furn( flag, p ); // Does bound checking
+}
+
+bool map::has_flag_ter( const ter_furn_flag &flag, const tripoint &p ) const
+{
+    return ter( p ).obj().has_flag( flag );
+}
+
+bool map::has_flag_furn( const ter_furn_flag &flag, const tripoint &p ) const
+{
+    return furn( p ).obj().has_flag( flag );
+}
+
+bool map::has_flag_ter_or_furn( const ter_furn_flag &flag, const tripoint &p ) const
+{
+    if( !inbounds( p ) ) {
+        return false;
+    }
+
+    point l;
+    submap *const current_submap = get_submap_at( p, l );
+
+    return current_submap && //FIXME: can be null during mapgen
+           ( current_submap->get_ter( l ).obj().has_flag( flag ) ||
+             current_submap->get_furn( l ).obj().has_flag( flag ) );
+}
+
 // End of 3D flags
 
 // Bashable - common function
@@ -3110,7 +3175,7 @@ void map::smash_items( const tripoint &p, const int power, const std::string &ca
             }
         }
         bool is_active_explosive = it->active && it->type->get_use( "explosion" ) != nullptr;
-        if( is_active_explosive && it->charges == 0 ) {
+        if( is_active_explosive && it->charges() == 0 ) {
             return std::move( it );
         }
 
@@ -4317,9 +4382,9 @@ detached_ptr<item> map::spawn_an_item( const tripoint &p, detached_ptr<item> &&n
         new_item->set_flag( flag_FIT );
     }
 
-    if( charges && new_item->charges > 0 ) {
+    if( charges && new_item->charges() > 0 ) {
         //let's fail silently if we specify charges for an item that doesn't support it
-        new_item->charges = charges;
+        new_item->set_charges( charges );
     }
     detached_ptr<item> spawned_item = item::in_its_container( std::move( new_item ) );
     if( ( spawned_item->made_of( LIQUID ) && has_flag( "SWIMMABLE", p ) ) ||
@@ -4416,7 +4481,7 @@ detached_ptr<item> map::add_item_or_charges( const tripoint &pos, detached_ptr<i
         if( !inbounds( e ) ) {
             // should never happen
             debugmsg( "add_item_or_charges: %s is out of bounds (adding item '%s' [%d])",
-                      e.to_string(), obj->typeId().c_str(), obj->charges );
+                      e.to_string(), obj->typeId().c_str(), obj->charges() );
             return false;
         }
 
@@ -4761,6 +4826,7 @@ std::vector<tripoint> map::check_submap_active_item_consistency()
 
 void map::process_items()
 {
+    ZoneScopedN( "map::process_items" );
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int gz = minz; gz <= maxz; ++gz ) {
@@ -5055,14 +5121,14 @@ static void use_charges_from_furn( const furn_t &f, const itype_id &type, int &q
             if( filter( **current_item ) && ( *current_item )->made_of( LIQUID ) &&
                 type == ( *current_item )->typeId() ) {
 
-                if( ( *current_item )->charges - quantity > 0 ) {
+                if( ( *current_item )->charges() - quantity > 0 ) {
                     ret.push_back( ( *current_item )->split( quantity ) );
                     // All the liquid needed was found, no other sources will be needed
                     quantity = 0;
                 } else {
                     // The liquid copy in ret already contains how much was available
                     // The leftover quantity returned will check other sources
-                    quantity -= ( *current_item )->charges;
+                    quantity -= ( *current_item )->charges();
                     // Remove liquid item from the world
                     detached_ptr<item> det;
                     item_list.erase( current_item, &det );
@@ -5123,7 +5189,7 @@ std::vector<detached_ptr<item>> map::use_charges( const tripoint &origin, const
         // Handle infinite map sources.
         detached_ptr<item> water = water_from( p );
         if( water && water->typeId() == type ) {
-            water->charges = quantity;
+            water->set_charges( quantity );
             ret.push_back( std::move( water ) );
             quantity = 0;
             return ret;
@@ -5175,9 +5241,9 @@ std::vector<detached_ptr<item>> map::use_charges( const tripoint &origin, const
             // TODO: add a sane birthday arg
             //TODO!: check if we actually need the return  here
             detached_ptr<item> tmp = item::spawn( type, calendar::start_of_cataclysm );
-            tmp->charges = kpart->vehicle().drain( ftype, quantity );
+            tmp->set_charges( kpart->vehicle().drain( ftype, quantity ) );
             // TODO: Handle water poison when crafting starts respecting it
-            quantity -= tmp->charges;
+            quantity -= tmp->charges();
             ret.push_back( std::move( tmp ) );
 
             if( quantity == 0 ) {
@@ -5195,8 +5261,8 @@ std::vector<detached_ptr<item>> map::use_charges( const tripoint &origin, const
             }
             // TODO: add a sane birthday arg
             detached_ptr<item> tmp = item::spawn( type, calendar::start_of_cataclysm );
-            tmp->charges = weldpart->vehicle().drain( ftype, quantity );
-            quantity -= tmp->charges;
+            tmp->set_charges( weldpart->vehicle().drain( ftype, quantity ) );
+            quantity -= tmp->charges();
             ret.push_back( std::move( tmp ) );
 
             if( quantity == 0 ) {
@@ -5219,8 +5285,8 @@ std::vector<detached_ptr<item>> map::use_charges( const tripoint &origin, const
 
             // TODO: add a sane birthday arg
             detached_ptr<item> tmp = item::spawn( type, calendar::start_of_cataclysm );
-            tmp->charges = craftpart->vehicle().drain( ftype, quantity );
-            quantity -= tmp->charges;
+            tmp->set_charges( craftpart->vehicle().drain( ftype, quantity ) );
+            quantity -= tmp->charges();
             ret.push_back( std::move( tmp ) );
 
             if( quantity == 0 ) {
@@ -5237,8 +5303,8 @@ std::vector<detached_ptr<item>> map::use_charges( const tripoint &origin, const
 
             // TODO: add a sane birthday arg
             detached_ptr<item> tmp = item::spawn( type, calendar::start_of_cataclysm );
-            tmp->charges = forgepart->vehicle().drain( ftype, quantity );
-            quantity -= tmp->charges;
+            tmp->set_charges( forgepart->vehicle().drain( ftype, quantity ) );
+            quantity -= tmp->charges();
             ret.push_back( std::move( tmp ) );
 
             if( quantity == 0 ) {
@@ -5255,8 +5321,8 @@ std::vector<detached_ptr<item>> map::use_charges( const tripoint &origin, const
 
             // TODO: add a sane birthday arg
             detached_ptr<item> tmp = item::spawn( type, calendar::start_of_cataclysm );
-            tmp->charges = kilnpart->vehicle().drain( ftype, quantity );
-            quantity -= tmp->charges;
+            tmp->set_charges( kilnpart->vehicle().drain( ftype, quantity ) );
+            quantity -= tmp->charges();
             ret.push_back( std::move( tmp ) );
 
             if( quantity == 0 ) {
@@ -5277,8 +5343,8 @@ std::vector<detached_ptr<item>> map::use_charges( const tripoint &origin, const
 
             // TODO: add a sane birthday arg
             detached_ptr<item> tmp = item::spawn( type, calendar::start_of_cataclysm );
-            tmp->charges = chempart->vehicle().drain( ftype, quantity );
-            quantity -= tmp->charges;
+            tmp->set_charges( chempart->vehicle().drain( ftype, quantity ) );
+            quantity -= tmp->charges();
             ret.push_back( std::move( tmp ) );
 
             if( quantity == 0 ) {
@@ -5295,8 +5361,8 @@ std::vector<detached_ptr<item>> map::use_charges( const tripoint &origin, const
 
             // TODO: add a sane birthday arg
             detached_ptr<item> tmp = item::spawn( type, calendar::start_of_cataclysm );
-            tmp->charges = autoclavepart->vehicle().drain( ftype, quantity );
-            quantity -= tmp->charges;
+            tmp->set_charges( autoclavepart->vehicle().drain( ftype, quantity ) );
+            quantity -= tmp->charges();
             ret.push_back( std::move( tmp ) );
 
             if( quantity == 0 ) {
@@ -6867,6 +6933,48 @@ shift_bitset_cache<MAPSIZE_X, SEEX>( std::bitset<MAPSIZE_X *MAPSIZE_X> &cache,
 template void
 shift_bitset_cache<MAPSIZE, 1>( std::bitset<MAPSIZE *MAPSIZE> &cache, point s );
 
+// Moves a per-tile cache along with the submaps in map::shift.
+// Tiles of the newly loaded edge keep stale values and must be rebuilt.
+template<typename T>
+static void shift_tile_cache( T( &cache )[MAPSIZE_X][MAPSIZE_Y], point sp )
+{
+    // After the shift, tile p holds what was at p + offset
+    const point offset( sp.x * SEEX, sp.y * SEEY );
+    const int count_y = MAPSIZE_Y - std::abs( offset.y );
+    const int dst_y = std::max( -offset.y, 0 );
+    const int src_y = std::max( offset.y, 0 );
+    const auto move_column = [&]( int x ) {
+        std::memmove( &cache[x][dst_y], &cache[x + offset.x][src_y], count_y * sizeof( T ) );
+    };
+    // Go in the direction that reads each column before it is overwritten
+    if( offset.x >= 0 ) {
+        for( int x = 0; x < MAPSIZE_X - offset.x; x++ ) {
+            move_column( x );
+        }
+    } else {
+        for( int x = MAPSIZE_X - 1; x >= -offset.x; x-- ) {
+            move_column( x );
+        }
+    }
+}
+
+// Same as shift_tile_cache, for per-submap bits indexed by x * MAPSIZE + y
+static std::bitset<MAPSIZE *MAPSIZE> shift_submap_bits( const std::bitset<MAPSIZE *MAPSIZE> &bits,
+        point sp )
+{
+    std::bitset<MAPSIZE *MAPSIZE> ret;
+    for( int smx = 0; smx < MAPSIZE; smx++ ) {
+        for( int smy = 0; smy < MAPSIZE; smy++ ) {
+            const point src( smx + sp.x, smy + sp.y );
+            if( src.x >= 0 && src.x < MAPSIZE && src.y >= 0 && src.y < MAPSIZE &&
+                bits[src.x * MAPSIZE + src.y] ) {
+                ret.set( smx * MAPSIZE + smy );
+            }
+        }
+    }
+    return ret;
+}
+
 static inline void shift_tripoint_set( std::set<tripoint> &set, point offset,
                                        const half_open_rectangle<point> &boundaries )
 {
@@ -6978,73 +7086,86 @@ void map::shift( point sp )
     constexpr half_open_rectangle<point> boundaries_2d( point_zero, point( MAPSIZE_Y, MAPSIZE_X ) );
     const point shift_offset_pt( -sp.x * SEEX, -sp.y * SEEY );
 
-    // Clear vehicle list and rebuild after shift
+    // loadn() marks whole levels dirty for the new edge submaps.  Remember what was dirty
+    // before, so the caches of submaps that stay loaded can be moved along with them.
+    struct cache_dirtiness {
+        std::bitset<MAPSIZE *MAPSIZE> transparency;
+        bool outside;
+        std::bitset<MAPSIZE *MAPSIZE> outside_submaps;
+        bool floor;
+        std::bitset<MAPSIZE *MAPSIZE> floor_submaps;
+        bool pathfinding;
+        std::bitset<MAPSIZE *MAPSIZE> pathfinding_submaps;
+    };
+    std::vector<cache_dirtiness> old_dirtiness;
+    for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+        const level_cache &ch = get_cache( gridz );
+        const pathfinding_cache &pf = get_pathfinding_cache( gridz );
+        old_dirtiness.push_back( {
+            ch.transparency_cache_dirty, ch.outside_cache_dirty, ch.outside_cache_dirty_submaps,
+            ch.floor_cache_dirty, ch.floor_cache_dirty_submaps, pf.dirty, pf.dirty_submaps
+        } );
+    }
+    // Submaps loaded by this shift, and the ones whose neighbours changed for caches
+    // that look at adjacent tiles
+    std::bitset<MAPSIZE *MAPSIZE> new_submaps;
+    std::bitset<MAPSIZE *MAPSIZE> near_new_submaps;
+    for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+        for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+            const point src( gridx + sp.x, gridy + sp.y );
+            if( src.x < 0 || src.x >= my_MAPSIZE || src.y < 0 || src.y >= my_MAPSIZE ) {
+                new_submaps.set( gridx * MAPSIZE + gridy );
+                for( int nx = std::max( gridx - 1, 0 ); nx <= std::min( gridx + 1, my_MAPSIZE - 1 ); nx++ ) {
+                    for( int ny = std::max( gridy - 1, 0 ); ny <= std::min( gridy + 1, my_MAPSIZE - 1 ); ny++ ) {
+                        near_new_submaps.set( nx * MAPSIZE + ny );
+                    }
+                }
+            }
+            // Tiles at the edge that was unloaded lost their neighbours there
+            const point gone( gridx - sp.x, gridy - sp.y );
+            if( gone.x < 0 || gone.x >= my_MAPSIZE || gone.y < 0 || gone.y >= my_MAPSIZE ) {
+                near_new_submaps.set( gridx * MAPSIZE + gridy );
+            }
+        }
+    }
+
     clear_vehicle_cache( );
     // Shift the map sx submaps to the right and sy submaps down.
     // sx and sy should never be bigger than +/-1.
     // absx and absy are our position in the world, for saving/loading purposes.
+    // The grid is a ring buffer, so the submaps that stay loaded aren't moved.  The ones
+    // falling off the edge are dropped and their slots reused for the new edge.
     for( int gridz = zmin; gridz <= zmax; gridz++ ) {
-        clear_vehicle_list( gridz );
-        shift_bitset_cache<MAPSIZE_X, SEEX>( get_cache( gridz ).map_memory_seen_cache, sp );
-        shift_bitset_cache<MAPSIZE, 1>( get_cache( gridz ).field_cache, sp );
-        if( sp.x >= 0 ) {
-            for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
-                if( sp.y >= 0 ) {
-                    for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
-                        if( ( sp.x > 0 && gridx == 0 ) || ( sp.y > 0 && gridy == 0 ) ) {
-                            submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
-                        }
-                        if( gridx + sp.x < my_MAPSIZE && gridy + sp.y < my_MAPSIZE ) {
-                            copy_grid( tripoint( gridx, gridy, gridz ),
-                                       tripoint( gridx + sp.x, gridy + sp.y, gridz ) );
-                            update_vehicle_list( get_submap_at_grid( {gridx, gridy, gridz} ), gridz );
-                        } else {
-                            loadn( tripoint( gridx, gridy, gridz ), true );
-                        }
-                    }
-                } else { // sy < 0; work through it backwards
-                    for( int gridy = my_MAPSIZE - 1; gridy >= 0; gridy-- ) {
-                        if( ( sp.x > 0 && gridx == 0 ) || gridy == my_MAPSIZE - 1 ) {
-                            submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
-                        }
-                        if( gridx + sp.x < my_MAPSIZE && gridy + sp.y >= 0 ) {
-                            copy_grid( tripoint( gridx, gridy, gridz ),
-                                       tripoint( gridx + sp.x, gridy + sp.y, gridz ) );
-                            update_vehicle_list( get_submap_at_grid( { gridx, gridy, gridz } ), gridz );
-                        } else {
-                            loadn( tripoint( gridx, gridy, gridz ), true );
-                        }
-                    }
+        level_cache &ch = get_cache( gridz );
+        shift_bitset_cache<MAPSIZE_X, SEEX>( ch.map_memory_seen_cache, sp );
+        shift_bitset_cache<MAPSIZE, 1>( ch.field_cache, sp );
+        for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                const point dst( gridx - sp.x, gridy - sp.y );
+                if( dst.x >= 0 && dst.x < my_MAPSIZE && dst.y >= 0 && dst.y < my_MAPSIZE ) {
+                    continue;
+                }
+                submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
+                for( const auto &veh : get_submap_at_grid( { gridx, gridy, gridz } )->vehicles ) {
+                    ch.vehicle_list.erase( veh.get() );
+                    ch.zone_vehicles.erase( veh.get() );
                 }
             }
-        } else { // sx < 0; work through it backwards
-            for( int gridx = my_MAPSIZE - 1; gridx >= 0; gridx-- ) {
-                if( sp.y >= 0 ) {
-                    for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
-                        if( gridx == my_MAPSIZE - 1 || ( sp.y > 0 && gridy == 0 ) ) {
-                            submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
-                        }
-                        if( gridx + sp.x >= 0 && gridy + sp.y < my_MAPSIZE ) {
-                            copy_grid( tripoint( gridx, gridy, gridz ),
-                                       tripoint( gridx + sp.x, gridy + sp.y, gridz ) );
-                            update_vehicle_list( get_submap_at_grid( { gridx, gridy, gridz } ), gridz );
-                        } else {
-                            loadn( tripoint( gridx, gridy, gridz ), true );
-                        }
-                    }
-                } else { // sy < 0; work through it backwards
-                    for( int gridy = my_MAPSIZE - 1; gridy >= 0; gridy-- ) {
-                        if( gridx == my_MAPSIZE - 1 || gridy == my_MAPSIZE - 1 ) {
-                            submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
-                        }
-                        if( gridx + sp.x >= 0 && gridy + sp.y >= 0 ) {
-                            copy_grid( tripoint( gridx, gridy, gridz ),
-                                       tripoint( gridx + sp.x, gridy + sp.y, gridz ) );
-                            update_vehicle_list( get_submap_at_grid( { gridx, gridy, gridz } ), gridz );
-                        } else {
-                            loadn( tripoint( gridx, gridy, gridz ), true );
-                        }
-                    }
+        }
+        for( vehicle *veh : ch.vehicle_list ) {
+            veh->sm_pos -= sp;
+        }
+    }
+    last_full_vehicle_list_dirty = true;
+
+    grid_origin.x = ( grid_origin.x + sp.x + my_MAPSIZE ) % my_MAPSIZE;
+    grid_origin.y = ( grid_origin.y + sp.y + my_MAPSIZE ) % my_MAPSIZE;
+
+    for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+        for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                if( new_submaps[gridx * MAPSIZE + gridy] ) {
+                    loadn( tripoint( gridx, gridy, gridz ), true );
                 }
             }
         }
@@ -7074,6 +7195,62 @@ void map::shift( point sp )
         }
     }
 
+    for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+        level_cache &ch = get_cache( gridz );
+        pathfinding_cache &pf = get_pathfinding_cache( gridz );
+        const cache_dirtiness &old = old_dirtiness[gridz - zmin];
+        shift_tile_cache( ch.transparency_cache, sp );
+        shift_tile_cache( ch.outside_cache, sp );
+        shift_tile_cache( ch.floor_cache, sp );
+        shift_tile_cache( pf.special, sp );
+        // Transparency depends on outside_cache, which looks at adjacent tiles
+        ch.transparency_cache_dirty = shift_submap_bits( old.transparency, sp ) | near_new_submaps;
+        ch.outside_cache_dirty = old.outside;
+        ch.outside_cache_dirty_submaps = shift_submap_bits( old.outside_submaps, sp ) | near_new_submaps;
+        ch.floor_cache_dirty = old.floor;
+        ch.floor_cache_dirty_submaps = shift_submap_bits( old.floor_submaps, sp ) | new_submaps;
+        pf.dirty = old.pathfinding;
+        pf.dirty_submaps = shift_submap_bits( old.pathfinding_submaps, sp ) | new_submaps;
+        // Vehicle footprints are in local coordinates.  Move them along, so the tiles they
+        // wrote to are dirtied when they get rebuilt, which is forced as parts may have
+        // entered the bubble.
+        const diagonal_blocks no_blocks = { false, false };
+        std::fill_n( &ch.vehicle_obscured_cache[0][0], MAPSIZE_X * MAPSIZE_Y, no_blocks );
+        std::fill_n( &ch.vehicle_obstructed_cache[0][0], MAPSIZE_X * MAPSIZE_Y, no_blocks );
+        for( std::pair<vehicle *const, vehicle_cache_footprint> &e : ch.vehicle_footprints ) {
+            vehicle_cache_footprint &fp = e.second;
+            fp.revision = 0;
+            fp.diagonals.clear();
+            for( std::vector<tripoint> *tiles : {
+                     &fp.opaque, &fp.covered, &fp.floor
+                 } ) {
+                for( tripoint &p : *tiles ) {
+                    p += shift_offset_pt;
+                }
+                tiles->erase( std::remove_if( tiles->begin(), tiles->end(), [&]( const tripoint & p ) {
+                    return !boundaries_2d.contains( p.xy() );
+                } ), tiles->end() );
+            }
+        }
+        // The static light layer isn't moved, its inputs are compared per tile
+        ch.static_light_valid = false;
+        // The suspension cache is in absolute coordinates.  Forget the tiles that were
+        // unloaded and add the ones on the new edge.
+        if( ch.suspension_cache_initialized ) {
+            ch.suspension_cache.remove_if( [this]( const point & absp ) {
+                return !inbounds( getlocal( absp ) );
+            } );
+            for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+                for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                    if( new_submaps[gridx * MAPSIZE + gridy] ) {
+                        cache_suspended_tiles( { gridx, gridy, gridz } );
+                    }
+                }
+            }
+            ch.suspension_cache_dirty = true;
+        }
+    }
+
     reset_vehicle_cache( );
 
     g->setremoteveh( remoteveh );
@@ -7144,6 +7321,7 @@ void map::saven( const tripoint &grid )
     }
 
     submap_to_save->last_touched = calendar::turn;
+    submap_to_save->modified = true;
     MAPBUFFER.add_submap( abs, submap_to_save );
 }
 
@@ -7209,6 +7387,8 @@ void map::loadn( const tripoint &grid, const bool update_vehicles )
             return;
         }
     }
+    // Anything done through the map may change it, not every map is saved afterwards
+    tmpsub->modified = true;
 
     // New submap changes the content of the map and all caches must be recalculated
     set_transparency_cache_dirty( grid.z );
@@ -7316,8 +7496,8 @@ void map::handle_decayed_corpse( const item &it, const tripoint &pnt )
             }
             for( int i = 0; i < roll; i++ ) {
                 // This sanity-checks harvest yields that have a default stack amount, e.g. copper wire from cyborgs
-                if( harvest->charges > 1 ) {
-                    harvest->charges = 1;
+                if( harvest->charges() > 1 ) {
+                    harvest->set_charges( 1 );
                 }
                 if( !harvest->rotten() ) {
                     add_item_or_charges( pnt, item::spawn( *harvest ) );
@@ -7585,7 +7765,7 @@ void map::produce_sap( const tripoint &p, const time_duration &time_since_last_a
 
                 // The environment might have poisoned the sap with animals passing by, insects, leaves or contaminants in the ground
                 sap->poison = one_in( 10 ) ? 1 : 0;
-                sap->charges = new_charges;
+                sap->set_charges( new_charges );
 
                 it->fill_with( std::move( sap ) );
             }
@@ -7763,15 +7943,6 @@ void map::add_roofs( const tripoint &grid )
     }
 }
 
-void map::copy_grid( const tripoint &to, const tripoint &from )
-{
-    const auto smap = get_submap_at_grid( from );
-    setsubmap( get_nonant( to ), smap );
-    for( auto &it : smap->vehicles ) {
-        it->sm_pos = to;
-    }
-}
-
 void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool ignore_sight )
 {
     const int s_range = std::min( HALF_MAPSIZE_X,
@@ -8162,8 +8333,13 @@ void map::build_outside_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
     if( !ch.outside_cache_dirty ) {
+        if( ch.outside_cache_dirty_submaps.any() ) {
+            build_outside_cache_submaps( zlev );
+        }
         return;
     }
+    ch.outside_cache_dirty_submaps.reset();
+    ch.vehicle_footprints_stale = true;
 
     // Make a bigger cache to avoid bounds checking
     // We will later copy it to our regular cache
@@ -8212,6 +8388,50 @@ void map::build_outside_cache( const int zlev )
     ch.outside_cache_dirty = false;
 }
 
+void map::build_outside_cache_submaps( const int zlev )
+{
+    auto &ch = get_cache( zlev );
+    auto &outside_cache = ch.outside_cache;
+    const int size_x = SEEX * my_MAPSIZE;
+    const int size_y = SEEY * my_MAPSIZE;
+    const auto indoors = [&]( int x, int y ) {
+        const submap *cur_submap = get_submap_at_grid( { x / SEEX, y / SEEY, zlev } );
+        const point sp( x % SEEX, y % SEEY );
+        return cur_submap->get_ter( sp ).obj().has_flag( TFLAG_INDOORS ) ||
+               cur_submap->get_furn( sp ).obj().has_flag( TFLAG_INDOORS );
+    };
+
+    if( zlev < 0 ) {
+        // Underground is never outside, see build_outside_cache
+        ch.outside_cache_dirty_submaps.reset();
+        return;
+    }
+    ch.vehicle_footprints_stale = true;
+    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            if( !ch.outside_cache_dirty_submaps[smx * MAPSIZE + smy] ) {
+                continue;
+            }
+            // Tiles next to the submap depend on it too
+            for( int x = std::max( smx * SEEX - 1, 0 ); x <= std::min( ( smx + 1 ) * SEEX, size_x - 1 ); x++ ) {
+                for( int y = std::max( smy * SEEY - 1, 0 ); y <= std::min( ( smy + 1 ) * SEEY, size_y - 1 ); y++ ) {
+                    bool outside = true;
+                    for( int nx = std::max( x - 1, 0 ); nx <= std::min( x + 1, size_x - 1 ) && outside; nx++ ) {
+                        for( int ny = std::max( y - 1, 0 ); ny <= std::min( y + 1, size_y - 1 ); ny++ ) {
+                            if( indoors( nx, ny ) ) {
+                                outside = false;
+                                break;
+                            }
+                        }
+                    }
+                    outside_cache[x][y] = outside;
+                }
+            }
+        }
+    }
+    ch.outside_cache_dirty_submaps.reset();
+}
+
 void map::build_obstacle_cache( const tripoint &start, const tripoint &end,
                                 float( &obstacle_cache )[MAPSIZE_X][MAPSIZE_Y] )
 {
@@ -8268,17 +8488,28 @@ void map::build_obstacle_cache( const tripoint &start, const tripoint &end,
 bool map::build_floor_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
-    if( !ch.floor_cache_dirty ) {
+    const bool rebuild_all = ch.floor_cache_dirty;
+    if( !rebuild_all && ch.floor_cache_dirty_submaps.none() ) {
         return false;
     }
 
     auto &floor_cache = ch.floor_cache;
-    std::uninitialized_fill_n(
-        &floor_cache[0][0], ( MAPSIZE_X ) * ( MAPSIZE_Y ), true );
+    if( rebuild_all ) {
+        std::uninitialized_fill_n(
+            &floor_cache[0][0], ( MAPSIZE_X ) * ( MAPSIZE_Y ), true );
+    }
 
     bool lowest_z_lev = zlev <= -OVERMAP_DEPTH;
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            if( !rebuild_all ) {
+                if( !ch.floor_cache_dirty_submaps[smx * MAPSIZE + smy] ) {
+                    continue;
+                }
+                for( int x = smx * SEEX; x < ( smx + 1 ) * SEEX; x++ ) {
+                    std::fill_n( &floor_cache[x][smy * SEEY], SEEY, true );
+                }
+            }
             const submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
             const submap *below_submap = !lowest_z_lev ? get_submap_at_grid( { smx, smy, zlev - 1 } ) : nullptr;
 
@@ -8310,6 +8541,8 @@ bool map::build_floor_cache( const int zlev )
     }
 
     ch.floor_cache_dirty = false;
+    ch.floor_cache_dirty_submaps.reset();
+    ch.vehicle_footprints_stale = true;
     return zlevels;
 }
 
@@ -8334,25 +8567,7 @@ void map::update_suspension_cache( const int &z )
     if( !ch.suspension_cache_initialized ) {
         for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
             for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
-                const submap *cur_submap = get_submap_at_grid( { smx, smy, z } );
-
-                if( cur_submap == nullptr ) {
-                    debugmsg( "Tried to run suspension check at (%d,%d,%d) but the submap is not loaded", smx, smy,
-                              z );
-                    continue;
-                }
-
-                for( int sx = 0; sx < SEEX; ++sx ) {
-                    for( int sy = 0; sy < SEEY; ++sy ) {
-                        point sp( sx, sy );
-                        const ter_t &terrain = cur_submap->get_ter( sp ).obj();
-                        if( terrain.has_flag( TFLAG_SUSPENDED ) ) {
-                            tripoint loc( coords::project_combine( point_om_sm( point( smx, smy ) ), point_sm_ms( sp ) ).raw(),
-                                          z );
-                            suspension_cache.emplace_back( getabs( loc ).xy() );
-                        }
-                    }
-                }
+                cache_suspended_tiles( { smx, smy, z } );
             }
         }
         ch.suspension_cache_initialized = true;
@@ -8388,105 +8603,196 @@ void map::update_suspension_cache( const int &z )
     ch.suspension_cache_dirty = false;
 }
 
-static void vehicle_caching_internal( level_cache &zch, const vpart_reference &vp, vehicle *v )
+void map::cache_suspended_tiles( const tripoint &grid )
 {
-    auto &outside_cache = zch.outside_cache;
-    auto &transparency_cache = zch.transparency_cache;
-    auto &floor_cache = zch.floor_cache;
-    auto &obscured_cache = zch.vehicle_obscured_cache;
-    auto &obstructed_cache = zch.vehicle_obstructed_cache;
-
-    const size_t part = vp.part_index();
-    const tripoint &part_pos =  v->global_part_pos3( vp.part() );
-
-    bool vehicle_is_opaque = vp.has_feature( VPFLAG_OPAQUE ) && !vp.part().is_broken();
-
-    if( vehicle_is_opaque ) {
-        int dpart = v->part_with_feature( part, VPFLAG_OPENABLE, true );
-        if( dpart < 0 || !v->part( dpart ).open ) {
-            transparency_cache[part_pos.x][part_pos.y] = LIGHT_TRANSPARENCY_SOLID;
-        } else {
-            vehicle_is_opaque = false;
-        }
-    }
-
-    if( vehicle_is_opaque || vp.is_inside() ) {
-        outside_cache[part_pos.x][part_pos.y] = false;
+    const submap *cur_submap = get_submap_at_grid( grid );
+    if( cur_submap == nullptr ) {
+        debugmsg( "Tried to run suspension check at (%d,%d,%d) but the submap is not loaded", grid.x,
+                  grid.y, grid.z );
+        return;
     }
-
-    if( vp.has_feature( VPFLAG_BOARDABLE ) && !vp.part().is_broken() ) {
-        floor_cache[part_pos.x][part_pos.y] = true;
+    std::list<point> &suspension_cache = get_cache( grid.z ).suspension_cache;
+    for( int sx = 0; sx < SEEX; ++sx ) {
+        for( int sy = 0; sy < SEEY; ++sy ) {
+            point sp( sx, sy );
+            const ter_t &terrain = cur_submap->get_ter( sp ).obj();
+            if( terrain.has_flag( TFLAG_SUSPENDED ) ) {
+                tripoint loc( coords::project_combine( point_om_sm( grid.xy() ), point_sm_ms( sp ) ).raw(),
+                              grid.z );
+                suspension_cache.emplace_back( getabs( loc ).xy() );
+            }
+        }
     }
+}
 
-    point t = v->tripoint_to_mount( part_pos + point_north_west );
-    if( !v->allowed_light( t, vp.mount() ) ) {
-        obscured_cache[part_pos.x][part_pos.y].nw = true;
-    }
-    if( !v->allowed_move( t, vp.mount() ) ) {
-        obstructed_cache[part_pos.x][part_pos.y].nw = true;
-    }
+static vehicle_cache_footprint build_vehicle_footprint( const map &m, vehicle &v )
+{
+    vehicle_cache_footprint fp;
+    fp.pos = v.global_pos3();
+    fp.rotation = v.pivot_rotation[0];
+    fp.pivot = v.pivot_anchor[0];
+    fp.revision = v.get_footprint_revision();
 
-    t = v->tripoint_to_mount( part_pos + point_north_east );
-    if( !v->allowed_light( t, vp.mount() ) ) {
-        obscured_cache[part_pos.x][part_pos.y].ne = true;
-    }
-    if( !v->allowed_move( t, vp.mount() ) ) {
-        obstructed_cache[part_pos.x][part_pos.y].ne = true;
-    }
+    for( const vpart_reference &vp : v.get_all_parts() ) {
+        const tripoint part_pos = v.global_part_pos3( vp.part() );
+        if( !m.inbounds( part_pos.xy() ) || vp.part().removed ) {
+            continue;
+        }
 
-    if( part_pos.x > 0 && part_pos.y < MAPSIZE_Y - 1 ) {
-        t = v->tripoint_to_mount( part_pos + point_south_west );
-        if( !v->allowed_light( t, vp.mount() ) ) {
-            obscured_cache[part_pos.x - 1][part_pos.y + 1].ne = true;
+        bool vehicle_is_opaque = vp.has_feature( VPFLAG_OPAQUE ) && !vp.part().is_broken();
+        if( vehicle_is_opaque ) {
+            int dpart = v.part_with_feature( vp.part_index(), VPFLAG_OPENABLE, true );
+            if( dpart < 0 || !v.part( dpart ).open ) {
+                fp.opaque.push_back( part_pos );
+            } else {
+                vehicle_is_opaque = false;
+            }
         }
-        if( !v->allowed_move( t, vp.mount() ) ) {
-            obstructed_cache[part_pos.x - 1][part_pos.y + 1].ne = true;
+        if( vehicle_is_opaque || vp.is_inside() ) {
+            fp.covered.push_back( part_pos );
+        }
+        if( vp.has_feature( VPFLAG_BOARDABLE ) && !vp.part().is_broken() ) {
+            fp.floor.push_back( part_pos );
+        }
+        if( part_pos.z < OVERMAP_HEIGHT &&
+            ( vp.has_feature( VPFLAG_ROOF ) || vp.has_feature( VPFLAG_OPAQUE ) ) ) {
+            fp.floor.push_back( part_pos + tripoint_above );
         }
-    }
 
-    if( part_pos.x < MAPSIZE_X - 1 && part_pos.y < MAPSIZE_Y - 1 ) {
-        t = v->tripoint_to_mount( part_pos + point_south_east );
-        if( !v->allowed_light( t, vp.mount() ) ) {
-            obscured_cache[part_pos.x + 1][part_pos.y + 1].nw = true;
+        // Blocks for light and movement entering the tile at p diagonally
+        const auto add_diagonal = [&]( const tripoint & p, point dir, bool nw ) {
+            const point t = v.tripoint_to_mount( part_pos + dir );
+            const bool obscured = !v.allowed_light( t, vp.mount() );
+            const bool obstructed = !v.allowed_move( t, vp.mount() );
+            if( obscured || obstructed ) {
+                const diagonal_blocks obscured_blocks = { nw && obscured, !nw && obscured };
+                const diagonal_blocks obstructed_blocks = { nw && obstructed, !nw && obstructed };
+                fp.diagonals.push_back( { p, obscured_blocks, obstructed_blocks } );
+            }
+        };
+        add_diagonal( part_pos, point_north_west, true );
+        add_diagonal( part_pos, point_north_east, false );
+        if( part_pos.x > 0 && part_pos.y < MAPSIZE_Y - 1 ) {
+            add_diagonal( part_pos + point_south_west, point_south_west, false );
         }
-        if( !v->allowed_move( t, vp.mount() ) ) {
-            obstructed_cache[part_pos.x + 1][part_pos.y + 1].nw = true;
+        if( part_pos.x < MAPSIZE_X - 1 && part_pos.y < MAPSIZE_Y - 1 ) {
+            add_diagonal( part_pos + point_south_east, point_south_east, true );
         }
     }
+    return fp;
 }
 
-static void vehicle_caching_internal_above( level_cache &zch_above, const vpart_reference &vp,
-        vehicle *v )
+static void set_diagonal_blocks( diagonal_blocks &cache, const diagonal_blocks &blocks,
+                                 bool value )
 {
-    if( vp.has_feature( VPFLAG_ROOF ) || vp.has_feature( VPFLAG_OPAQUE ) ) {
-        const tripoint &part_pos = v->global_part_pos3( vp.part() );
-        zch_above.floor_cache[part_pos.x][part_pos.y] = true;
+    if( blocks.nw ) {
+        cache.nw = value;
+    }
+    if( blocks.ne ) {
+        cache.ne = value;
     }
 }
 
-void map::do_vehicle_caching( int z )
+void map::update_vehicle_footprints( const int z )
 {
     level_cache &ch = get_cache( z );
+    std::vector<tripoint> cleared;
+    std::set<vehicle *> rebuilt;
+
+    // Terrain caches under the old footprint have to be rebuilt, the diagonal ones are
+    // cleared here and refilled from the remaining footprints below
+    const auto forget = [&]( const vehicle_cache_footprint & fp ) {
+        for( const vehicle_cache_footprint::diagonal &d : fp.diagonals ) {
+            level_cache &dc = get_cache( d.p.z );
+            set_diagonal_blocks( dc.vehicle_obscured_cache[d.p.x][d.p.y], d.obscured, false );
+            set_diagonal_blocks( dc.vehicle_obstructed_cache[d.p.x][d.p.y], d.obstructed, false );
+            cleared.push_back( d.p );
+        }
+        for( const tripoint &p : fp.opaque ) {
+            set_transparency_cache_dirty( p );
+        }
+        for( const tripoint &p : fp.covered ) {
+            get_cache( p.z ).outside_cache_dirty_submaps.set( p.x / SEEX * MAPSIZE + p.y / SEEY );
+        }
+        for( const tripoint &p : fp.floor ) {
+            get_cache( p.z ).floor_cache_dirty_submaps.set( p.x / SEEX * MAPSIZE + p.y / SEEY );
+        }
+    };
+
+    for( auto it = ch.vehicle_footprints.begin(); it != ch.vehicle_footprints.end(); ) {
+        // Don't touch the vehicle, it may be gone already
+        if( ch.vehicle_list.count( it->first ) == 0 ) {
+            forget( it->second );
+            it = ch.vehicle_footprints.erase( it );
+        } else {
+            ++it;
+        }
+    }
+
     for( vehicle *v : ch.vehicle_list ) {
-        for( const vpart_reference &vp : v->get_all_parts() ) {
-            const tripoint &part_pos = v->global_part_pos3( vp.part() );
-            if( !inbounds( part_pos.xy() ) || vp.part().removed ) {
+        const auto it = ch.vehicle_footprints.find( v );
+        if( it != ch.vehicle_footprints.end() ) {
+            const vehicle_cache_footprint &old = it->second;
+            if( old.revision == v->get_footprint_revision() && old.pos == v->global_pos3() &&
+                old.rotation == v->pivot_rotation[0] && old.pivot == v->pivot_anchor[0] ) {
                 continue;
             }
-            vehicle_caching_internal( get_cache( part_pos.z ), vp, v );
-            if( part_pos.z < OVERMAP_HEIGHT ) {
-                vehicle_caching_internal_above( get_cache( part_pos.z + 1 ), vp, v );
+            forget( old );
+        }
+        vehicle_cache_footprint &fp = ch.vehicle_footprints[v];
+        fp = build_vehicle_footprint( *this, *v );
+        // The static light layer only looks at dirty transparency
+        for( const tripoint &p : fp.opaque ) {
+            set_transparency_cache_dirty( p );
+        }
+        rebuilt.insert( v );
+    }
+
+    if( cleared.empty() && rebuilt.empty() ) {
+        return;
+    }
+    ch.vehicle_footprints_stale = true;
+    // Vehicles that stayed put may block the same corners as the ones that changed
+    std::sort( cleared.begin(), cleared.end() );
+    for( const std::pair<vehicle *const, vehicle_cache_footprint> &e : ch.vehicle_footprints ) {
+        const bool fresh = rebuilt.count( e.first ) > 0;
+        for( const vehicle_cache_footprint::diagonal &d : e.second.diagonals ) {
+            if( fresh || std::binary_search( cleared.begin(), cleared.end(), d.p ) ) {
+                level_cache &dc = get_cache( d.p.z );
+                set_diagonal_blocks( dc.vehicle_obscured_cache[d.p.x][d.p.y], d.obscured, true );
+                set_diagonal_blocks( dc.vehicle_obstructed_cache[d.p.x][d.p.y], d.obstructed, true );
             }
         }
     }
 }
 
+void map::apply_vehicle_footprints( const int z )
+{
+    for( const std::pair<vehicle *const, vehicle_cache_footprint> &e :
+         get_cache( z ).vehicle_footprints ) {
+        const vehicle_cache_footprint &fp = e.second;
+        for( const tripoint &p : fp.opaque ) {
+            get_cache( p.z ).transparency_cache[p.x][p.y] = LIGHT_TRANSPARENCY_SOLID;
+        }
+        for( const tripoint &p : fp.covered ) {
+            get_cache( p.z ).outside_cache[p.x][p.y] = false;
+        }
+        for( const tripoint &p : fp.floor ) {
+            get_cache( p.z ).floor_cache[p.x][p.y] = true;
+        }
+    }
+}
+
 void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
-    ZoneScoped;
+    ZoneScopedN( "map::build_map_cache" );
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
+    // Before the terrain based caches, as it marks the tiles vehicles left dirty there
+    for( int z = minz; z <= maxz; z++ ) {
+        update_vehicle_footprints( z );
+    }
     for( int z = minz; z <= maxz; z++ ) {
         // trigger FOV recalculation only when there is a change on the player's level or if fov_3d is enabled
         const bool affects_seen_cache =  z == zlev || fov_3d;
@@ -8495,16 +8801,17 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
         update_suspension_cache( z );
         seen_cache_dirty |= ( build_floor_cache( z ) && affects_seen_cache );
         seen_cache_dirty |= get_cache( z ).seen_cache_dirty && affects_seen_cache;
-        diagonal_blocks fill = {false, false};
-        std::uninitialized_fill_n( &( get_cache( z ).vehicle_obscured_cache[0][0] ), MAPSIZE_X * MAPSIZE_Y,
-                                   fill );
-        std::uninitialized_fill_n( &( get_cache( z ).vehicle_obstructed_cache[0][0] ),
-                                   MAPSIZE_X * MAPSIZE_Y, fill );
     }
     // needs a separate pass as it changes the caches on neighbour z-levels (e.g. floor_cache);
     // otherwise such changes might be overwritten by main cache-building logic
     for( int z = minz; z <= maxz; z++ ) {
-        do_vehicle_caching( z );
+        if( get_cache( z ).vehicle_footprints_stale ||
+            ( z < maxz && get_cache( z + 1 ).vehicle_footprints_stale ) ) {
+            apply_vehicle_footprints( z );
+        }
+    }
+    for( int z = minz; z <= maxz; z++ ) {
+        get_cache( z ).vehicle_footprints_stale = false;
     }
 
     seen_cache_dirty |= build_vision_transparency_cache( get_player_character() );
@@ -8604,11 +8911,19 @@ size_t map::get_nonant( const tripoint &gridp ) const
 {
     // There used to be a bounds check here
     // But this function is called a lot, so push it up if needed
+    int x = gridp.x + grid_origin.x;
+    if( x >= my_MAPSIZE ) {
+        x -= my_MAPSIZE;
+    }
+    int y = gridp.y + grid_origin.y;
+    if( y >= my_MAPSIZE ) {
+        y -= my_MAPSIZE;
+    }
     if( zlevels ) {
         const int indexz = gridp.z + OVERMAP_HEIGHT; // Can't be lower than 0
-        return indexz + ( gridp.x + gridp.y * my_MAPSIZE ) * OVERMAP_LAYERS;
+        return indexz + ( x + y * my_MAPSIZE ) * OVERMAP_LAYERS;
     } else {
-        return gridp.x + gridp.y * my_MAPSIZE;
+        return x + y * my_MAPSIZE;
     }
 }
 
@@ -9038,12 +9353,17 @@ level_cache::level_cache()
     std::fill_n( &lm[0][0], map_dimensions, four_zeros );
     std::fill_n( &sm[0][0], map_dimensions, 0.0f );
     std::fill_n( &light_source_buffer[0][0], map_dimensions, 0.0f );
+    std::fill_n( &static_lm[0][0], map_dimensions, four_zeros );
+    std::fill_n( &static_sm[0][0], map_dimensions, 0.0f );
+    std::fill_n( &static_light_sources[0][0], map_dimensions, 0.0f );
+    std::fill_n( &static_light_transparency[0][0], map_dimensions, 0.0f );
     std::fill_n( &outside_cache[0][0], map_dimensions, false );
     std::fill_n( &floor_cache[0][0], map_dimensions, false );
     std::fill_n( &transparency_cache[0][0], map_dimensions, 0.0f );
     diagonal_blocks fill = {false, false};
     std::fill_n( &vehicle_obscured_cache[0][0], map_dimensions, fill );
     std::fill_n( &vehicle_obstructed_cache[0][0], map_dimensions, fill );
+    std::fill_n( &static_light_obscured[0][0], map_dimensions, fill );
     std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &camera_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &visibility_cache[0][0], map_dimensions, lit_level::DARK );
@@ -9097,6 +9417,7 @@ void map::invalidate_map_cache( const int zlev )
         ch.seen_cache_dirty = true;
         ch.outside_cache_dirty = true;
         ch.suspension_cache_dirty = true;
+        ch.static_light_valid = false;
     }
 }
 
@@ -9115,7 +9436,7 @@ const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
         return *pathfinding_caches[ OVERMAP_DEPTH ];
     }
     auto &cache = get_pathfinding_cache( zlev );
-    if( cache.dirty ) {
+    if( cache.dirty || cache.dirty_submaps.any() ) {
         update_pathfinding_cache( zlev );
     }
 
@@ -9125,17 +9446,24 @@ const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
 void map::update_pathfinding_cache( int zlev ) const
 {
     auto &cache = get_pathfinding_cache( zlev );
-    if( !cache.dirty ) {
+    const bool rebuild_all = cache.dirty;
+    if( !rebuild_all && cache.dirty_submaps.none() ) {
         return;
     }
 
-    std::uninitialized_fill_n( &cache.special[0][0], MAPSIZE_X * MAPSIZE_Y, PF_NORMAL );
+    if( rebuild_all ) {
+        std::uninitialized_fill_n( &cache.special[0][0], MAPSIZE_X * MAPSIZE_Y, PF_NORMAL );
+    }
 
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            if( !rebuild_all && !cache.dirty_submaps[smx * MAPSIZE + smy] ) {
+                continue;
+            }
             const auto cur_submap = get_submap_at_grid( { smx, smy, zlev } );
             if( !cur_submap ) {
-                return;
+                // Leave its tiles as they are, but still update the rest of the level
+                continue;
             }
 
             tripoint p( 0, 0, zlev );
@@ -9199,6 +9527,7 @@ void map::update_pathfinding_cache( int zlev ) const
     }
 
     cache.dirty = false;
+    cache.dirty_submaps.reset();
 }
 
 void map::clip_to_bounds( tripoint &p ) const
@@ -297,6 +297,37 @@ struct diagonal_blocks {
     bool ne;
 };
 
+// A vehicle part in level_cache::veh_parts_at
+struct vehicle_part_slot {
+    // Index into level_cache::veh_slots
+    uint32_t slot = 0;
+    int part = -1;
+};
+
+// What one vehicle contributes to the caches of a level_cache, see map::update_vehicle_footprints
+struct vehicle_cache_footprint {
+    struct diagonal {
+        tripoint p;
+        diagonal_blocks obscured;
+        diagonal_blocks obstructed;
+    };
+
+    // Where and how the vehicle was placed when this was built, and its parts' state
+    tripoint pos;
+    units::angle rotation = 0_degrees;
+    point pivot;
+    uint64_t revision = 0;
+
+    // Tiles solid in transparency_cache
+    std::vector<tripoint> opaque;
+    // Tiles not outside in outside_cache
+    std::vector<tripoint> covered;
+    // Tiles with floor in floor_cache, including the level above for roofs
+    std::vector<tripoint> floor;
+    // Entries set in vehicle_obscured_cache and vehicle_obstructed_cache
+    std::vector<diagonal> diagonals;
+};
+
 struct level_cache {
     // Zeros all relevant values
     level_cache();
@@ -305,6 +336,9 @@ struct level_cache {
     std::bitset<MAPSIZE *MAPSIZE> transparency_cache_dirty;
     bool outside_cache_dirty = false;
     bool floor_cache_dirty = false;
+    // Submaps to rebuild when the whole level isn't dirty, e.g. after map::shift
+    std::bitset<MAPSIZE *MAPSIZE> outside_cache_dirty_submaps;
+    std::bitset<MAPSIZE *MAPSIZE> floor_cache_dirty_submaps;
     bool seen_cache_dirty = false;
     bool suspension_cache_initialized = false;
     bool suspension_cache_dirty = false;
@@ -316,6 +350,18 @@ struct level_cache {
     // This is only valid for the duration of generate_lightmap
     float light_source_buffer[MAPSIZE_X][MAPSIZE_Y];
 
+    // Light cast from light_source_buffer, kept between lightmap updates and only
+    // recast around tiles whose sources, transparency or vehicle blocks changed.
+    bool static_light_valid = false;
+    // Submaps whose transparency was rebuilt since static_light was cast
+    std::bitset<MAPSIZE *MAPSIZE> static_light_transparency_dirty;
+    four_quadrants static_lm[MAPSIZE_X][MAPSIZE_Y];
+    float static_sm[MAPSIZE_X][MAPSIZE_Y];
+    // Inputs static_lm was cast from, compared against to find what changed
+    float static_light_sources[MAPSIZE_X][MAPSIZE_Y];
+    float static_light_transparency[MAPSIZE_X][MAPSIZE_Y];
+    diagonal_blocks static_light_obscured[MAPSIZE_X][MAPSIZE_Y];
+
     // if false, means tile is under the roof ("inside"), true means tile is "outside"
     // "inside" tiles are protected from sun, rain, etc. (see "INDOORS" flag)
     bool outside_cache[MAPSIZE_X][MAPSIZE_Y];
@@ -337,6 +383,13 @@ struct level_cache {
     // same as above but for obstruction rather than light
     diagonal_blocks vehicle_obstructed_cache[MAPSIZE_X][MAPSIZE_Y];
 
+    // What each vehicle in vehicle_list wrote to the caches, so only vehicles that moved,
+    // turned or changed parts have to be redone
+    std::map<vehicle *, vehicle_cache_footprint> vehicle_footprints;
+    // Set when transparency, outside or floor cache was rebuilt from terrain, which wipes
+    // the vehicle footprints written there
+    bool vehicle_footprints_stale = true;
+
     // stores "visibility" of the tiles to the player
     // values range from 1 (fully visible to player) to 0 (not visible)
     float seen_cache[MAPSIZE_X][MAPSIZE_Y];
@@ -352,7 +405,12 @@ struct level_cache {
 
     bool veh_in_active_range;
     bool veh_exists_at[MAPSIZE_X][MAPSIZE_Y];
-    std::map< tripoint, std::pair<vehicle *, int> > veh_cached_parts;
+    // Part at each tile where veh_exists_at is set, see map::veh_at
+    vehicle_part_slot veh_parts_at[MAPSIZE_X][MAPSIZE_Y];
+    // Vehicles referenced by veh_parts_at, a vehicle keeps its slot until the cache is cleared
+    std::vector<vehicle *> veh_slots;
+    // Parts of overlapping vehicles hidden under the one in veh_parts_at
+    std::vector<std::pair<point, vehicle_part_slot>> veh_overlapped_parts;
     std::set<vehicle *> vehicle_list;
     std::set<vehicle *> zone_vehicles;
 
@@ -954,6 +1012,15 @@ class map
         bool has_flag_ter_or_furn( ter_bitflags flag, point p ) const {
             return has_flag_ter_or_furn( flag, tripoint( p, abs_sub.z ) );
         }
+        // Flags without a ter_bitflags entry, by their dense index
+        // Checks terrain, furniture and vehicles
+        bool has_flag( const ter_furn_flag &flag, const tripoint &p ) const;
+        // Checks terrain
+        bool has_flag_ter( const ter_furn_flag &flag, const tripoint &p ) const;
+        // Checks furniture
+        bool has_flag_furn( const ter_furn_flag &flag, const tripoint &p ) const;
+        // Checks terrain or furniture
+        bool has_flag_ter_or_furn( const ter_furn_flag &flag, const tripoint &p ) const;
 
         // Bashable
         /** Returns true if there is a bashable vehicle part or the furn/terrain is bashable at p */
@@ -1537,7 +1604,12 @@ class map
         bool is_cornerfloor( const tripoint &p ) const;
 
         // mapgen.cpp functions
-        void generate( const tripoint &p, const time_point &when );
+        /**
+         * Generates the overmap terrain whose first submap is @p p and saves it to MAPBUFFER.
+         * If @p keep_submaps is given, the generated submaps are moved there instead of being saved.
+         */
+        void generate( const tripoint &p, const time_point &when,
+                       std::vector<std::unique_ptr<submap>> *keep_submaps = nullptr );
         void place_spawns( const mongroup_id &group, int chance,
                            point p1, point p2, float density,
                            bool individual = false, bool friendly = false, const std::string &name = "NONE",
@@ -1557,7 +1629,14 @@ class map
         void add_spawn( const mtype_id &type, int count, const tripoint &p,
                         spawn_disposition disposition, int faction_id = -1, int mission_id = -1,
                         const std::string &name = "NONE" ) const;
-        void do_vehicle_caching( int z );
+        /**
+         * Rebuilds the footprints of vehicles on level z that moved, turned or had parts changed,
+         * and of vehicles that left it. Their old tiles are marked dirty in the terrain based caches,
+         * and the diagonal vehicle caches are updated in place.
+         */
+        void update_vehicle_footprints( int z );
+        /** Writes the footprints of vehicles on level z over the terrain based caches. */
+        void apply_vehicle_footprints( int z );
         // Note: in 3D mode, will actually build caches on ALL z-levels
         void build_map_cache( int zlev, bool skip_lightmap = false );
         // Unlike the other caches, this populates a supplied cache instead of an internal cache.
@@ -1758,7 +1837,6 @@ class map
          */
         void shift_traps( const tripoint &shift );
 
-        void copy_grid( const tripoint &to, const tripoint &from );
         void draw_map( mapgendata &dat );
 
         void draw_office_tower( const mapgendata &dat );
@@ -1776,6 +1854,8 @@ class map
         void build_sunlight_cache( int pzlev );
     public:
         void build_outside_cache( int zlev );
+        // Rebuilds only the tiles depending on outside_cache_dirty_submaps
+        void build_outside_cache_submaps( int zlev );
         // Builds a floor cache and returns true if the cache was invalidated.
         // Used to determine if seen cache should be rebuilt.
         bool build_floor_cache( int zlev );
@@ -1784,7 +1864,11 @@ class map
         // Checks all suspended tiles on a z level and adds those that are invalid to the support_dirty_cache */
         void update_suspension_cache( const int &z );
     protected:
+        // Adds the suspended tiles of the submap at grid position @p grid to its level's suspension_cache
+        void cache_suspended_tiles( const tripoint &grid );
         void generate_lightmap( int zlev );
+        // Recasts the buffered light sources whose light may have changed into static_lm
+        void update_static_lightmap( int zlev );
         void build_seen_cache( const tripoint &origin, int target_z );
         void apply_character_light( Character &p );
 
@@ -1852,6 +1936,7 @@ class map
         /**
          * Get the index of a submap pointer in the grid given by grid coordinates. The grid
          * coordinates must be valid: 0 <= x < my_MAPSIZE, same for y.
+         * This is the only place that knows about the ring buffer layout of @ref grid.
          * Version with z-levels checks for z between -OVERMAP_DEPTH and OVERMAP_HEIGHT
          */
         size_t get_nonant( const tripoint &gridp ) const;
@@ -1965,8 +2050,12 @@ class map
          * The list of currently loaded submaps. The size of this should not be changed.
          * After calling @ref load or @ref generate, it should only contain non-null pointers.
          * Use @ref getsubmap or @ref setsubmap to access it.
+         * It is a ring buffer in x and y: @ref get_nonant maps grid coordinates to indices,
+         * offset by @ref grid_origin, so @ref shift only has to replace the submaps at the edge.
          */
         std::vector<submap *> grid;
+        /** Where grid coordinate (0, 0) is stored in @ref grid, both in [0, my_MAPSIZE). */
+        point grid_origin;
         /**
          * This vector contains an entry for each trap type, it has therefor the same size
          * as the traplist vector. Each entry contains a list of all point on the map that
@@ -141,7 +141,7 @@ int map::burn_body_part( player &u, field_entry &cur, body_part bp, const int sc
 
 void map::process_fields()
 {
-    ZoneScoped;
+    ZoneScopedN( "map::process_fields" );
 
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
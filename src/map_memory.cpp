@@ -1,5 +1,7 @@
 #include "map_memory.h"
 
+#include <unordered_map>
+
 #include "coordinate_conversions.h"
 #include "cuboid_rectangle.h"
 #include "debug.h"
@@ -9,13 +11,46 @@
 #include "line.h"
 #include "translations.h"
 #include "map.h"
-const memorized_terrain_tile mm_submap::default_tile { "", 0, 0 };
+const memorized_terrain_tile mm_submap::default_tile {};
 const int mm_submap::default_symbol = 0;
 
 #define MM_SIZE (MAPSIZE * 2)
 
 #define dbg(x) DebugLog((x),DC::MapMem)
 
+namespace
+{
+struct memorized_tile_names {
+    std::vector<std::string> names = { std::string() };
+    std::unordered_map<std::string, std::uint32_t> ids = { { std::string(), 0 } };
+};
+} // namespace
+
+static memorized_tile_names &get_memorized_tile_names()
+{
+    static memorized_tile_names singleton;
+    return singleton;
+}
+
+memorized_tile_id::memorized_tile_id( const std::string &name )
+{
+    memorized_tile_names &table = get_memorized_tile_names();
+    // Names are almost always known already, so look up before building a node
+    const auto iter = table.ids.find( name );
+    if( iter != table.ids.end() ) {
+        id = iter->second;
+        return;
+    }
+    id = static_cast<std::uint32_t>( table.names.size() );
+    table.ids.emplace( name, id );
+    table.names.push_back( name );
+}
+
+const std::string &memorized_tile_id::str() const
+{
+    return get_memorized_tile_names().names[id];
+}
+
 static std::string find_legacy_mm_file()
 {
     return g->get_player_base_save_path() + ".mm";
@@ -97,7 +132,11 @@ void map_memory::memorize_tile( const tripoint &pos, const std::string &ter,
 {
     coord_pair p( pos );
     mm_submap &sm = get_submap( p.sm );
-    sm.set_tile( p.loc, memorized_terrain_tile{ ter, subtile, rotation } );
+    memorized_terrain_tile tile;
+    tile.tile = memorized_tile_id( ter );
+    tile.subtile = static_cast<std::uint8_t>( subtile );
+    tile.rotation = static_cast<std::int16_t>( rotation );
+    sm.set_tile( p.loc, tile );
 }
 
 int map_memory::get_symbol( const tripoint &pos )
@@ -217,11 +256,12 @@ static void temp_remove_open_air( const shared_ptr_fast<mm_submap> &sm )
     if( sm->is_empty() ) {
         return;
     }
+    static const memorized_tile_id open_air( "t_open_air" );
     for( int x = 0; x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
             const memorized_terrain_tile &t = sm->tile( {x, y} );
 
-            if( !t.tile.empty() && t.tile == "t_open_air" ) {
+            if( t.tile == open_air ) {
                 sm->set_tile( {x, y}, mm_submap::default_tile );
             }
         }
@@ -2,8 +2,11 @@
 #ifndef CATA_SRC_MAP_MEMORY_H
 #define CATA_SRC_MAP_MEMORY_H
 
+#include <cstdint>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "game_constants.h"
 #include "memory_fast.h"
@@ -12,10 +15,41 @@
 class JsonOut;
 class JsonIn;
 
+/**
+ * Interned name of a memorized tile.
+ * Map memory holds a lot of tiles but only a few distinct names, so each name is
+ * stored once and tiles refer to it by index. The empty name is always 0.
+ */
+class memorized_tile_id
+{
+    public:
+        memorized_tile_id() = default;
+        explicit memorized_tile_id( const std::string &name );
+
+        const std::string &str() const;
+        bool empty() const {
+            return id == 0;
+        }
+        std::uint32_t to_i() const {
+            return id;
+        }
+
+        bool operator==( const memorized_tile_id &rhs ) const {
+            return id == rhs.id;
+        }
+        bool operator!=( const memorized_tile_id &rhs ) const {
+            return id != rhs.id;
+        }
+
+    private:
+        std::uint32_t id = 0;
+};
+
 struct memorized_terrain_tile {
-    std::string tile;
-    int subtile;
-    int rotation;
+    memorized_tile_id tile;
+    std::uint8_t subtile = 0;
+    // Vehicle parts store their facing in degrees
+    std::int16_t rotation = 0;
 
     inline bool operator==( const memorized_terrain_tile &rhs ) const {
         return ( rotation == rhs.rotation ) && ( subtile == rhs.subtile ) && ( tile == rhs.tile );
@@ -74,8 +108,14 @@ struct mm_submap {
             symbols[p.y * SEEX + p.x] = value;
         }
 
-        void serialize( JsonOut &jsout ) const;
-        void deserialize( JsonIn &jsin );
+        /**
+         * Tile names are written as their indices in the region's table of names.
+         * @p name_index maps each name's @ref memorized_tile_id::to_i to its index and must have all of them.
+         */
+        void serialize( JsonOut &jsout,
+                        const std::unordered_map<std::uint32_t, int> &name_index ) const;
+        /** Reads tile names as indices into @p names, or as strings in files that have no names. */
+        void deserialize( JsonIn &jsin, const std::vector<memorized_tile_id> &names );
 
     private:
         std::vector<memorized_terrain_tile> tiles; // holds either 0 or SEEX*SEEY elements
@@ -86,7 +126,7 @@ struct mm_submap {
 /**
  * Represents a square of mm_submaps.
  * For faster save/load, submaps are collected into regions
- * and each region is saved in its own file.
+ * and each region is saved in its own file, with a table of the tile names used in it.
  */
 struct mm_region {
     shared_ptr_fast<mm_submap> submaps[MM_REG_SIZE][MM_REG_SIZE];
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "async_file_writer.h"
 #include "cata_utility.h"
 #include "coordinate_conversions.h"
 #include "debug.h"
@@ -198,6 +199,26 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         return;
     }
 
+    const bool modified = std::any_of( submap_addrs.begin(), submap_addrs.end(),
+    [this]( const tripoint & submap_addr ) {
+        const auto iter = submaps.find( submap_addr );
+        return iter != submaps.end() && iter->second != nullptr && iter->second->modified;
+    } );
+
+    if( delete_after_save ) {
+        for( const tripoint &submap_addr : submap_addrs ) {
+            const auto iter = submaps.find( submap_addr );
+            if( iter != submaps.end() && iter->second != nullptr ) {
+                submaps_to_delete.push_back( submap_addr );
+            }
+        }
+    }
+
+    if( !modified ) {
+        // The file already has the same contents
+        return;
+    }
+
     // Don't create the directory if it would be empty
     assure_dir_exist( dirname );
     write_to_file( filename, [&]( std::ostream & fout ) {
@@ -228,14 +249,17 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
             sm->store( jsout );
 
             jsout.end_object();
-
-            if( delete_after_save ) {
-                submaps_to_delete.push_back( submap_addr );
-            }
         }
 
         jsout.end_array();
     } );
+
+    for( const tripoint &submap_addr : submap_addrs ) {
+        const auto iter = submaps.find( submap_addr );
+        if( iter != submaps.end() && iter->second != nullptr ) {
+            iter->second->modified = false;
+        }
+    }
 }
 
 // We're reading in way too many entities here to mess around with creating sub-objects and
@@ -247,6 +271,7 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
     const std::string dirname = find_dirname( om_addr );
     std::string quad_path = find_quad_path( dirname, om_addr );
 
+    get_async_file_writer().wait_for( quad_path );
     if( !file_exist( quad_path ) ) {
         // Fix for old saves where the path was generated using std::stringstream, which
         // did format the number using the current locale. That formatting may insert
@@ -301,6 +326,10 @@ void mapbuffer::deserialize( JsonIn &jsin )
             }
         }
 
+        if( sm ) {
+            // Older versions are written again, so they don't need to be migrated every time
+            sm->modified = version != savegame_version;
+        }
         if( !add_submap( submap_coordinates, sm ) ) {
             debugmsg( "submap %d,%d,%d was already loaded", submap_coordinates.x, submap_coordinates.y,
                       submap_coordinates.z );
@@ -591,9 +591,28 @@ void load_terrain( const JsonObject &jo, const std::string &src )
     terrain_data.load( jo, src );
 }
 
+static std::unordered_map<std::string, int> &get_ter_furn_flag_indices()
+{
+    static std::unordered_map<std::string, int> indices;
+    return indices;
+}
+
+ter_furn_flag::ter_furn_flag( const std::string &name )
+{
+    std::unordered_map<std::string, int> &indices = get_ter_furn_flag_indices();
+    const auto iter = indices.find( name );
+    if( iter != indices.end() ) {
+        index_ = iter->second;
+        return;
+    }
+    index_ = static_cast<int>( indices.size() );
+    indices.emplace( name, index_ );
+}
+
 void map_data_common_t::set_flag( const std::string &flag )
 {
     flags.insert( flag );
+    flag_bits.set( ter_furn_flag( flag ).index() );
     const auto it = ter_bitflags_map.find( flag );
     if( it != ter_bitflags_map.end() ) {
         bitflags.set( it->second );
@@ -1294,6 +1313,7 @@ void map_data_common_t::load( const JsonObject &jo, const std::string &src )
 
     assign( jo, "flags", flags );
     bitflags.reset();
+    flag_bits.clear();
     transparent = false;
 
     for( const std::string &flag : flags ) {
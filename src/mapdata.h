@@ -14,6 +14,7 @@
 #include "calendar.h"
 #include "catalua_type_operators.h"
 #include "color.h"
+#include "flag_bitset.h"
 #include "numeric_interval.h"
 #include "poly_serialized.h"
 #include "translations.h"
@@ -418,6 +419,25 @@ class activity_data_furn : public activity_data_common
         furn_str_id result_;
 };
 
+/**
+ * A terrain or furniture flag by a dense index, given to flag names as they're first seen.
+ * Checking for one is a bit test, where the string overloads of has_flag look the name up.
+ * Construct them once, e.g. as static locals, for flags checked in hot paths that have
+ * no @ref ter_bitflags entry.
+ */
+class ter_furn_flag
+{
+    public:
+        explicit ter_furn_flag( const std::string &name );
+
+        int index() const {
+            return index_;
+        }
+
+    private:
+        int index_ = 0;
+};
+
 struct map_data_common_t {
         map_bash_info bash;
         map_deconstruct_info deconstruct;
@@ -435,6 +455,7 @@ struct map_data_common_t {
     private:
         std::set<std::string> flags;    // string flags which possibly refer to what's documented above.
         std::bitset<NUM_TERFLAGS> bitflags; // bitfield of -certain- string flags which are heavily checked
+        flag_bitset flag_bits; // all of the string flags, by their ter_furn_flag index
 
     public:
         ter_str_id curtain_transform;
@@ -496,6 +517,10 @@ struct map_data_common_t {
             return flags.count( flag ) > 0;
         }
 
+        bool has_flag( const ter_furn_flag &flag ) const {
+            return flag_bits.test( flag.index() );
+        }
+
         bool has_flag( const ter_bitflags flag ) const {
             return bitflags.test( flag );
         }
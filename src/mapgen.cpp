@@ -107,7 +107,8 @@ static void science_room( map *m, const point &p1, const point &p2, int z, int r
 
 // (x,y,z) are absolute coordinates of a submap
 // x%2 and y%2 must be 0!
-void map::generate( const tripoint &p, const time_point &when )
+void map::generate( const tripoint &p, const time_point &when,
+                    std::vector<std::unique_ptr<submap>> *keep_submaps )
 {
     dbg( DL::Info ) << "map::generate( g[" << g.get() << "], p[" << p <<
                     "], when[" << to_string( when ) << "] )";
@@ -210,7 +211,13 @@ void map::generate( const tripoint &p, const time_point &when )
 
             const tripoint pos( i, j, p.z );
             if( i <= 1 && j <= 1 ) {
-                saven( pos );
+                if( keep_submaps != nullptr ) {
+                    const size_t grid_pos = get_nonant( pos );
+                    keep_submaps->emplace_back( getsubmap( grid_pos ) );
+                    setsubmap( grid_pos, nullptr );
+                } else {
+                    saven( pos );
+                }
             } else {
                 const size_t grid_pos = get_nonant( pos );
                 delete getsubmap( grid_pos );
@@ -1304,6 +1311,13 @@ class mapgen_value
         Id get( const mapgendata &dat ) const {
             return source_->get( dat );
         }
+        /** The id this always resolves to, if it depends on neither parameters nor the RNG. */
+        std::optional<Id> get_constant() const {
+            if( const id_source *s = dynamic_cast<const id_source *>( source_.get() ) ) {
+                return s->id;
+            }
+            return std::nullopt;
+        }
         std::vector<StringId> all_possible_results( const mapgen_parameters &params ) const {
             return source_->all_possible_results( params );
         }
@@ -1888,7 +1902,7 @@ class jmapgen_liquid_item : public jmapgen_piece
                 itype_id migrated = item_controller->migrate_id( chosen_id );
                 detached_ptr<item> newliquid = item::spawn( migrated, calendar::start_of_cataclysm );
                 if( amount.valmax > 0 ) {
-                    newliquid->charges = amount.get();
+                    newliquid->set_charges( amount.get() );
                 }
                 dat.m.add_item_or_charges( tripoint( x.get(), y.get(), dat.m.get_abs_sub().z ),
                                            std::move( newliquid ) );
@@ -2320,7 +2334,7 @@ class jmapgen_terrain : public jmapgen_piece
             }
             dat.m.ter_set( point( x.get(), y.get() ), chosen_id );
             // Delete furniture if a wall was just placed over it. TODO: need to do anything for fluid, monsters?
-            if( dat.m.has_flag_ter( "WALL", point( x.get(), y.get() ) ) ) {
+            if( dat.m.has_flag_ter( TFLAG_WALL, point( x.get(), y.get() ) ) ) {
                 dat.m.furn_set( point( x.get(), y.get() ), f_null );
                 // and items, unless the wall has PLACE_ITEM flag indicating it stores things.
                 if( !dat.m.has_flag_ter( "PLACE_ITEM", point( x.get(), y.get() ) ) ) {
@@ -3646,12 +3660,49 @@ void mapgen_function_json_base::check_common( const std::string &oter_name ) con
     objects.check( oter_name, parameters );
 }
 
+static bool is_fixed( const jmapgen_int &v )
+{
+    return v.val == v.valmax;
+}
+
 void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(),
     []( const jmapgen_obj & l, const jmapgen_obj & r ) {
         return l.second->phase() < r.second->phase();
     } );
+
+    plan.clear();
+    plan.reserve( objects.size() );
+    for( size_t i = 0; i < objects.size(); i++ ) {
+        const jmapgen_place &where = objects[i].first;
+        const jmapgen_piece &what = *objects[i].second;
+        plan_step step;
+        step.object = static_cast<int>( i );
+        const bool placed_once = is_fixed( where.repeat ) && is_fixed( what.repeat ) &&
+                                 std::max( where.repeat.val, what.repeat.val ) == 1;
+        if( placed_once && is_fixed( where.x ) && is_fixed( where.y ) ) {
+            step.pos = point( where.x.val, where.y.val );
+            if( const jmapgen_terrain *t = dynamic_cast<const jmapgen_terrain *>( &what ) ) {
+                if( std::optional<ter_id> id = t->id.get_constant() ) {
+                    step.object = -1;
+                    step.ter = *id;
+                    step.clears_furniture = ( *id )->has_flag( TFLAG_WALL );
+                    step.clears_items = step.clears_furniture && !( *id )->has_flag( "PLACE_ITEM" );
+                }
+            } else if( const jmapgen_furniture *f = dynamic_cast<const jmapgen_furniture *>( &what ) ) {
+                if( std::optional<furn_id> id = f->id.get_constant() ) {
+                    step.object = -1;
+                    step.furn = *id;
+                }
+            }
+        }
+        if( step.object < 0 && step.ter.id().is_null() && step.furn.id().is_null() ) {
+            // Placing nothing
+            continue;
+        }
+        plan.push_back( step );
+    }
 }
 
 void jmapgen_objects::check( const std::string &oter_name,
@@ -3891,12 +3942,23 @@ mapgen_parameters mapgen_function_json::get_mapgen_params( mapgen_parameter_scop
     return parameters.params_for_scope( scope );
 }
 
+mapgen_counters &get_mapgen_counters()
+{
+    static mapgen_counters counters;
+    return counters;
+}
+
 void mapgen_function_json_nested::nest( const mapgendata &md, const point &offset ) const
 {
     // TODO: Make rotation work for submaps, then pass this value into elem & objects apply.
     //int chosen_rotation = rotation.get() % 4;
 
     mapgendata md_with_params( md, get_args( md, mapgen_parameter_scope::nest ) );
+    md_with_params.enter_nest();
+
+    mapgen_counters &counters = get_mapgen_counters();
+    counters.nested_chunks++;
+    counters.max_nested_depth = std::max( counters.max_nested_depth, md_with_params.nest_depth() );
 
     for( const jmapgen_setmap &elem : setmap_points ) {
         elem.apply( md_with_params, offset );
@@ -3912,36 +3974,42 @@ void mapgen_function_json_nested::nest( const mapgendata &md, const point &offse
  */
 void jmapgen_objects::apply( const mapgendata &dat ) const
 {
-    for( auto &obj : objects ) {
-        const auto &where = obj.first;
-        const auto &what = *obj.second;
-        // The user will only specify repeat once in JSON, but it may get loaded both
-        // into the what and where in some cases--we just need the greater value of the two.
-        const int repeat = std::max( where.repeat.get(), what.repeat.get() );
-        for( int i = 0; i < repeat; i++ ) {
-            what.apply( dat, where.x, where.y );
-        }
-    }
+    apply( dat, point_zero );
 }
 
 void jmapgen_objects::apply( const mapgendata &dat, const point &offset ) const
 {
-    if( offset == point_zero ) {
-        // It's a bit faster
-        apply( dat );
-        return;
-    }
-
-    for( auto &obj : objects ) {
-        auto where = obj.first;
-        where.offset( -offset );
+    map &m = dat.m;
+    const int z = m.get_abs_sub().z;
+    for( const plan_step &step : plan ) {
+        if( step.object >= 0 ) {
+            jmapgen_place where = objects[step.object].first;
+            where.offset( -offset );
+            const jmapgen_piece &what = *objects[step.object].second;
+            // The user will only specify repeat once in JSON, but it may get loaded both
+            // into the what and where in some cases--we just need the greater value of the two.
+            const int repeat = std::max( where.repeat.get(), what.repeat.get() );
+            for( int i = 0; i < repeat; i++ ) {
+                what.apply( dat, where.x, where.y );
+            }
+            continue;
+        }
 
-        const auto &what = *obj.second;
-        // The user will only specify repeat once in JSON, but it may get loaded both
-        // into the what and where in some cases--we just need the greater value of the two.
-        const int repeat = std::max( where.repeat.get(), what.repeat.get() );
-        for( int i = 0; i < repeat; i++ ) {
-            what.apply( dat, where.x, where.y );
+        const tripoint p( step.pos - offset, z );
+        if( !m.inbounds( p ) ) {
+            continue;
+        }
+        if( step.furn != f_null ) {
+            m.furn_set( p, step.furn );
+            continue;
+        }
+        // Same as jmapgen_terrain::apply
+        m.ter_set( p, step.ter );
+        if( step.clears_furniture ) {
+            m.furn_set( p, f_null );
+            if( step.clears_items ) {
+                m.i_clear( p );
+            }
         }
     }
 }
@@ -5234,7 +5302,7 @@ void map::draw_lab( mapgendata &dat )
                         );
                     } else {
                         detached_ptr<item> newliquid = item::spawn( "plut_slurry_dense", calendar::start_of_cataclysm );
-                        newliquid->charges = 1;
+                        newliquid->set_charges( 1 );
                         add_item_or_charges( tripoint( marker_x, marker_y, get_abs_sub().z ),
                                              std::move( newliquid ) );
                     }
@@ -6155,7 +6223,7 @@ void map::place_spawns( const mongroup_id &group, const int chance,
 void map::place_gas_pump( const point &p, int charges, const itype_id &fuel_type )
 {
     detached_ptr<item> fuel = item::spawn( fuel_type, calendar::start_of_cataclysm );
-    fuel->charges = charges;
+    fuel->set_charges( charges );
     ter_set( p, ter_id( fuel->fuel_pump_terrain() ) );
     add_item( p, std::move( fuel ) );
 }
@@ -6168,7 +6236,7 @@ void map::place_gas_pump( const point &p, int charges )
 void map::place_toilet( point p, int charges )
 {
     detached_ptr<item> water = item::spawn( "water", calendar::start_of_cataclysm );
-    water->charges = charges;
+    water->set_charges( charges );
     add_item( p, std::move( water ) );
     furn_set( p, f_toilet );
 }
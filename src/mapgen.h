@@ -367,6 +367,10 @@ struct jmapgen_objects {
         void load_objects( const JsonObject &jsi, const std::string &member_name );
 
         void check( const std::string &oter_name, const mapgen_parameters & ) const;
+        /**
+         * Sorts the objects by phase and compiles them into @ref plan. Must be called after
+         * all objects have been added.
+         */
         void finalize();
 
         void merge_parameters_into( mapgen_parameters &, const std::string &outer_context ) const;
@@ -386,6 +390,24 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+        /**
+         * One step of applying the objects. Terrain and furniture with a constant id placed
+         * once at a fixed position (most of the "rows" of a mapgen) are resolved when the
+         * plan is compiled, applying them needs neither the piece nor the RNG.
+         * Everything else refers back to its entry in @ref objects.
+         */
+        struct plan_step {
+            // Index into objects, or -1 if the placement below is used instead
+            int object = -1;
+            point pos;
+            ter_id ter;
+            furn_id furn;
+            // The terrain is a wall, which removes furniture and, unless it
+            // can hold them, items
+            bool clears_furniture = false;
+            bool clears_items = false;
+        };
+        std::vector<plan_step> plan;
         point m_offset;
         point mapgensize;
         point total_size;
@@ -523,6 +545,18 @@ void calculate_mapgen_weights(); // throws
 
 void check_mapgen_definitions();
 
+/**
+ * Counters updated while mapgen runs, for profiling mapgen definitions.
+ * Reset before generating, read afterwards.
+ */
+struct mapgen_counters {
+    // Nested mapgen chunks placed
+    int nested_chunks = 0;
+    // Deepest nesting reached, 1 for chunks placed by the outer mapgen itself
+    int max_nested_depth = 0;
+};
+mapgen_counters &get_mapgen_counters();
+
 /// move to building_generation
 enum room_type {
     room_null,
@@ -2971,14 +2971,18 @@ void madd_field( map *m, point p, field_type_id type, int intensity )
 
 void resolve_regional_terrain_and_furniture( const mapgendata &dat )
 {
+    const region_terrain_and_furniture_settings &settings = dat.region.region_terrain_and_furniture;
+    if( settings.terrain.empty() && settings.furniture.empty() ) {
+        return;
+    }
     for( const tripoint &p : dat.m.points_on_zlevel() ) {
         const ter_id tid_before = dat.m.ter( p );
-        const ter_id tid_after = dat.region.region_terrain_and_furniture.resolve( tid_before );
+        const ter_id tid_after = settings.resolve( tid_before );
         if( tid_after != tid_before ) {
             dat.m.ter_set( p, tid_after );
         }
         const furn_id fid_before = dat.m.furn( p );
-        const furn_id fid_after = dat.region.region_terrain_and_furniture.resolve( fid_before );
+        const furn_id fid_after = settings.resolve( fid_before );
         if( fid_after != fid_before ) {
             dat.m.furn_set( p, fid_after );
         }
@@ -0,0 +1,150 @@
+#include "mapgen_queue.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "calendar.h"
+#include "game.h"
+#include "game_constants.h"
+#include "hash_utils.h"
+#include "map.h"
+#include "omdata.h"
+#include "overmapbuffer.h"
+#include "rng.h"
+#include "type_id.h"
+
+// Overmap terrain at this distance from the player may be outside the reality bubble
+static constexpr int first_ring = HALF_MAPSIZE / 2 + 1;
+// How many rings of overmap terrain beyond that to generate ahead
+static constexpr int lookahead = 2;
+// Moving further than this in one turn is a teleport or a new game, not a heading
+static constexpr int max_heading_step = 3;
+
+static unsigned int job_seed( const tripoint_abs_omt &pos )
+{
+    std::size_t seed = g->get_seed();
+    cata::hash_combine( seed, pos.x() );
+    cata::hash_combine( seed, pos.y() );
+    cata::hash_combine( seed, pos.z() );
+    // rng_set_engine_seed ignores 0
+    return static_cast<unsigned int>( seed ) | 1;
+}
+
+void mapgen_queue::update( const tripoint_abs_omt &player_pos )
+{
+    if( last_pos == player_pos ) {
+        return;
+    }
+    const std::optional<tripoint_abs_omt> prev = last_pos;
+    last_pos = player_pos;
+    jobs.clear();
+    if( !prev ) {
+        return;
+    }
+    const point step = ( player_pos - *prev ).raw().xy();
+    if( std::abs( step.x ) > max_heading_step || std::abs( step.y ) > max_heading_step ||
+        step == point_zero ) {
+        return;
+    }
+    const point heading( ( step.x > 0 ) - ( step.x < 0 ), ( step.y > 0 ) - ( step.y < 0 ) );
+
+    struct candidate {
+        point offset;
+        int dist;
+        int ahead;
+    };
+    std::vector<candidate> candidates;
+    const int reach = first_ring + lookahead - 1;
+    for( int x = -reach; x <= reach; x++ ) {
+        for( int y = -reach; y <= reach; y++ ) {
+            const int dist = std::max( std::abs( x ), std::abs( y ) );
+            const int ahead = x * heading.x + y * heading.y;
+            if( dist >= first_ring && ahead > 0 ) {
+                candidates.push_back( { point( x, y ), dist, ahead } );
+            }
+        }
+    }
+    // Nearest first, straight ahead before the sides
+    std::sort( candidates.begin(), candidates.end(), []( const candidate & l, const candidate & r ) {
+        return l.dist != r.dist ? l.dist < r.dist : l.ahead > r.ahead;
+    } );
+
+    const bool zlevels = get_map().has_zlevels();
+    const int zmin = zlevels ? -OVERMAP_DEPTH : player_pos.z();
+    const int zmax = zlevels ? OVERMAP_HEIGHT : player_pos.z();
+    for( const candidate &c : candidates ) {
+        for( int z = zmin; z <= zmax; z++ ) {
+            const tripoint_abs_omt pos( player_pos.x() + c.offset.x, player_pos.y() + c.offset.y, z );
+            jobs.push_back( { pos, job_seed( pos ) } );
+        }
+    }
+}
+
+int mapgen_queue::process( std::chrono::microseconds budget )
+{
+    using namespace std::chrono;
+    const steady_clock::time_point start = steady_clock::now();
+    int count = 0;
+    while( !jobs.empty() ) {
+        const microseconds spent = duration_cast<microseconds>( steady_clock::now() - start );
+        if( spent >= budget ) {
+            break;
+        }
+        const job j = jobs.front();
+        if( !needs_generation( j ) ) {
+            jobs.pop_front();
+            continue;
+        }
+        // Until a job has been timed, only one is run per call
+        if( job_estimate == microseconds::zero() ? count > 0 : spent + job_estimate > budget ) {
+            break;
+        }
+        jobs.pop_front();
+        const steady_clock::time_point job_start = steady_clock::now();
+        generate( j );
+        const microseconds took = duration_cast<microseconds>( steady_clock::now() - job_start );
+        // Follows expensive terrain at once, and forgets it slowly
+        job_estimate = std::max( took, ( job_estimate * 7 + took ) / 8 );
+        count++;
+    }
+    return count;
+}
+
+void mapgen_queue::clear()
+{
+    jobs.clear();
+    last_pos.reset();
+}
+
+bool mapgen_queue::needs_generation( const job &j )
+{
+    static const oter_id rock( "empty_rock" );
+    static const oter_id air( "open_air" );
+
+    // Creating overmaps is left to the bubble
+    if( !overmap_buffer.has( project_to<coords::om>( j.pos.xy() ) ) ) {
+        return false;
+    }
+    // Uniform submaps are cheap, map::loadn makes them as needed
+    const oter_id terrain_type = overmap_buffer.ter( j.pos );
+    if( terrain_type == air || terrain_type == rock ) {
+        return false;
+    }
+    return !overmap_buffer.is_omt_generated( j.pos );
+}
+
+void mapgen_queue::generate( const job &j )
+{
+    const cata_default_random_engine saved_engine = rng_get_engine();
+    rng_set_engine_seed( j.seed );
+    tinymap tmp_map;
+    tmp_map.generate( project_to<coords::sm>( j.pos ).raw(), calendar::turn );
+    rng_get_engine() = saved_engine;
+}
+
+mapgen_queue &get_mapgen_queue()
+{
+    static mapgen_queue singleton;
+    return singleton;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#ifndef CATA_SRC_MAPGEN_QUEUE_H
+#define CATA_SRC_MAPGEN_QUEUE_H
+
+#include <chrono>
+#include <deque>
+#include <optional>
+
+#include "coordinates.h"
+
+/**
+ * Generates overmap terrain the player is heading toward before @ref map::loadn
+ * needs it, so moving into new terrain doesn't stall on mapgen when the bubble shifts.
+ *
+ * Jobs are run between turns, within a time budget, and commit their submaps to
+ * MAPBUFFER the same way map::loadn does. Whatever isn't done in time is still
+ * generated by map::loadn as before.
+ *
+ * Jobs don't run on worker threads, because these parts of mapgen have to stay on
+ * the main thread and any mapgen function may use them:
+ * - the global RNG engine, which is why each job gets its own seed,
+ * - Lua mapgen postprocess hooks, mods expect a single Lua state,
+ * - NPC spawns, which are added to overmap_buffer and the game's NPC list,
+ * - monster and vehicle placement, which reach into overmap_buffer and the vehicle trackers,
+ * - nested mapgen and map extras that read or change the overmap around the generated terrain,
+ * - item creation, which registers items in the global item tracking.
+ */
+class mapgen_queue
+{
+    public:
+        struct job {
+            tripoint_abs_omt pos;
+            // The RNG engine is seeded with this, so the result doesn't depend on
+            // when the job runs
+            unsigned int seed = 0;
+        };
+
+        /**
+         * Queues the terrain in front of the player, if they moved to another OMT since the last call.
+         * Jobs queued for an earlier heading are dropped.
+         */
+        void update( const tripoint_abs_omt &player_pos );
+        /**
+         * Runs queued jobs until they run out or the next one isn't expected to fit in what's
+         * left of the budget. Returns how many were run.
+         */
+        int process( std::chrono::microseconds budget );
+
+        std::size_t pending() const {
+            return jobs.size();
+        }
+        void clear();
+
+    private:
+        std::deque<job> jobs;
+        std::optional<tripoint_abs_omt> last_pos;
+        // How long generating an OMT is expected to take, zero until one was timed
+        std::chrono::microseconds job_estimate = std::chrono::microseconds::zero();
+
+        static bool needs_generation( const job &j );
+        static void generate( const job &j );
+};
+
+mapgen_queue &get_mapgen_queue();
+
+#endif // CATA_SRC_MAPGEN_QUEUE_H
@@ -70,6 +70,7 @@ class mapgendata
         time_point when_;
         ::mission *mission_;
         mapgen_arguments mapgen_args_;
+        int nest_depth_ = 0;
 
     public:
         oter_id t_nesw[8];
@@ -137,6 +138,13 @@ class mapgendata
         int zlevel() const {
             return pos.z();
         }
+        /** How many nested mapgen chunks deep this is placed, 0 for the outer mapgen */
+        int nest_depth() const {
+            return nest_depth_;
+        }
+        void enter_nest() {
+            nest_depth_++;
+        }
 
         void set_dir( int dir_in, int val );
         void fill( int val );
@@ -321,10 +321,10 @@ void memorial_logger::write( std::ostream &file, const std::string &epitaph ) co
     for( const item * const &elem : u.worn ) {
         const item &next_item = *elem;
         file << indent << next_item.invlet << " - " << next_item.tname( 1, false );
-        if( next_item.charges > 0 ) {
-            file << " (" << next_item.charges << ")";
-        } else if( next_item.contents.num_item_stacks() == 1 && next_item.contents.front().charges > 0 ) {
-            file << " (" << next_item.contents.front().charges << ")";
+        if( next_item.charges() > 0 ) {
+            file << " (" << next_item.charges() << ")";
+        } else if( next_item.contents.num_item_stacks() == 1 && next_item.contents.front().charges() > 0 ) {
+            file << " (" << next_item.contents.front().charges() << ")";
         }
         file << eol;
     }
@@ -341,10 +341,10 @@ void memorial_logger::write( std::ostream &file, const std::string &epitaph ) co
         if( elem->size() > 1 ) {
             file << " [" << elem->size() << "]";
         }
-        if( next_item.charges > 0 ) {
-            file << " (" << next_item.charges << ")";
-        } else if( next_item.contents.num_item_stacks() == 1 && next_item.contents.front().charges > 0 ) {
-            file << " (" << next_item.contents.front().charges << ")";
+        if( next_item.charges() > 0 ) {
+            file << " (" << next_item.charges() << ")";
+        } else if( next_item.contents.num_item_stacks() == 1 && next_item.contents.front().charges() > 0 ) {
+            file << " (" << next_item.contents.front().charges() << ")";
         }
         file << eol;
     }
@@ -363,666 +363,681 @@ void memorial_logger::write( std::ostream &file, const std::string &epitaph ) co
     file << dump();
 }
 
-void memorial_logger::notify( const cata::event &e )
+enum_bitset<event_type> memorial_logger::notified_types() const
 {
-    switch( e.type() ) {
-        case event_type::activates_artifact: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                std::string item_name = e.get<cata_variant_type::string>( "item_name" );
-                //~ %s is artifact name
-                add( pgettext( "memorial_male", "Activated the %s." ),
-                     pgettext( "memorial_female", "Activated the %s." ),
-                     item_name );
-            }
-            break;
-        }
-        case event_type::activates_mininuke: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Activated a mininuke." ),
-                     pgettext( "memorial_female", "Activated a mininuke." ) );
-            }
-            break;
-        }
-        case event_type::administers_mutagen: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                mutagen_technique technique = e.get<mutagen_technique>( "technique" );
-                switch( technique ) {
-                    case mutagen_technique::consumed_mutagen:
-                        add( pgettext( "memorial_male", "Consumed mutagen." ),
-                             pgettext( "memorial_female", "Consumed mutagen." ) );
-                        break;
-                    case mutagen_technique::injected_mutagen:
-                        add( pgettext( "memorial_male", "Injected mutagen." ),
-                             pgettext( "memorial_female", "Injected mutagen." ) );
-                        break;
-                    case mutagen_technique::consumed_purifier:
-                        add( pgettext( "memorial_male", "Consumed purifier." ),
-                             pgettext( "memorial_female", "Consumed purifier." ) );
-                        break;
-                    case mutagen_technique::injected_purifier:
-                        add( pgettext( "memorial_male", "Injected purifier." ),
-                             pgettext( "memorial_female", "Injected purifier." ) );
-                        break;
-                    case mutagen_technique::injected_smart_purifier:
-                        add( pgettext( "memorial_male", "Injected smart purifier." ),
-                             pgettext( "memorial_female", "Injected smart purifier." ) );
-                        break;
-                    case mutagen_technique::num_mutagen_techniques:
-                        break;
-                }
-            }
-            break;
-        }
-        case event_type::angers_amigara_horrors: {
-            add( pgettext( "memorial_male", "Angered a group of amigara horrors!" ),
-                 pgettext( "memorial_female", "Angered a group of amigara horrors!" ) );
-            break;
-        }
-        case event_type::awakes_dark_wyrms: {
-            add( pgettext( "memorial_male", "Awoke a group of dark wyrms!" ),
-                 pgettext( "memorial_female", "Awoke a group of dark wyrms!" ) );
-            break;
-        }
-        case event_type::becomes_wanted: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Became wanted by the police!" ),
-                     pgettext( "memorial_female", "Became wanted by the police!" ) );
-            }
-            break;
-        }
-        case event_type::broken_bone_mends: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                body_part part = e.get<body_part>( "part" );
-                //~ %s is bodypart
-                add( pgettext( "memorial_male", "Broken %s began to mend." ),
-                     pgettext( "memorial_female", "Broken %s began to mend." ),
-                     body_part_name( part ) );
-            }
-            break;
-        }
-        case event_type::buries_corpse: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                const mtype &corpse_type = e.get<mtype_id>( "corpse_type" ).obj();
-                std::string corpse_name = e.get<cata_variant_type::string>( "corpse_name" );
-                if( corpse_name.empty() ) {
-                    if( corpse_type.has_flag( MF_HUMAN ) ) {
-                        add( pgettext( "memorial_male",
-                                       "You buried an unknown victim of the Cataclysm." ),
-                             pgettext( "memorial_female",
-                                       "You buried an unknown victim of The Cataclysm." ) );
-                    }
-                } else {
-                    add( pgettext( "memorial_male", "You buried %s." ),
-                         pgettext( "memorial_female", "You buried %s." ),
-                         corpse_name );
-                }
-            }
-            break;
-        }
-        case event_type::causes_resonance_cascade: {
-            add( pgettext( "memorial_male", "Caused a resonance cascade." ),
-                 pgettext( "memorial_female", "Caused a resonance cascade." ) );
-            break;
-        }
-        case event_type::character_gains_effect: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                const effect_type &type = e.get<efftype_id>( "effect" ).obj();
-                const std::string message = type.get_apply_memorial_log();
-                if( !message.empty() ) {
-                    add( pgettext( "memorial_male", message.c_str() ),
-                         pgettext( "memorial_female", message.c_str() ) );
-                }
-            }
-            break;
-        }
-        case event_type::character_kills_character: {
-            character_id ch = e.get<character_id>( "killer" );
-            if( ch == g->u.getID() ) {
-                std::string name = e.get<cata_variant_type::string>( "victim_name" );
-                bool cannibal = g->u.has_trait( trait_CANNIBAL );
-                bool psycho = g->u.has_trait( trait_PSYCHOPATH );
-                if( g->u.has_trait( trait_SAPIOVORE ) ) {
-                    add( pgettext( "memorial_male",
-                                   "Caught and killed an ape.  Prey doesn't have a name." ),
-                         pgettext( "memorial_female",
-                                   "Caught and killed an ape.  Prey doesn't have a name." ) );
-                } else if( psycho && cannibal ) {
-                    add( pgettext( "memorial_male",
-                                   "Killed a delicious-looking innocent, %s, in cold blood." ),
-                         pgettext( "memorial_female",
-                                   "Killed a delicious-looking innocent, %s, in cold blood." ),
-                         name );
-                } else if( psycho ) {
-                    add( pgettext( "memorial_male",
-                                   "Killed an innocent, %s, in cold blood.  They were weak." ),
-                         pgettext( "memorial_female",
-                                   "Killed an innocent, %s, in cold blood.  They were weak." ),
-                         name );
-                } else if( cannibal ) {
-                    add( pgettext( "memorial_male", "Killed an innocent, %s." ),
-                         pgettext( "memorial_female", "Killed an innocent, %s." ),
-                         name );
-                } else {
-                    add( pgettext( "memorial_male",
-                                   "Killed an innocent person, %s, in cold blood and "
-                                   "felt terrible afterwards." ),
-                         pgettext( "memorial_female",
-                                   "Killed an innocent person, %s, in cold blood and "
-                                   "felt terrible afterwards." ),
-                         name );
-                }
-            }
-            break;
-        }
-        case event_type::character_kills_monster: {
-            character_id ch = e.get<character_id>( "killer" );
-            if( ch == g->u.getID() ) {
-                mtype_id victim_type = e.get<mtype_id>( "victim_type" );
-                if( victim_type->difficulty >= 30 ) {
-                    add( pgettext( "memorial_male", "Killed a %s." ),
-                         pgettext( "memorial_female", "Killed a %s." ),
-                         victim_type->nname() );
-                }
-            }
-            break;
-        }
-        case event_type::character_loses_effect: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                const effect_type &type = e.get<efftype_id>( "effect" ).obj();
-                const std::string message = type.get_remove_memorial_log();
-                if( !message.empty() ) {
-                    add( pgettext( "memorial_male", message.c_str() ),
-                         pgettext( "memorial_female", message.c_str() ) );
-                }
-            }
-            break;
-        }
-        case event_type::character_triggers_trap: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                trap_str_id trap = e.get<trap_str_id>( "trap" );
-                if( trap == tr_bubblewrap ) {
-                    add( pgettext( "memorial_male", "Stepped on bubble wrap." ),
-                         pgettext( "memorial_female", "Stepped on bubble wrap." ) );
-                } else if( trap == tr_glass ) {
-                    add( pgettext( "memorial_male", "Stepped on glass." ),
-                         pgettext( "memorial_female", "Stepped on glass." ) );
-                } else if( trap == tr_beartrap ) {
-                    add( pgettext( "memorial_male", "Caught by a beartrap." ),
-                         pgettext( "memorial_female", "Caught by a beartrap." ) );
-                } else if( trap == tr_nailboard ) {
-                    add( pgettext( "memorial_male", "Stepped on a spiked board." ),
-                         pgettext( "memorial_female", "Stepped on a spiked board." ) );
-                } else if( trap == tr_caltrops ) {
-                    add( pgettext( "memorial_male", "Stepped on a caltrop." ),
-                         pgettext( "memorial_female", "Stepped on a caltrop." ) );
-                } else if( trap == tr_caltrops_glass ) {
-                    add( pgettext( "memorial_male", "Stepped on a glass caltrop." ),
-                         pgettext( "memorial_female", "Stepped on a glass caltrop." ) );
-                } else if( trap == tr_tripwire ) {
-                    add( pgettext( "memorial_male", "Tripped on a tripwire." ),
-                         pgettext( "memorial_female", "Tripped on a tripwire." ) );
-                } else if( trap == tr_crossbow ) {
-                    add( pgettext( "memorial_male", "Triggered a crossbow trap." ),
-                         pgettext( "memorial_female", "Triggered a crossbow trap." ) );
-                } else if( trap == tr_shotgun_1 || trap == tr_shotgun_2 ) {
-                    add( pgettext( "memorial_male", "Triggered a shotgun trap." ),
-                         pgettext( "memorial_female", "Triggered a shotgun trap." ) );
-                } else if( trap == tr_blade ) {
-                    add( pgettext( "memorial_male", "Triggered a blade trap." ),
-                         pgettext( "memorial_female", "Triggered a blade trap." ) );
-                } else if( trap == tr_light_snare ) {
-                    add( pgettext( "memorial_male", "Triggered a light snare." ),
-                         pgettext( "memorial_female", "Triggered a light snare." ) );
-                } else if( trap == tr_heavy_snare ) {
-                    add( pgettext( "memorial_male", "Triggered a heavy snare." ),
-                         pgettext( "memorial_female", "Triggered a heavy snare." ) );
-                } else if( trap == tr_landmine ) {
-                    add( pgettext( "memorial_male", "Stepped on a land mine." ),
-                         pgettext( "memorial_female", "Stepped on a land mine." ) );
-                } else if( trap == tr_boobytrap ) {
-                    add( pgettext( "memorial_male", "Triggered a booby trap." ),
-                         pgettext( "memorial_female", "Triggered a booby trap." ) );
-                } else if( trap == tr_telepad || trap == tr_portal ) {
-                    add( pgettext( "memorial_male", "Triggered a teleport trap." ),
-                         pgettext( "memorial_female", "Triggered a teleport trap." ) );
-                } else if( trap == tr_goo ) {
-                    add( pgettext( "memorial_male", "Stepped into thick goo." ),
-                         pgettext( "memorial_female", "Stepped into thick goo." ) );
-                } else if( trap == tr_dissector ) {
-                    add( pgettext( "memorial_male", "Stepped into a dissector." ),
-                         pgettext( "memorial_female", "Stepped into a dissector." ) );
-                } else if( trap == tr_pit ) {
-                    add( pgettext( "memorial_male", "Fell in a pit." ),
-                         pgettext( "memorial_female", "Fell in a pit." ) );
-                } else if( trap == tr_spike_pit ) {
-                    add( pgettext( "memorial_male", "Fell into a spiked pit." ),
-                         pgettext( "memorial_female", "Fell into a spiked pit." ) );
-                } else if( trap == tr_glass_pit ) {
-                    add( pgettext( "memorial_male", "Fell into a pit filled with glass shards." ),
-                         pgettext( "memorial_female", "Fell into a pit filled with glass shards." ) );
-                } else if( trap == tr_lava ) {
-                    add( pgettext( "memorial_male", "Stepped into lava." ),
-                         pgettext( "memorial_female", "Stepped into lava." ) );
-                } else if( trap == tr_sinkhole ) {
-                    add( pgettext( "memorial_male", "Stepped into a sinkhole." ),
-                         pgettext( "memorial_female", "Stepped into a sinkhole." ) );
-                } else if( trap == tr_ledge ) {
-                    add( pgettext( "memorial_male", "Fell down a ledge." ),
-                         pgettext( "memorial_female", "Fell down a ledge." ) );
-                } else if( trap == tr_temple_flood ) {
-                    add( pgettext( "memorial_male", "Triggered a flood trap." ),
-                         pgettext( "memorial_female", "Triggered a flood trap." ) );
-                } else if( trap == tr_shadow ) {
-                    add( pgettext( "memorial_male", "Triggered a shadow trap." ),
-                         pgettext( "memorial_female", "Triggered a shadow trap." ) );
-                } else if( trap == tr_drain ) {
-                    add( pgettext( "memorial_male", "Triggered a life-draining trap." ),
-                         pgettext( "memorial_female", "Triggered a life-draining trap." ) );
-                } else if( trap == tr_snake ) {
-                    add( pgettext( "memorial_male", "Triggered a shadow snake trap." ),
-                         pgettext( "memorial_female", "Triggered a shadow snake trap." ) );
-                }
-            }
-            break;
-        }
-        case event_type::consumes_marloss_item: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                itype_id it = e.get<cata_variant_type::itype_id>( "itype" );
-                std::string itname = it->nname( 1 );
-                add( pgettext( "memorial_male", "Consumed a %s." ),
-                     pgettext( "memorial_female", "Consumed a %s." ), itname );
-            }
-            break;
-        }
-        case event_type::crosses_marloss_threshold: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Opened the Marloss Gateway." ),
-                     pgettext( "memorial_female", "Opened the Marloss Gateway." ) );
-            }
-            break;
-        }
-        case event_type::crosses_mutation_threshold: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                mutation_category_id category_id =
-                    e.get<cata_variant_type::mutation_category_id>( "category" );
-                const mutation_category_trait &category =
-                    mutation_category_trait::get_category( category_id );
-                add( category.memorial_message_male(),
-                     category.memorial_message_female() );
-            }
-            break;
-        }
-        case event_type::crosses_mycus_threshold: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Became one with the Mycus." ),
-                     pgettext( "memorial_female", "Became one with the Mycus." ) );
-            }
-            break;
-        }
-        case event_type::dermatik_eggs_hatch: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Dermatik eggs hatched." ),
-                     pgettext( "memorial_female", "Dermatik eggs hatched." ) );
-            }
-            break;
-        }
-        case event_type::dermatik_eggs_injected: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Injected with dermatik eggs." ),
-                     pgettext( "memorial_female", "Injected with dermatik eggs." ) );
-            }
-            break;
-        }
-        case event_type::destroys_triffid_grove: {
-            add( pgettext( "memorial_male", "Destroyed a triffid grove." ),
-                 pgettext( "memorial_female", "Destroyed a triffid grove." ) );
-            break;
-        }
-        case event_type::dies_from_asthma_attack: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Succumbed to an asthma attack." ),
-                     pgettext( "memorial_female", "Succumbed to an asthma attack." ) );
-            }
-            break;
-        }
-        case event_type::dies_from_drug_overdose: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                efftype_id effect = e.get<efftype_id>( "effect" );
-                if( effect == effect_datura ) {
-                    add( pgettext( "memorial_male", "Died of datura overdose." ),
-                         pgettext( "memorial_female", "Died of datura overdose." ) );
-                } else if( effect == effect_jetinjector ) {
-                    add( pgettext( "memorial_male", "Died of a healing stimulant overdose." ),
-                         pgettext( "memorial_female", "Died of a healing stimulant overdose." ) );
-                } else if( effect == effect_drunk ) {
-                    add( pgettext( "memorial_male", "Died of an alcohol overdose." ),
-                         pgettext( "memorial_female", "Died of an alcohol overdose." ) );
-                } else {
-                    add( pgettext( "memorial_male", "Died of a drug overdose." ),
-                         pgettext( "memorial_female", "Died of a drug overdose." ) );
-                }
-            }
-            break;
-        }
-        case event_type::dies_of_infection: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Succumbed to the infection." ),
-                     pgettext( "memorial_female", "Succumbed to the infection." ) );
-            }
-            break;
-        }
-        case event_type::dies_of_starvation: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Died of starvation." ),
-                     pgettext( "memorial_female", "Died of starvation." ) );
-            }
-            break;
-        }
-        case event_type::dies_of_thirst: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Died of thirst." ),
-                     pgettext( "memorial_female", "Died of thirst." ) );
-            }
-            break;
-        }
-        case event_type::digs_into_lava: {
-            add( pgettext( "memorial_male", "Dug a shaft into lava." ),
-                 pgettext( "memorial_female", "Dug a shaft into lava." ) );
-            break;
-        }
-        case event_type::disarms_nuke: {
-            add( pgettext( "memorial_male", "Disarmed a nuclear missile." ),
-                 pgettext( "memorial_female", "Disarmed a nuclear missile." ) );
-            break;
-        }
-        case event_type::eats_sewage: {
-            add( pgettext( "memorial_male", "Ate a sewage sample." ),
-                 pgettext( "memorial_female", "Ate a sewage sample." ) );
-            break;
-        }
-        case event_type::evolves_mutation: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                trait_id from = e.get<trait_id>( "from_trait" );
-                trait_id to = e.get<trait_id>( "to_trait" );
-                add( pgettext( "memorial_male", "'%s' mutation turned into '%s'" ),
-                     pgettext( "memorial_female", "'%s' mutation turned into '%s'" ),
-                     from->name(), to->name() );
-            }
-            break;
-        }
-        case event_type::exhumes_grave: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Exhumed a grave." ),
-                     pgettext( "memorial_female", "Exhumed a grave." ) );
-            }
-            break;
-        }
-        case event_type::fails_to_install_cbm: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                std::string cbm_name = e.get<bionic_id>( "bionic" )->name.translated();
-                add( pgettext( "memorial_male", "Failed install of bionic: %s." ),
-                     pgettext( "memorial_female", "Failed install of bionic: %s." ),
-                     cbm_name );
-            }
-            break;
-        }
-        case event_type::fails_to_remove_cbm: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                std::string cbm_name = e.get<bionic_id>( "bionic" )->name.translated();
-                add( pgettext( "memorial_male", "Failed to remove bionic: %s." ),
-                     pgettext( "memorial_female", "Failed to remove bionic: %s." ),
-                     cbm_name );
-            }
-            break;
-        }
-        case event_type::falls_asleep_from_exhaustion: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Succumbed to lack of sleep." ),
-                     pgettext( "memorial_female", "Succumbed to lack of sleep." ) );
-            }
-            break;
-        }
-        case event_type::fuel_tank_explodes: {
-            std::string name = e.get<cata_variant_type::string>( "vehicle_name" );
-            add( pgettext( "memorial_male", "The fuel tank of the %s exploded!" ),
-                 pgettext( "memorial_female", "The fuel tank of the %s exploded!" ),
-                 name );
-            break;
-        }
-        case event_type::gains_addiction: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add_type type = e.get<add_type>( "add_type" );
-                const std::string &type_name = addiction_type_name( type );
-                //~ %s is addiction name
-                add( pgettext( "memorial_male", "Became addicted to %s." ),
-                     pgettext( "memorial_female", "Became addicted to %s." ),
-                     type_name );
-            }
-            break;
-        }
-        case event_type::gains_mutation: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                trait_id trait = e.get<trait_id>( "trait" );
-                add( pgettext( "memorial_male", "Gained the mutation '%s'." ),
-                     pgettext( "memorial_female", "Gained the mutation '%s'." ),
-                     trait->name() );
+    return enum_bitset<event_type>();
+}
+
+void memorial_logger::listen_to( event_bus &bus )
+{
+    using activates_artifact = cata::typed_event<event_type::activates_artifact>;
+    bus.listen<event_type::activates_artifact>( this, [this]( const activates_artifact & e ) {
+        character_id ch = e.get<activates_artifact::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            std::string item_name = e.get<activates_artifact::field( "item_name" )>();
+            //~ %s is artifact name
+            add( pgettext( "memorial_male", "Activated the %s." ),
+                 pgettext( "memorial_female", "Activated the %s." ),
+                 item_name );
+        }
+    } );
+    using activates_mininuke = cata::typed_event<event_type::activates_mininuke>;
+    bus.listen<event_type::activates_mininuke>( this, [this]( const activates_mininuke & e ) {
+        character_id ch = e.get<activates_mininuke::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Activated a mininuke." ),
+                 pgettext( "memorial_female", "Activated a mininuke." ) );
+        }
+    } );
+    using administers_mutagen = cata::typed_event<event_type::administers_mutagen>;
+    bus.listen<event_type::administers_mutagen>( this, [this]( const administers_mutagen & e ) {
+        character_id ch = e.get<administers_mutagen::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            mutagen_technique technique = e.get<administers_mutagen::field( "technique" )>();
+            switch( technique ) {
+                case mutagen_technique::consumed_mutagen:
+                    add( pgettext( "memorial_male", "Consumed mutagen." ),
+                         pgettext( "memorial_female", "Consumed mutagen." ) );
+                    break;
+                case mutagen_technique::injected_mutagen:
+                    add( pgettext( "memorial_male", "Injected mutagen." ),
+                         pgettext( "memorial_female", "Injected mutagen." ) );
+                    break;
+                case mutagen_technique::consumed_purifier:
+                    add( pgettext( "memorial_male", "Consumed purifier." ),
+                         pgettext( "memorial_female", "Consumed purifier." ) );
+                    break;
+                case mutagen_technique::injected_purifier:
+                    add( pgettext( "memorial_male", "Injected purifier." ),
+                         pgettext( "memorial_female", "Injected purifier." ) );
+                    break;
+                case mutagen_technique::injected_smart_purifier:
+                    add( pgettext( "memorial_male", "Injected smart purifier." ),
+                         pgettext( "memorial_female", "Injected smart purifier." ) );
+                    break;
+                case mutagen_technique::num_mutagen_techniques:
+                    break;
             }
-            break;
         }
-        case event_type::gains_skill_level: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                skill_id skill = e.get<skill_id>( "skill" );
-                int new_level = e.get<int>( "new_level" );
-                if( new_level % 4 == 0 ) {
+    } );
+    using angers_amigara_horrors = cata::typed_event<event_type::angers_amigara_horrors>;
+    bus.listen<event_type::angers_amigara_horrors>( this, [this]( const angers_amigara_horrors & ) {
+        add( pgettext( "memorial_male", "Angered a group of amigara horrors!" ),
+             pgettext( "memorial_female", "Angered a group of amigara horrors!" ) );
+    } );
+    using awakes_dark_wyrms = cata::typed_event<event_type::awakes_dark_wyrms>;
+    bus.listen<event_type::awakes_dark_wyrms>( this, [this]( const awakes_dark_wyrms & ) {
+        add( pgettext( "memorial_male", "Awoke a group of dark wyrms!" ),
+             pgettext( "memorial_female", "Awoke a group of dark wyrms!" ) );
+    } );
+    using becomes_wanted = cata::typed_event<event_type::becomes_wanted>;
+    bus.listen<event_type::becomes_wanted>( this, [this]( const becomes_wanted & e ) {
+        character_id ch = e.get<becomes_wanted::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Became wanted by the police!" ),
+                 pgettext( "memorial_female", "Became wanted by the police!" ) );
+        }
+    } );
+    using broken_bone_mends = cata::typed_event<event_type::broken_bone_mends>;
+    bus.listen<event_type::broken_bone_mends>( this, [this]( const broken_bone_mends & e ) {
+        character_id ch = e.get<broken_bone_mends::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            body_part part = e.get<broken_bone_mends::field( "part" )>();
+            //~ %s is bodypart
+            add( pgettext( "memorial_male", "Broken %s began to mend." ),
+                 pgettext( "memorial_female", "Broken %s began to mend." ),
+                 body_part_name( part ) );
+        }
+    } );
+    using buries_corpse = cata::typed_event<event_type::buries_corpse>;
+    bus.listen<event_type::buries_corpse>( this, [this]( const buries_corpse & e ) {
+        character_id ch = e.get<buries_corpse::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            const mtype &corpse_type = e.get<buries_corpse::field( "corpse_type" )>().obj();
+            std::string corpse_name = e.get<buries_corpse::field( "corpse_name" )>();
+            if( corpse_name.empty() ) {
+                if( corpse_type.has_flag( MF_HUMAN ) ) {
                     add( pgettext( "memorial_male",
-                                   //~ %d is skill level %s is skill name
-                                   "Reached skill level %1$d in %2$s." ),
+                                   "You buried an unknown victim of the Cataclysm." ),
                          pgettext( "memorial_female",
-                                   //~ %d is skill level %s is skill name
-                                   "Reached skill level %1$d in %2$s." ),
-                         new_level, skill->name() );
+                                   "You buried an unknown victim of The Cataclysm." ) );
                 }
-            }
-            break;
-        }
-        case event_type::game_over: {
-            bool suicide = e.get<bool>( "is_suicide" );
-            std::string last_words = e.get<cata_variant_type::string>( "last_words" );
-            if( suicide ) {
-                add( pgettext( "memorial_male", "%s committed suicide." ),
-                     pgettext( "memorial_female", "%s committed suicide." ),
-                     g->u.name );
             } else {
-                add( pgettext( "memorial_male", "%s was killed." ),
-                     pgettext( "memorial_female", "%s was killed." ),
-                     g->u.name );
-            }
-            if( !last_words.empty() ) {
-                add( pgettext( "memorial_male", "Last words: %s" ),
-                     pgettext( "memorial_female", "Last words: %s" ),
-                     last_words );
+                add( pgettext( "memorial_male", "You buried %s." ),
+                     pgettext( "memorial_female", "You buried %s." ),
+                     corpse_name );
             }
-            break;
         }
-        case event_type::game_start: {
-            add( //~ %s is player name
-                pgettext( "memorial_male", "%s began their journey into the Cataclysm." ),
-                pgettext( "memorial_female", "%s began their journey into the Cataclysm." ),
-                g->u.name );
-            break;
-        }
-        case event_type::installs_cbm: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                std::string cbm_name = e.get<bionic_id>( "bionic" )->name.translated();
-                add( pgettext( "memorial_male", "Installed bionic: %s." ),
-                     pgettext( "memorial_female", "Installed bionic: %s." ),
-                     cbm_name );
-            }
-            break;
-        }
-        case event_type::installs_faulty_cbm: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                std::string cbm_name = e.get<bionic_id>( "bionic" )->name.translated();
-                add( pgettext( "memorial_male", "Installed bad bionic: %s." ),
-                     pgettext( "memorial_female", "Installed bad bionic: %s." ),
-                     cbm_name );
+    } );
+    using causes_resonance_cascade = cata::typed_event<event_type::causes_resonance_cascade>;
+    bus.listen<event_type::causes_resonance_cascade>( this,
+    [this]( const causes_resonance_cascade & ) {
+        add( pgettext( "memorial_male", "Caused a resonance cascade." ),
+             pgettext( "memorial_female", "Caused a resonance cascade." ) );
+    } );
+    using character_gains_effect = cata::typed_event<event_type::character_gains_effect>;
+    bus.listen<event_type::character_gains_effect>( this,
+    [this]( const character_gains_effect & e ) {
+        character_id ch = e.get<character_gains_effect::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            const effect_type &type = e.get<character_gains_effect::field( "effect" )>().obj();
+            const std::string message = type.get_apply_memorial_log();
+            if( !message.empty() ) {
+                add( pgettext( "memorial_male", message.c_str() ),
+                     pgettext( "memorial_female", message.c_str() ) );
             }
-            break;
         }
-        case event_type::learns_martial_art: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                matype_id mastyle = e.get<matype_id>( "martial_art" );
-                //~ %s is martial art
-                add( pgettext( "memorial_male", "Learned %s." ),
-                     pgettext( "memorial_female", "Learned %s." ),
-                     mastyle->name );
-            }
-            break;
-        }
-        case event_type::loses_addiction: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add_type type = e.get<add_type>( "add_type" );
-                const std::string &type_name = addiction_type_name( type );
-                //~ %s is addiction name
-                add( pgettext( "memorial_male", "Overcame addiction to %s." ),
-                     pgettext( "memorial_female", "Overcame addiction to %s." ),
-                     type_name );
+    } );
+    using character_kills_character = cata::typed_event<event_type::character_kills_character>;
+    bus.listen<event_type::character_kills_character>( this,
+    [this]( const character_kills_character & e ) {
+        character_id ch = e.get<character_kills_character::field( "killer" )>();
+        if( ch == g->u.getID() ) {
+            std::string name = e.get<character_kills_character::field( "victim_name" )>();
+            bool cannibal = g->u.has_trait( trait_CANNIBAL );
+            bool psycho = g->u.has_trait( trait_PSYCHOPATH );
+            if( g->u.has_trait( trait_SAPIOVORE ) ) {
+                add( pgettext( "memorial_male",
+                               "Caught and killed an ape.  Prey doesn't have a name." ),
+                     pgettext( "memorial_female",
+                               "Caught and killed an ape.  Prey doesn't have a name." ) );
+            } else if( psycho && cannibal ) {
+                add( pgettext( "memorial_male",
+                               "Killed a delicious-looking innocent, %s, in cold blood." ),
+                     pgettext( "memorial_female",
+                               "Killed a delicious-looking innocent, %s, in cold blood." ),
+                     name );
+            } else if( psycho ) {
+                add( pgettext( "memorial_male",
+                               "Killed an innocent, %s, in cold blood.  They were weak." ),
+                     pgettext( "memorial_female",
+                               "Killed an innocent, %s, in cold blood.  They were weak." ),
+                     name );
+            } else if( cannibal ) {
+                add( pgettext( "memorial_male", "Killed an innocent, %s." ),
+                     pgettext( "memorial_female", "Killed an innocent, %s." ),
+                     name );
+            } else {
+                add( pgettext( "memorial_male",
+                               "Killed an innocent person, %s, in cold blood and "
+                               "felt terrible afterwards." ),
+                     pgettext( "memorial_female",
+                               "Killed an innocent person, %s, in cold blood and "
+                               "felt terrible afterwards." ),
+                     name );
             }
-            break;
         }
-        case event_type::npc_becomes_hostile: {
-            std::string name = e.get<cata_variant_type::string>( "npc_name" );
-            add( pgettext( "memorial_male", "%s became hostile." ),
-                 pgettext( "memorial_female", "%s became hostile." ),
-                 name );
-            break;
-        }
-        case event_type::opens_portal: {
-            add( pgettext( "memorial_male", "Opened a portal." ),
-                 pgettext( "memorial_female", "Opened a portal." ) );
-            break;
-        }
-        case event_type::opens_temple: {
-            add( pgettext( "memorial_male", "Opened a strange temple." ),
-                 pgettext( "memorial_female", "Opened a strange temple." ) );
-            break;
-        }
-        case event_type::player_levels_spell: {
-            std::string spell_name = e.get<spell_id>( "spell" )->name.translated();
-            add( pgettext( "memorial_male", "Gained a spell level on %s." ),
-                 pgettext( "memorial_female", "Gained a spell level on %s." ),
-                 spell_name );
-            break;
-        }
-        case event_type::releases_subspace_specimens: {
-            add( pgettext( "memorial_male", "Released subspace specimens." ),
-                 pgettext( "memorial_female", "Released subspace specimens." ) );
-            break;
-        }
-        case event_type::removes_cbm: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                std::string cbm_name = e.get<bionic_id>( "bionic" )->name.translated();
-                add( pgettext( "memorial_male", "Removed bionic: %s." ),
-                     pgettext( "memorial_female", "Removed bionic: %s." ),
-                     cbm_name );
+    } );
+    using character_kills_monster = cata::typed_event<event_type::character_kills_monster>;
+    bus.listen<event_type::character_kills_monster>( this,
+    [this]( const character_kills_monster & e ) {
+        character_id ch = e.get<character_kills_monster::field( "killer" )>();
+        if( ch == g->u.getID() ) {
+            mtype_id victim_type = e.get<character_kills_monster::field( "victim_type" )>();
+            if( victim_type->difficulty >= 30 ) {
+                add( pgettext( "memorial_male", "Killed a %s." ),
+                     pgettext( "memorial_female", "Killed a %s." ),
+                     victim_type->nname() );
             }
-            break;
-        }
-        case event_type::seals_hazardous_material_sarcophagus: {
-            add( pgettext( "memorial_male", "Sealed a Hazardous Material Sarcophagus." ),
-                 pgettext( "memorial_female", "Sealed a Hazardous Material Sarcophagus." ) );
-            break;
         }
-        case event_type::telefrags_creature: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                std::string victim_name = e.get<cata_variant_type::string>( "victim_name" );
-                add( pgettext( "memorial_male", "Telefragged a %s." ),
-                     pgettext( "memorial_female", "Telefragged a %s." ),
-                     victim_name );
+    } );
+    using character_loses_effect = cata::typed_event<event_type::character_loses_effect>;
+    bus.listen<event_type::character_loses_effect>( this,
+    [this]( const character_loses_effect & e ) {
+        character_id ch = e.get<character_loses_effect::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            const effect_type &type = e.get<character_loses_effect::field( "effect" )>().obj();
+            const std::string message = type.get_remove_memorial_log();
+            if( !message.empty() ) {
+                add( pgettext( "memorial_male", message.c_str() ),
+                     pgettext( "memorial_female", message.c_str() ) );
             }
-            break;
         }
-        case event_type::teleglow_teleports: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Spontaneous teleport." ),
-                     pgettext( "memorial_female", "Spontaneous teleport." ) );
+    } );
+    using character_triggers_trap = cata::typed_event<event_type::character_triggers_trap>;
+    bus.listen<event_type::character_triggers_trap>( this,
+    [this]( const character_triggers_trap & e ) {
+        character_id ch = e.get<character_triggers_trap::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            trap_str_id trap = e.get<character_triggers_trap::field( "trap" )>();
+            if( trap == tr_bubblewrap ) {
+                add( pgettext( "memorial_male", "Stepped on bubble wrap." ),
+                     pgettext( "memorial_female", "Stepped on bubble wrap." ) );
+            } else if( trap == tr_glass ) {
+                add( pgettext( "memorial_male", "Stepped on glass." ),
+                     pgettext( "memorial_female", "Stepped on glass." ) );
+            } else if( trap == tr_beartrap ) {
+                add( pgettext( "memorial_male", "Caught by a beartrap." ),
+                     pgettext( "memorial_female", "Caught by a beartrap." ) );
+            } else if( trap == tr_nailboard ) {
+                add( pgettext( "memorial_male", "Stepped on a spiked board." ),
+                     pgettext( "memorial_female", "Stepped on a spiked board." ) );
+            } else if( trap == tr_caltrops ) {
+                add( pgettext( "memorial_male", "Stepped on a caltrop." ),
+                     pgettext( "memorial_female", "Stepped on a caltrop." ) );
+            } else if( trap == tr_caltrops_glass ) {
+                add( pgettext( "memorial_male", "Stepped on a glass caltrop." ),
+                     pgettext( "memorial_female", "Stepped on a glass caltrop." ) );
+            } else if( trap == tr_tripwire ) {
+                add( pgettext( "memorial_male", "Tripped on a tripwire." ),
+                     pgettext( "memorial_female", "Tripped on a tripwire." ) );
+            } else if( trap == tr_crossbow ) {
+                add( pgettext( "memorial_male", "Triggered a crossbow trap." ),
+                     pgettext( "memorial_female", "Triggered a crossbow trap." ) );
+            } else if( trap == tr_shotgun_1 || trap == tr_shotgun_2 ) {
+                add( pgettext( "memorial_male", "Triggered a shotgun trap." ),
+                     pgettext( "memorial_female", "Triggered a shotgun trap." ) );
+            } else if( trap == tr_blade ) {
+                add( pgettext( "memorial_male", "Triggered a blade trap." ),
+                     pgettext( "memorial_female", "Triggered a blade trap." ) );
+            } else if( trap == tr_light_snare ) {
+                add( pgettext( "memorial_male", "Triggered a light snare." ),
+                     pgettext( "memorial_female", "Triggered a light snare." ) );
+            } else if( trap == tr_heavy_snare ) {
+                add( pgettext( "memorial_male", "Triggered a heavy snare." ),
+                     pgettext( "memorial_female", "Triggered a heavy snare." ) );
+            } else if( trap == tr_landmine ) {
+                add( pgettext( "memorial_male", "Stepped on a land mine." ),
+                     pgettext( "memorial_female", "Stepped on a land mine." ) );
+            } else if( trap == tr_boobytrap ) {
+                add( pgettext( "memorial_male", "Triggered a booby trap." ),
+                     pgettext( "memorial_female", "Triggered a booby trap." ) );
+            } else if( trap == tr_telepad || trap == tr_portal ) {
+                add( pgettext( "memorial_male", "Triggered a teleport trap." ),
+                     pgettext( "memorial_female", "Triggered a teleport trap." ) );
+            } else if( trap == tr_goo ) {
+                add( pgettext( "memorial_male", "Stepped into thick goo." ),
+                     pgettext( "memorial_female", "Stepped into thick goo." ) );
+            } else if( trap == tr_dissector ) {
+                add( pgettext( "memorial_male", "Stepped into a dissector." ),
+                     pgettext( "memorial_female", "Stepped into a dissector." ) );
+            } else if( trap == tr_pit ) {
+                add( pgettext( "memorial_male", "Fell in a pit." ),
+                     pgettext( "memorial_female", "Fell in a pit." ) );
+            } else if( trap == tr_spike_pit ) {
+                add( pgettext( "memorial_male", "Fell into a spiked pit." ),
+                     pgettext( "memorial_female", "Fell into a spiked pit." ) );
+            } else if( trap == tr_glass_pit ) {
+                add( pgettext( "memorial_male", "Fell into a pit filled with glass shards." ),
+                     pgettext( "memorial_female", "Fell into a pit filled with glass shards." ) );
+            } else if( trap == tr_lava ) {
+                add( pgettext( "memorial_male", "Stepped into lava." ),
+                     pgettext( "memorial_female", "Stepped into lava." ) );
+            } else if( trap == tr_sinkhole ) {
+                add( pgettext( "memorial_male", "Stepped into a sinkhole." ),
+                     pgettext( "memorial_female", "Stepped into a sinkhole." ) );
+            } else if( trap == tr_ledge ) {
+                add( pgettext( "memorial_male", "Fell down a ledge." ),
+                     pgettext( "memorial_female", "Fell down a ledge." ) );
+            } else if( trap == tr_temple_flood ) {
+                add( pgettext( "memorial_male", "Triggered a flood trap." ),
+                     pgettext( "memorial_female", "Triggered a flood trap." ) );
+            } else if( trap == tr_shadow ) {
+                add( pgettext( "memorial_male", "Triggered a shadow trap." ),
+                     pgettext( "memorial_female", "Triggered a shadow trap." ) );
+            } else if( trap == tr_drain ) {
+                add( pgettext( "memorial_male", "Triggered a life-draining trap." ),
+                     pgettext( "memorial_female", "Triggered a life-draining trap." ) );
+            } else if( trap == tr_snake ) {
+                add( pgettext( "memorial_male", "Triggered a shadow snake trap." ),
+                     pgettext( "memorial_female", "Triggered a shadow snake trap." ) );
             }
-            break;
         }
-        case event_type::teleports_into_wall: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                std::string obstacle_name = e.get<cata_variant_type::string>( "obstacle_name" );
-                add( pgettext( "memorial_male", "Teleported into a %s." ),
-                     pgettext( "memorial_female", "Teleported into a %s." ),
-                     obstacle_name );
+    } );
+    using consumes_marloss_item = cata::typed_event<event_type::consumes_marloss_item>;
+    bus.listen<event_type::consumes_marloss_item>( this, [this]( const consumes_marloss_item & e ) {
+        character_id ch = e.get<consumes_marloss_item::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            itype_id it = e.get<consumes_marloss_item::field( "itype" )>();
+            std::string itname = it->nname( 1 );
+            add( pgettext( "memorial_male", "Consumed a %s." ),
+                 pgettext( "memorial_female", "Consumed a %s." ), itname );
+        }
+    } );
+    using crosses_marloss_threshold = cata::typed_event<event_type::crosses_marloss_threshold>;
+    bus.listen<event_type::crosses_marloss_threshold>( this,
+    [this]( const crosses_marloss_threshold & e ) {
+        character_id ch = e.get<crosses_marloss_threshold::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Opened the Marloss Gateway." ),
+                 pgettext( "memorial_female", "Opened the Marloss Gateway." ) );
+        }
+    } );
+    using crosses_mutation_threshold = cata::typed_event<event_type::crosses_mutation_threshold>;
+    bus.listen<event_type::crosses_mutation_threshold>( this,
+    [this]( const crosses_mutation_threshold & e ) {
+        character_id ch = e.get<crosses_mutation_threshold::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            mutation_category_id category_id =
+                e.get<crosses_mutation_threshold::field( "category" )>();
+            const mutation_category_trait &category =
+                mutation_category_trait::get_category( category_id );
+            add( category.memorial_message_male(),
+                 category.memorial_message_female() );
+        }
+    } );
+    using crosses_mycus_threshold = cata::typed_event<event_type::crosses_mycus_threshold>;
+    bus.listen<event_type::crosses_mycus_threshold>( this,
+    [this]( const crosses_mycus_threshold & e ) {
+        character_id ch = e.get<crosses_mycus_threshold::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Became one with the Mycus." ),
+                 pgettext( "memorial_female", "Became one with the Mycus." ) );
+        }
+    } );
+    using dermatik_eggs_hatch = cata::typed_event<event_type::dermatik_eggs_hatch>;
+    bus.listen<event_type::dermatik_eggs_hatch>( this, [this]( const dermatik_eggs_hatch & e ) {
+        character_id ch = e.get<dermatik_eggs_hatch::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Dermatik eggs hatched." ),
+                 pgettext( "memorial_female", "Dermatik eggs hatched." ) );
+        }
+    } );
+    using dermatik_eggs_injected = cata::typed_event<event_type::dermatik_eggs_injected>;
+    bus.listen<event_type::dermatik_eggs_injected>( this,
+    [this]( const dermatik_eggs_injected & e ) {
+        character_id ch = e.get<dermatik_eggs_injected::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Injected with dermatik eggs." ),
+                 pgettext( "memorial_female", "Injected with dermatik eggs." ) );
+        }
+    } );
+    using destroys_triffid_grove = cata::typed_event<event_type::destroys_triffid_grove>;
+    bus.listen<event_type::destroys_triffid_grove>( this, [this]( const destroys_triffid_grove & ) {
+        add( pgettext( "memorial_male", "Destroyed a triffid grove." ),
+             pgettext( "memorial_female", "Destroyed a triffid grove." ) );
+    } );
+    using dies_from_asthma_attack = cata::typed_event<event_type::dies_from_asthma_attack>;
+    bus.listen<event_type::dies_from_asthma_attack>( this,
+    [this]( const dies_from_asthma_attack & e ) {
+        character_id ch = e.get<dies_from_asthma_attack::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Succumbed to an asthma attack." ),
+                 pgettext( "memorial_female", "Succumbed to an asthma attack." ) );
+        }
+    } );
+    using dies_from_drug_overdose = cata::typed_event<event_type::dies_from_drug_overdose>;
+    bus.listen<event_type::dies_from_drug_overdose>( this,
+    [this]( const dies_from_drug_overdose & e ) {
+        character_id ch = e.get<dies_from_drug_overdose::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            efftype_id effect = e.get<dies_from_drug_overdose::field( "effect" )>();
+            if( effect == effect_datura ) {
+                add( pgettext( "memorial_male", "Died of datura overdose." ),
+                     pgettext( "memorial_female", "Died of datura overdose." ) );
+            } else if( effect == effect_jetinjector ) {
+                add( pgettext( "memorial_male", "Died of a healing stimulant overdose." ),
+                     pgettext( "memorial_female", "Died of a healing stimulant overdose." ) );
+            } else if( effect == effect_drunk ) {
+                add( pgettext( "memorial_male", "Died of an alcohol overdose." ),
+                     pgettext( "memorial_female", "Died of an alcohol overdose." ) );
+            } else {
+                add( pgettext( "memorial_male", "Died of a drug overdose." ),
+                     pgettext( "memorial_female", "Died of a drug overdose." ) );
             }
-            break;
         }
-        case event_type::terminates_subspace_specimens: {
-            add( pgettext( "memorial_male", "Terminated subspace specimens." ),
-                 pgettext( "memorial_female", "Terminated subspace specimens." ) );
-            break;
-        }
-        case event_type::throws_up: {
-            character_id ch = e.get<character_id>( "character" );
-            if( ch == g->u.getID() ) {
-                add( pgettext( "memorial_male", "Threw up." ),
-                     pgettext( "memorial_female", "Threw up." ) );
+    } );
+    using dies_of_infection = cata::typed_event<event_type::dies_of_infection>;
+    bus.listen<event_type::dies_of_infection>( this, [this]( const dies_of_infection & e ) {
+        character_id ch = e.get<dies_of_infection::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Succumbed to the infection." ),
+                 pgettext( "memorial_female", "Succumbed to the infection." ) );
+        }
+    } );
+    using dies_of_starvation = cata::typed_event<event_type::dies_of_starvation>;
+    bus.listen<event_type::dies_of_starvation>( this, [this]( const dies_of_starvation & e ) {
+        character_id ch = e.get<dies_of_starvation::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Died of starvation." ),
+                 pgettext( "memorial_female", "Died of starvation." ) );
+        }
+    } );
+    using dies_of_thirst = cata::typed_event<event_type::dies_of_thirst>;
+    bus.listen<event_type::dies_of_thirst>( this, [this]( const dies_of_thirst & e ) {
+        character_id ch = e.get<dies_of_thirst::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Died of thirst." ),
+                 pgettext( "memorial_female", "Died of thirst." ) );
+        }
+    } );
+    using digs_into_lava = cata::typed_event<event_type::digs_into_lava>;
+    bus.listen<event_type::digs_into_lava>( this, [this]( const digs_into_lava & ) {
+        add( pgettext( "memorial_male", "Dug a shaft into lava." ),
+             pgettext( "memorial_female", "Dug a shaft into lava." ) );
+    } );
+    using disarms_nuke = cata::typed_event<event_type::disarms_nuke>;
+    bus.listen<event_type::disarms_nuke>( this, [this]( const disarms_nuke & ) {
+        add( pgettext( "memorial_male", "Disarmed a nuclear missile." ),
+             pgettext( "memorial_female", "Disarmed a nuclear missile." ) );
+    } );
+    using eats_sewage = cata::typed_event<event_type::eats_sewage>;
+    bus.listen<event_type::eats_sewage>( this, [this]( const eats_sewage & ) {
+        add( pgettext( "memorial_male", "Ate a sewage sample." ),
+             pgettext( "memorial_female", "Ate a sewage sample." ) );
+    } );
+    using evolves_mutation = cata::typed_event<event_type::evolves_mutation>;
+    bus.listen<event_type::evolves_mutation>( this, [this]( const evolves_mutation & e ) {
+        character_id ch = e.get<evolves_mutation::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            trait_id from = e.get<evolves_mutation::field( "from_trait" )>();
+            trait_id to = e.get<evolves_mutation::field( "to_trait" )>();
+            add( pgettext( "memorial_male", "'%s' mutation turned into '%s'" ),
+                 pgettext( "memorial_female", "'%s' mutation turned into '%s'" ),
+                 from->name(), to->name() );
+        }
+    } );
+    using exhumes_grave = cata::typed_event<event_type::exhumes_grave>;
+    bus.listen<event_type::exhumes_grave>( this, [this]( const exhumes_grave & e ) {
+        character_id ch = e.get<exhumes_grave::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Exhumed a grave." ),
+                 pgettext( "memorial_female", "Exhumed a grave." ) );
+        }
+    } );
+    using fails_to_install_cbm = cata::typed_event<event_type::fails_to_install_cbm>;
+    bus.listen<event_type::fails_to_install_cbm>( this, [this]( const fails_to_install_cbm & e ) {
+        character_id ch = e.get<fails_to_install_cbm::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            const bionic_id &bionic = e.get<fails_to_install_cbm::field( "bionic" )>();
+            std::string cbm_name = bionic->name.translated();
+            add( pgettext( "memorial_male", "Failed install of bionic: %s." ),
+                 pgettext( "memorial_female", "Failed install of bionic: %s." ),
+                 cbm_name );
+        }
+    } );
+    using fails_to_remove_cbm = cata::typed_event<event_type::fails_to_remove_cbm>;
+    bus.listen<event_type::fails_to_remove_cbm>( this, [this]( const fails_to_remove_cbm & e ) {
+        character_id ch = e.get<fails_to_remove_cbm::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            const bionic_id &bionic = e.get<fails_to_remove_cbm::field( "bionic" )>();
+            std::string cbm_name = bionic->name.translated();
+            add( pgettext( "memorial_male", "Failed to remove bionic: %s." ),
+                 pgettext( "memorial_female", "Failed to remove bionic: %s." ),
+                 cbm_name );
+        }
+    } );
+    using falls_asleep_from_exhaustion =
+        cata::typed_event<event_type::falls_asleep_from_exhaustion>;
+    bus.listen<event_type::falls_asleep_from_exhaustion>( this,
+    [this]( const falls_asleep_from_exhaustion & e ) {
+        character_id ch = e.get<falls_asleep_from_exhaustion::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Succumbed to lack of sleep." ),
+                 pgettext( "memorial_female", "Succumbed to lack of sleep." ) );
+        }
+    } );
+    using fuel_tank_explodes = cata::typed_event<event_type::fuel_tank_explodes>;
+    bus.listen<event_type::fuel_tank_explodes>( this, [this]( const fuel_tank_explodes & e ) {
+        std::string name = e.get<fuel_tank_explodes::field( "vehicle_name" )>();
+        add( pgettext( "memorial_male", "The fuel tank of the %s exploded!" ),
+             pgettext( "memorial_female", "The fuel tank of the %s exploded!" ),
+             name );
+    } );
+    using gains_addiction = cata::typed_event<event_type::gains_addiction>;
+    bus.listen<event_type::gains_addiction>( this, [this]( const gains_addiction & e ) {
+        character_id ch = e.get<gains_addiction::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add_type type = e.get<gains_addiction::field( "add_type" )>();
+            const std::string &type_name = addiction_type_name( type );
+            //~ %s is addiction name
+            add( pgettext( "memorial_male", "Became addicted to %s." ),
+                 pgettext( "memorial_female", "Became addicted to %s." ),
+                 type_name );
+        }
+    } );
+    using gains_mutation = cata::typed_event<event_type::gains_mutation>;
+    bus.listen<event_type::gains_mutation>( this, [this]( const gains_mutation & e ) {
+        character_id ch = e.get<gains_mutation::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            trait_id trait = e.get<gains_mutation::field( "trait" )>();
+            add( pgettext( "memorial_male", "Gained the mutation '%s'." ),
+                 pgettext( "memorial_female", "Gained the mutation '%s'." ),
+                 trait->name() );
+        }
+    } );
+    using gains_skill_level = cata::typed_event<event_type::gains_skill_level>;
+    bus.listen<event_type::gains_skill_level>( this, [this]( const gains_skill_level & e ) {
+        character_id ch = e.get<gains_skill_level::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            skill_id skill = e.get<gains_skill_level::field( "skill" )>();
+            int new_level = e.get<gains_skill_level::field( "new_level" )>();
+            if( new_level % 4 == 0 ) {
+                add( pgettext( "memorial_male",
+                               //~ %d is skill level %s is skill name
+                               "Reached skill level %1$d in %2$s." ),
+                     pgettext( "memorial_female",
+                               //~ %d is skill level %s is skill name
+                               "Reached skill level %1$d in %2$s." ),
+                     new_level, skill->name() );
             }
-            break;
-        }
-        case event_type::triggers_alarm: {
-            add( pgettext( "memorial_male", "Set off an alarm." ),
-                 pgettext( "memorial_female", "Set off an alarm." ) );
-            break;
-        }
-        // All the events for which we have no memorial log are here
-        case event_type::avatar_moves:
-        case event_type::character_gets_headshot:
-        case event_type::character_heals_damage:
-        case event_type::character_takes_damage:
-        case event_type::character_wakes_up:
-            break;
-        case event_type::num_event_types: {
-            debugmsg( "Invalid event type" );
-            break;
         }
-
-    }
+    } );
+    using game_over = cata::typed_event<event_type::game_over>;
+    bus.listen<event_type::game_over>( this, [this]( const game_over & e ) {
+        bool suicide = e.get<game_over::field( "is_suicide" )>();
+        std::string last_words = e.get<game_over::field( "last_words" )>();
+        if( suicide ) {
+            add( pgettext( "memorial_male", "%s committed suicide." ),
+                 pgettext( "memorial_female", "%s committed suicide." ),
+                 g->u.name );
+        } else {
+            add( pgettext( "memorial_male", "%s was killed." ),
+                 pgettext( "memorial_female", "%s was killed." ),
+                 g->u.name );
+        }
+        if( !last_words.empty() ) {
+            add( pgettext( "memorial_male", "Last words: %s" ),
+                 pgettext( "memorial_female", "Last words: %s" ),
+                 last_words );
+        }
+    } );
+    using game_start = cata::typed_event<event_type::game_start>;
+    bus.listen<event_type::game_start>( this, [this]( const game_start & ) {
+        add( //~ %s is player name
+            pgettext( "memorial_male", "%s began their journey into the Cataclysm." ),
+            pgettext( "memorial_female", "%s began their journey into the Cataclysm." ),
+            g->u.name );
+    } );
+    using installs_cbm = cata::typed_event<event_type::installs_cbm>;
+    bus.listen<event_type::installs_cbm>( this, [this]( const installs_cbm & e ) {
+        character_id ch = e.get<installs_cbm::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            const bionic_id &bionic = e.get<installs_cbm::field( "bionic" )>();
+            std::string cbm_name = bionic->name.translated();
+            add( pgettext( "memorial_male", "Installed bionic: %s." ),
+                 pgettext( "memorial_female", "Installed bionic: %s." ),
+                 cbm_name );
+        }
+    } );
+    using installs_faulty_cbm = cata::typed_event<event_type::installs_faulty_cbm>;
+    bus.listen<event_type::installs_faulty_cbm>( this, [this]( const installs_faulty_cbm & e ) {
+        character_id ch = e.get<installs_faulty_cbm::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            const bionic_id &bionic = e.get<installs_faulty_cbm::field( "bionic" )>();
+            std::string cbm_name = bionic->name.translated();
+            add( pgettext( "memorial_male", "Installed bad bionic: %s." ),
+                 pgettext( "memorial_female", "Installed bad bionic: %s." ),
+                 cbm_name );
+        }
+    } );
+    using learns_martial_art = cata::typed_event<event_type::learns_martial_art>;
+    bus.listen<event_type::learns_martial_art>( this, [this]( const learns_martial_art & e ) {
+        character_id ch = e.get<learns_martial_art::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            matype_id mastyle = e.get<learns_martial_art::field( "martial_art" )>();
+            //~ %s is martial art
+            add( pgettext( "memorial_male", "Learned %s." ),
+                 pgettext( "memorial_female", "Learned %s." ),
+                 mastyle->name );
+        }
+    } );
+    using loses_addiction = cata::typed_event<event_type::loses_addiction>;
+    bus.listen<event_type::loses_addiction>( this, [this]( const loses_addiction & e ) {
+        character_id ch = e.get<loses_addiction::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add_type type = e.get<loses_addiction::field( "add_type" )>();
+            const std::string &type_name = addiction_type_name( type );
+            //~ %s is addiction name
+            add( pgettext( "memorial_male", "Overcame addiction to %s." ),
+                 pgettext( "memorial_female", "Overcame addiction to %s." ),
+                 type_name );
+        }
+    } );
+    using npc_becomes_hostile = cata::typed_event<event_type::npc_becomes_hostile>;
+    bus.listen<event_type::npc_becomes_hostile>( this, [this]( const npc_becomes_hostile & e ) {
+        std::string name = e.get<npc_becomes_hostile::field( "npc_name" )>();
+        add( pgettext( "memorial_male", "%s became hostile." ),
+             pgettext( "memorial_female", "%s became hostile." ),
+             name );
+    } );
+    using opens_portal = cata::typed_event<event_type::opens_portal>;
+    bus.listen<event_type::opens_portal>( this, [this]( const opens_portal & ) {
+        add( pgettext( "memorial_male", "Opened a portal." ),
+             pgettext( "memorial_female", "Opened a portal." ) );
+    } );
+    using opens_temple = cata::typed_event<event_type::opens_temple>;
+    bus.listen<event_type::opens_temple>( this, [this]( const opens_temple & ) {
+        add( pgettext( "memorial_male", "Opened a strange temple." ),
+             pgettext( "memorial_female", "Opened a strange temple." ) );
+    } );
+    using player_levels_spell = cata::typed_event<event_type::player_levels_spell>;
+    bus.listen<event_type::player_levels_spell>( this, [this]( const player_levels_spell & e ) {
+        std::string spell_name = e.get<player_levels_spell::field( "spell" )>()->name.translated();
+        add( pgettext( "memorial_male", "Gained a spell level on %s." ),
+             pgettext( "memorial_female", "Gained a spell level on %s." ),
+             spell_name );
+    } );
+    using releases_subspace_specimens = cata::typed_event<event_type::releases_subspace_specimens>;
+    bus.listen<event_type::releases_subspace_specimens>( this,
+    [this]( const releases_subspace_specimens & ) {
+        add( pgettext( "memorial_male", "Released subspace specimens." ),
+             pgettext( "memorial_female", "Released subspace specimens." ) );
+    } );
+    using removes_cbm = cata::typed_event<event_type::removes_cbm>;
+    bus.listen<event_type::removes_cbm>( this, [this]( const removes_cbm & e ) {
+        character_id ch = e.get<removes_cbm::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            const bionic_id &bionic = e.get<removes_cbm::field( "bionic" )>();
+            std::string cbm_name = bionic->name.translated();
+            add( pgettext( "memorial_male", "Removed bionic: %s." ),
+                 pgettext( "memorial_female", "Removed bionic: %s." ),
+                 cbm_name );
+        }
+    } );
+    using seals_hazardous_material_sarcophagus =
+        cata::typed_event<event_type::seals_hazardous_material_sarcophagus>;
+    bus.listen<event_type::seals_hazardous_material_sarcophagus>( this,
+    [this]( const seals_hazardous_material_sarcophagus & ) {
+        add( pgettext( "memorial_male", "Sealed a Hazardous Material Sarcophagus." ),
+             pgettext( "memorial_female", "Sealed a Hazardous Material Sarcophagus." ) );
+    } );
+    using telefrags_creature = cata::typed_event<event_type::telefrags_creature>;
+    bus.listen<event_type::telefrags_creature>( this, [this]( const telefrags_creature & e ) {
+        character_id ch = e.get<telefrags_creature::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            std::string victim_name = e.get<telefrags_creature::field( "victim_name" )>();
+            add( pgettext( "memorial_male", "Telefragged a %s." ),
+                 pgettext( "memorial_female", "Telefragged a %s." ),
+                 victim_name );
+        }
+    } );
+    using teleglow_teleports = cata::typed_event<event_type::teleglow_teleports>;
+    bus.listen<event_type::teleglow_teleports>( this, [this]( const teleglow_teleports & e ) {
+        character_id ch = e.get<teleglow_teleports::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Spontaneous teleport." ),
+                 pgettext( "memorial_female", "Spontaneous teleport." ) );
+        }
+    } );
+    using teleports_into_wall = cata::typed_event<event_type::teleports_into_wall>;
+    bus.listen<event_type::teleports_into_wall>( this, [this]( const teleports_into_wall & e ) {
+        character_id ch = e.get<teleports_into_wall::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            std::string obstacle_name = e.get<teleports_into_wall::field( "obstacle_name" )>();
+            add( pgettext( "memorial_male", "Teleported into a %s." ),
+                 pgettext( "memorial_female", "Teleported into a %s." ),
+                 obstacle_name );
+        }
+    } );
+    using terminates_subspace_specimens =
+        cata::typed_event<event_type::terminates_subspace_specimens>;
+    bus.listen<event_type::terminates_subspace_specimens>( this,
+    [this]( const terminates_subspace_specimens & ) {
+        add( pgettext( "memorial_male", "Terminated subspace specimens." ),
+             pgettext( "memorial_female", "Terminated subspace specimens." ) );
+    } );
+    using throws_up = cata::typed_event<event_type::throws_up>;
+    bus.listen<event_type::throws_up>( this, [this]( const throws_up & e ) {
+        character_id ch = e.get<throws_up::field( "character" )>();
+        if( ch == g->u.getID() ) {
+            add( pgettext( "memorial_male", "Threw up." ),
+                 pgettext( "memorial_female", "Threw up." ) );
+        }
+    } );
+    using triggers_alarm = cata::typed_event<event_type::triggers_alarm>;
+    bus.listen<event_type::triggers_alarm>( this, [this]( const triggers_alarm & ) {
+        add( pgettext( "memorial_male", "Set off an alarm." ),
+             pgettext( "memorial_female", "Set off an alarm." ) );
+    } );
 }
@@ -43,7 +43,8 @@ class memorial_logger : public event_subscriber
         // Prints out the final memorial file
         void write( std::ostream &memorial_file, const std::string &epitaph ) const;
 
-        void notify( const cata::event & ) override;
+        enum_bitset<event_type> notified_types() const override;
+        void listen_to( event_bus & ) override;
     private:
         std::vector<std::string> log;
 };
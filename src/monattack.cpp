@@ -4822,7 +4822,7 @@ bool mattack::riotbot( monster *z )
             z->anger = 0;
 
             detached_ptr<item> handcuffs = item::spawn( "e_handcuffs", calendar::start_of_cataclysm );
-            handcuffs->charges = handcuffs->type->maximum_charges();
+            handcuffs->set_charges( handcuffs->type->maximum_charges() );
             handcuffs->active = true;
             handcuffs->set_var( "HANDCUFFS_X", foe->posx() );
             handcuffs->set_var( "HANDCUFFS_Y", foe->posy() );
@@ -5591,7 +5591,7 @@ bool mattack::kamikaze( monster *z )
     /* Replacement code here for once we have working monster inventories
 
     item i_explodes(act_bomb_type->id, 0);
-    i_explodes.charges = charges;
+    i_explodes.set_charges( charges );
     z->add_item(i_explodes);
     z->disable_special("KAMIKAZE");
     */
@@ -871,7 +871,7 @@ void mdeath::detonate( monster &z )
     // Then detonate our suicide bombs
     for( const auto &bombs : dets ) {
         detached_ptr<item> bomb_item = item::spawn( bombs.first, calendar::start_of_cataclysm );
-        bomb_item->charges = bombs.second;
+        bomb_item->set_charges( bombs.second );
         bomb_item->active = true;
         g->m.add_item_or_charges( z.pos(), std::move( bomb_item ) );
     }
@@ -713,7 +713,7 @@ bool monexamine::give_items_to( monster &z )
         item *it_copy = &*itq.loc;
         if( it_copy->count_by_charges() ) {
             it_copy = item::spawn_temporary( *it_copy );
-            it_copy->charges = itq.count;
+            it_copy->set_charges( itq.count );
         }
 
         units::volume item_volume = it_copy->volume();
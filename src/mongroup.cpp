@@ -11,6 +11,7 @@
 #include "options.h"
 #include "rng.h"
 #include "string_id.h"
+#include "typed_options.h"
 
 //  Frequency: If you don't use the whole 1000 points of frequency for each of
 //     the monsters, the remaining points will go to the defaultMonster.
@@ -83,9 +84,9 @@ float mongroup::avg_speed() const
 const MonsterGroup &MonsterGroupManager::GetUpgradedMonsterGroup( const mongroup_id &group )
 {
     const MonsterGroup *groupptr = &group.obj();
-    if( get_option<float>( "MONSTER_UPGRADE_FACTOR" ) > 0 ) {
+    if( get_option( option::MONSTER_UPGRADE_FACTOR ) > 0 ) {
         const time_duration replace_time = groupptr->monster_group_time *
-                                           get_option<float>( "MONSTER_UPGRADE_FACTOR" );
+                                           get_option( option::MONSTER_UPGRADE_FACTOR );
         while( groupptr->replace_monster_group &&
                calendar::turn - time_point( calendar::start_of_cataclysm ) > replace_time ) {
             groupptr = &groupptr->new_monster_group.obj();
@@ -331,7 +332,7 @@ void MonsterGroupManager::FinalizeMonsterGroups()
 
 void MonsterGroupManager::LoadMonsterGroup( const JsonObject &jo )
 {
-    float mon_upgrade_factor = get_option<float>( "MONSTER_UPGRADE_FACTOR" );
+    float mon_upgrade_factor = get_option( option::MONSTER_UPGRADE_FACTOR );
 
     MonsterGroup g;
 
@@ -122,13 +122,14 @@ static bool z_is_valid( int z )
 
 bool monster::will_move_to( const tripoint &p ) const
 {
+    static const ter_furn_flag burrowable( "BURROWABLE" );
     if( g->m.impassable( p ) ) {
         tripoint above_p = p + tripoint_above;
         if( digging() ) {
-            if( !g->m.has_flag( "BURROWABLE", p ) ) {
+            if( !g->m.has_flag( burrowable, p ) ) {
                 return false;
             }
-        } else if( !( can_climb() && g->m.has_flag( "CLIMBABLE", p ) &&
+        } else if( !( can_climb() && g->m.has_flag( TFLAG_CLIMBABLE, p ) &&
                       !g->m.has_floor_or_support( above_p ) ) ) {
             return false;
         }
@@ -138,11 +139,11 @@ bool monster::will_move_to( const tripoint &p ) const
         return false;
     }
 
-    if( digs() && !g->m.has_flag( "DIGGABLE", p ) && !g->m.has_flag( "BURROWABLE", p ) ) {
+    if( digs() && !g->m.has_flag( TFLAG_DIGGABLE, p ) && !g->m.has_flag( burrowable, p ) ) {
         return false;
     }
 
-    if( has_flag( MF_AQUATIC ) && !g->m.has_flag( "SWIMMABLE", p ) ) {
+    if( has_flag( MF_AQUATIC ) && !g->m.has_flag( TFLAG_SWIMMABLE, p ) ) {
         return false;
     }
 
@@ -200,7 +201,7 @@ bool monster::will_move_to( const tripoint &p ) const
         // Some things are only avoided if we're not attacking
         if( attitude( &g->u ) != MATT_ATTACK ) {
             // Sharp terrain is ignored while attacking
-            if( avoid_simple && g->m.has_flag( "SHARP", p ) &&
+            if( avoid_simple && g->m.has_flag( TFLAG_SHARP, p ) &&
                 !( type->size == creature_size::tiny || flies() ) ) {
                 return false;
             }
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bitset>
 #include <functional>
 #include <iosfwd>
 #include <iterator>
@@ -482,6 +483,37 @@ struct healing_options {
     bool all_false();
 };
 
+/**
+ * Snapshot of what an NPC perceives around itself, valid for one turn and position.
+ * Everything is resolved lazily and memoized, so what nobody asks about costs nothing.
+ */
+struct npc_perception_cache {
+    static constexpr int radius = 6;
+    static constexpr int diameter = 2 * radius + 1;
+
+    // Turn and position the snapshot was taken at, it is stale if either changed
+    time_point turn = calendar::before_time_starts;
+    tripoint origin = tripoint_min;
+    // Player's followers, resolved through the overmap buffer
+    std::vector<weak_ptr_fast<npc>> followers;
+    bool followers_known = false;
+    // Tiles within radius that hold items on the ground or may hold them in vehicle cargo,
+    // ordered closest first
+    std::vector<tripoint> item_tiles;
+    bool item_tiles_known = false;
+    // Whether the NPC itself is seen by the player or a follower
+    bool observed_self = false;
+    bool observed_self_known = false;
+
+    std::bitset<diameter *diameter> visible_known;
+    std::bitset<diameter *diameter> visible;
+    std::bitset<diameter *diameter> observed_known;
+    std::bitset<diameter *diameter> observed;
+
+    // Index of p in the bitmaps, or -1 if it's outside the snapshot
+    int index_of( const tripoint &p ) const;
+};
+
 // Data relevant only for this action
 struct npc_short_term_cache {
     float danger = 0;
@@ -508,6 +540,7 @@ struct npc_short_term_cache {
     std::map<direction, float> threat_map;
     // Cache of locations the NPC has searched recently in npc::find_item()
     lru_cache<tripoint, int> searched_tiles;
+    npc_perception_cache perception;
 };
 
 struct npc_need_goal_cache {
@@ -923,6 +956,14 @@ class npc : public player
 
         // AI helpers
         void regen_ai_cache();
+        // Forgets ai_cache.perception if it's from an earlier turn or position
+        void refresh_perception();
+        // Tiles near the NPC that may hold items, closest first, see npc_perception_cache
+        const std::vector<tripoint> &perceived_item_tiles();
+        // Same as sees( p ), but memoized in the perception snapshot when p is within its radius
+        bool perceives( const tripoint &p );
+        // Whether the player or one of their followers would see this NPC taking from p
+        bool observed_by_followers( const tripoint &p );
         const Creature *current_target() const;
         Creature *current_target();
         const Creature *current_ally() const;
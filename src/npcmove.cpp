@@ -327,7 +327,7 @@ std::vector<sphere> npc::find_dangerous_explosives() const
 
         const int turns_to_evacuate = 2 * safe_range / speed_rating();
 
-        if( elem->charges > turns_to_evacuate ) {
+        if( elem->charges() > turns_to_evacuate ) {
             continue;   // Consider only imminent dangers.
         }
 
@@ -448,11 +448,11 @@ void npc::assess_danger()
 
         if( has_faction_relationship( guy, npc_factions::watch_your_back ) ) {
             ai_cache.friends.emplace_back( g->shared_from( guy ) );
-        } else if( attitude_to( guy ) != Attitude::A_NEUTRAL && sees( guy.pos() ) ) {
+        } else if( attitude_to( guy ) != Attitude::A_NEUTRAL && perceives( guy.pos() ) ) {
             hostile_guys.emplace_back( g->shared_from( guy ) );
         }
     }
-    if( sees( player_character.pos() ) ) {
+    if( perceives( player_character.pos() ) ) {
         if( is_enemy() ) {
             hostile_guys.emplace_back( g->shared_from( player_character ) );
         } else if( is_friendly( player_character ) ) {
@@ -648,6 +648,123 @@ float npc::character_danger( const Character &u ) const
     return ret;
 }
 
+int npc_perception_cache::index_of( const tripoint &p ) const
+{
+    const tripoint d = p - origin;
+    if( d.z != 0 || std::abs( d.x ) > radius || std::abs( d.y ) > radius ) {
+        return -1;
+    }
+    return ( d.y + radius ) * diameter + d.x + radius;
+}
+
+void npc::refresh_perception()
+{
+    npc_perception_cache &snapshot = ai_cache.perception;
+    if( snapshot.turn == calendar::turn && snapshot.origin == pos() ) {
+        return;
+    }
+    snapshot.turn = calendar::turn;
+    snapshot.origin = pos();
+    snapshot.visible_known.reset();
+    snapshot.observed_known.reset();
+    snapshot.followers_known = false;
+    snapshot.item_tiles_known = false;
+    snapshot.observed_self_known = false;
+}
+
+const std::vector<tripoint> &npc::perceived_item_tiles()
+{
+    refresh_perception();
+    npc_perception_cache &snapshot = ai_cache.perception;
+    if( snapshot.item_tiles_known ) {
+        return snapshot.item_tiles;
+    }
+    snapshot.item_tiles_known = true;
+    map &here = get_map();
+    const level_cache &cache = here.get_cache_ref( posz() );
+    snapshot.item_tiles.clear();
+    for( const tripoint &p : closest_points_first( pos(), npc_perception_cache::radius ) ) {
+        if( !here.inbounds( p ) ) {
+            continue;
+        }
+        if( here.has_items( p ) || ( cache.veh_in_active_range && cache.veh_exists_at[p.x][p.y] ) ) {
+            snapshot.item_tiles.push_back( p );
+        }
+    }
+    return snapshot.item_tiles;
+}
+
+bool npc::perceives( const tripoint &p )
+{
+    refresh_perception();
+    npc_perception_cache &snapshot = ai_cache.perception;
+    const int idx = snapshot.index_of( p );
+    if( idx < 0 ) {
+        return sees( p );
+    }
+    if( !snapshot.visible_known[idx] ) {
+        snapshot.visible_known[idx] = true;
+        snapshot.visible[idx] = sees( p );
+    }
+    return snapshot.visible[idx];
+}
+
+bool npc::observed_by_followers( const tripoint &p )
+{
+    refresh_perception();
+    npc_perception_cache &snapshot = ai_cache.perception;
+    if( !snapshot.followers_known ) {
+        snapshot.followers_known = true;
+        snapshot.followers.clear();
+        for( const character_id &elem : g->get_follower_list() ) {
+            shared_ptr_fast<npc> npc_to_get = overmap_buffer.find_npc( elem );
+            if( npc_to_get ) {
+                snapshot.followers.emplace_back( npc_to_get );
+            }
+        }
+    }
+    // Nobody is watching out for theft unless the player has followers
+    if( snapshot.followers.empty() ) {
+        return false;
+    }
+    if( !snapshot.observed_self_known ) {
+        snapshot.observed_self_known = true;
+        snapshot.observed_self = get_player_character().sees( pos() );
+        for( const weak_ptr_fast<npc> &elem : snapshot.followers ) {
+            if( snapshot.observed_self ) {
+                break;
+            }
+            if( const shared_ptr_fast<npc> guy = elem.lock() ) {
+                snapshot.observed_self = guy->sees( pos() );
+            }
+        }
+    }
+    if( snapshot.observed_self ) {
+        return true;
+    }
+    const auto observed = [&snapshot]( const tripoint & pt ) {
+        if( get_player_character().sees( pt ) ) {
+            return true;
+        }
+        for( const weak_ptr_fast<npc> &elem : snapshot.followers ) {
+            const shared_ptr_fast<npc> guy = elem.lock();
+            if( guy && guy->sees( pt ) ) {
+                return true;
+            }
+        }
+        return false;
+    };
+    const int idx = snapshot.index_of( p );
+    if( idx < 0 ) {
+        return observed( p );
+    }
+    if( !snapshot.observed_known[idx] ) {
+        snapshot.observed_known[idx] = true;
+        snapshot.observed[idx] = observed( p );
+    }
+    return snapshot.observed[idx];
+}
+
 void npc::regen_ai_cache()
 {
     map &here = get_map();
@@ -2742,7 +2859,8 @@ void npc::find_item()
     units::volume volume_allowed = volume_capacity() - volume_carried();
     units::mass   weight_allowed = weight_capacity() - weight_carried();
     // For some reason range limiting by vision doesn't work properly
-    const int range = 6;
+    // Must match the perception snapshot, which only covers tiles within its radius
+    const int range = npc_perception_cache::radius;
     //int range = sight_range( g->light_level( posz() ) );
     //range = std::max( 1, std::min( 12, range ) );
 
@@ -2763,22 +2881,8 @@ void npc::find_item()
             // Don't even consider liquids.
             return;
         }
-        std::vector<npc *> followers;
-        for( auto &elem : g->get_follower_list() ) {
-            shared_ptr_fast<npc> npc_to_get = overmap_buffer.find_npc( elem );
-            if( !npc_to_get ) {
-                continue;
-            }
-            npc *npc_to_add = npc_to_get.get();
-            followers.push_back( npc_to_add );
-        }
-        Character &player_character = get_player_character();
-        for( auto &elem : followers ) {
-            if( !it.is_owned_by( *this, true ) && ( player_character.sees( this->pos() ) ||
-                                                    player_character.sees( wanted_item_pos ) ||
-                                                    elem->sees( this->pos() ) || elem->sees( wanted_item_pos ) ) ) {
-                return;
-            }
+        if( !it.is_owned_by( *this, true ) && observed_by_followers( p ) ) {
+            return;
         }
         if( whitelisting && !item_whitelisted( it ) ) {
             return;
@@ -2816,8 +2920,13 @@ void npc::find_item()
         }
     };
 
-    for( const tripoint &p : closest_points_first( pos(), range ) ) {
-        // TODO: Make this sight check not overdraw nearby tiles
+    // Harvesting needs to look at every tile, otherwise only tiles that may hold items matter
+    std::vector<tripoint> all_tiles;
+    if( whitelisting ) {
+        all_tiles = closest_points_first( pos(), range );
+    }
+    const std::vector<tripoint> &candidate_tiles = whitelisting ? all_tiles : perceived_item_tiles();
+    for( const tripoint &p : candidate_tiles ) {
         // TODO: Optimize that zone check
         if( is_player_ally() && g->check_zone( zone_type_no_npc_pickup, p ) ) {
             continue;
@@ -2844,21 +2953,18 @@ void npc::find_item()
                 ai_cache.searched_tiles.insert( 1000, abs_p, num_items );
             }
         };
-        bool can_see = false;
-        if( here.sees_some_items( p, *this ) && sees( p ) ) {
-            can_see = true;
+        const bool can_see = perceives( p );
+        if( can_see && here.sees_some_items( p, *this ) ) {
             for( const item * const &it : m_stack ) {
                 consider_item( *it, p );
             }
         }
 
-        // Not cached because it gets checked once and isn't expected to change.
-        if( can_see || sees( p ) ) {
-            can_see = true;
+        if( can_see ) {
             consider_terrain( p );
         }
 
-        if( !vp || vp->vehicle().is_moving() || !( can_see || sees( p ) ) ) {
+        if( !vp || vp->vehicle().is_moving() || !can_see ) {
             cache_tile();
             continue;
         }
@@ -3227,7 +3333,7 @@ bool npc::find_corpse_to_pulp()
         return nullptr;
     };
 
-    const int range = 6;
+    const int range = npc_perception_cache::radius;
 
     const item *corpse = nullptr;
     if( pulp_location && square_dist( pos(), *pulp_location ) <= range ) {
@@ -4537,9 +4643,9 @@ void npc::do_reload( item &it )
 
     // If in danger, don't spend multiple turns reloading a weapon to full one by one.
     // Get enough to shoot the enemy once, then unload it on them.
-    int qty = ai_cache.danger > 0 ? std::max( 1, std::min( usable_ammo->charges,
+    int qty = ai_cache.danger > 0 ? std::max( 1, std::min( usable_ammo->charges(),
               it.ammo_required() - it.ammo_remaining() ) ) :
-              std::max( 1, std::min( usable_ammo->charges, it.ammo_capacity() - it.ammo_remaining() ) );
+              std::max( 1, std::min( usable_ammo->charges(), it.ammo_capacity() - it.ammo_remaining() ) );
     int reload_time = item_reload_cost( it, *usable_ammo, qty );
     // TODO: Consider printing this info to player too
     const std::string ammo_name = usable_ammo->tname();
@@ -1677,11 +1677,11 @@ void parse_tags( std::string &phrase, const Character &u, const Character &me,
             phrase.replace( fa, l, format_money( tmp->price( true ) ) );
         } else if( tag == "<topic_item_my_total_price>" ) {
             item *tmp = item::spawn_temporary( item_type );
-            tmp->charges = me.charges_of( item_type );
+            tmp->set_charges( me.charges_of( item_type ) );
             phrase.replace( fa, l, format_money( tmp->price( true ) ) );
         } else if( tag == "<topic_item_your_total_price>" ) {
             item *tmp = item::spawn_temporary( item_type );
-            tmp->charges = u.charges_of( item_type );
+            tmp->set_charges( u.charges_of( item_type ) );
             phrase.replace( fa, l, format_money( tmp->price( true ) ) );
         } else if( !tag.empty() ) {
             debugmsg( "Bad tag.  '%s' (%d - %d)", tag.c_str(), fa, fb );
@@ -2392,7 +2392,7 @@ void talk_effect_fun_t::set_bulk_trade_accept( bool is_trade, bool is_npc )
         int seller_has = seller->charges_of( d.cur_item );
         //TODO!: check this, I don't think we should be spawning here, just moving
         detached_ptr<item> tmp = item::spawn( d.cur_item );
-        tmp->charges = seller_has;
+        tmp->set_charges( seller_has );
         if( is_trade ) {
             int price = tmp->price( true ) * ( is_npc ? -1 : 1 ) + d.beta->op_of_u.owed;
             if( d.beta->get_faction() && !d.beta->get_faction()->currency.is_empty() ) {
@@ -3375,14 +3375,14 @@ static consumption_result try_consume( npc &p, item &it, std::string &reason )
             reason = _( "Thanks, I used it." );
         }
 
-        to_eat.charges -= amount_used;
+        to_eat.set_charges( to_eat.charges() - amount_used );
         p.consume_effects( to_eat );
         p.moves -= 250;
     } else {
         debugmsg( "Unknown comestible type of item: %s\n", to_eat.tname() );
     }
 
-    if( to_eat.charges > 0 ) {
+    if( to_eat.charges() > 0 ) {
         return CONSUMED_SOME;
     }
 
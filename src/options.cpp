@@ -8,6 +8,7 @@
 
 #include "calendar.h"
 #include "cached_item_options.h"
+#include "cached_options.h"
 #include "cata_utility.h"
 #include "catacharset.h"
 #include "color.h"
@@ -35,6 +36,7 @@
 #include "string_input_popup.h"
 #include "string_utils.h"
 #include "translations.h"
+#include "typed_options.h"
 #include "ui_manager.h"
 #include "worldfactory.h"
 
@@ -56,6 +58,10 @@
 std::map<std::string, std::string> TILESETS; // All found tilesets: <name, tileset_dir>
 std::map<std::string, std::string> SOUNDPACKS; // All found soundpacks: <name, soundpack_dir>
 
+// Number of string-keyed lookups per option name since the last report_option_lookups(),
+// only counted in debug mode
+static std::unordered_map<std::string, int> option_lookups_this_frame;
+
 struct debug_log_level {
     DL id;
     std::string opt_id;
@@ -878,6 +884,7 @@ int options_manager::cOpt::getMaxLength() const
 //set to next item
 void options_manager::cOpt::setNext()
 {
+    invalidate_typed_options();
     if( sType == "string_select" ) {
         int iNext = getItemPos( sSet ) + 1;
         if( iNext >= static_cast<int>( vItems.size() ) ) {
@@ -921,6 +928,7 @@ void options_manager::cOpt::setNext()
 //set to previous item
 void options_manager::cOpt::setPrev()
 {
+    invalidate_typed_options();
     if( sType == "string_select" ) {
         int iPrev = static_cast<int>( getItemPos( sSet ) ) - 1;
         if( iPrev < 0 ) {
@@ -959,6 +967,7 @@ void options_manager::cOpt::setPrev()
 //set value
 void options_manager::cOpt::setValue( float fSetIn )
 {
+    invalidate_typed_options();
     if( sType != "float" ) {
         debugmsg( "tried to set a float value to a %s option", sType );
         return;
@@ -972,6 +981,7 @@ void options_manager::cOpt::setValue( float fSetIn )
 //set value
 void options_manager::cOpt::setValue( int iSetIn )
 {
+    invalidate_typed_options();
     if( sType != "int" ) {
         debugmsg( "tried to set an int value to a %s option", sType );
         return;
@@ -985,6 +995,7 @@ void options_manager::cOpt::setValue( int iSetIn )
 //set value
 void options_manager::cOpt::setValue( const std::string &sSetIn )
 {
+    invalidate_typed_options();
     if( sType == "string_select" ) {
         if( getItemPos( sSetIn ) != -1 ) {
             sSet = sSetIn;
@@ -2164,6 +2175,27 @@ void options_manager::add_options_debug()
 
     add_empty_line();
 
+    add( "LUA_TURN_BUDGET", debug, translate_marker( "Lua time budget per turn" ),
+         translate_marker( "Microseconds of Lua code a single mod may run per turn before the budget action applies.  0 disables the budget." ),
+         0, 1000000, 0
+       );
+
+    add( "LUA_BUDGET_ACTION", debug, translate_marker( "Lua budget action" ),
+         translate_marker( "What to do with a mod that goes over its Lua time budget.  Warn: write a warning to the Lua console and debug log.  Throttle: also skip its on_every_x hooks until next turn." ),
+    {   { "warn", translate_marker( "Warn" ) },
+        { "throttle", translate_marker( "Throttle" ) }
+    },
+    "warn" );
+
+    add_empty_line();
+
+    add( "MAPGEN_PREFETCH_BUDGET", debug, translate_marker( "Mapgen prefetch budget" ),
+         translate_marker( "Milliseconds per turn spent generating terrain the player is heading toward, before it enters the reality bubble.  0 disables prefetching." ),
+         0, 1000, 0
+       );
+
+    add_empty_line();
+
     add_option_group( debug, Group( "debug_log", to_translation( "Logging" ),
                                     to_translation( "Configure debug.log verbosity." ) ),
     [&]( auto & page_id ) {
@@ -3304,6 +3336,7 @@ std::string options_manager::show( bool ingame, const bool world_options_only,
             if( ingame && world_options_changed ) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            invalidate_typed_options();
         }
     }
 
@@ -3399,6 +3432,7 @@ std::string options_manager::migrateOptionValue( const std::string &name,
 
 void options_manager::cache_to_globals()
 {
+    invalidate_typed_options();
     enum_bitset<DL> levels;
     levels.set( DL::Error );
     for( const debug_log_level &e : debug_log_levels ) {
@@ -3474,6 +3508,9 @@ bool options_manager::has_option( const std::string &name ) const
 
 options_manager::cOpt &options_manager::get_option( const std::string &name )
 {
+    if( debug_mode ) {
+        ++option_lookups_this_frame[name];
+    }
     if( options.count( name ) == 0 ) {
         debugmsg( "requested non-existing option %s", name );
     }
@@ -3507,9 +3544,48 @@ options_manager::options_container options_manager::get_world_defaults() const
 
 void options_manager::set_world_options( options_container *options )
 {
+    invalidate_typed_options();
     if( options == nullptr ) {
         world_options.reset();
     } else {
         world_options = options;
     }
 }
+
+namespace typed_options
+{
+typed_option_values values;
+bool stale = true;
+
+void refresh()
+{
+    stale = false;
+#define CATA_TYPED_OPTION_REFRESH( type, name ) values.name = ::get_option<type>( #name );
+    CATA_TYPED_OPTIONS( CATA_TYPED_OPTION_REFRESH )
+#undef CATA_TYPED_OPTION_REFRESH
+}
+} // namespace typed_options
+
+void report_option_lookups()
+{
+    if( option_lookups_this_frame.empty() ) {
+        return;
+    }
+    if( debug_mode ) {
+        std::vector<std::pair<std::string, int>> lookups( option_lookups_this_frame.begin(),
+                option_lookups_this_frame.end() );
+        std::sort( lookups.begin(), lookups.end(), []( const auto & lhs, const auto & rhs ) {
+            return lhs.second > rhs.second;
+        } );
+        int total = 0;
+        for( const std::pair<std::string, int> &e : lookups ) {
+            total += e.second;
+        }
+        std::string top;
+        for( size_t i = 0; i < std::min<size_t>( lookups.size(), 5 ); ++i ) {
+            top += string_format( " %s:%d", lookups[i].first, lookups[i].second );
+        }
+        DebugLog( DL::Debug, DC::Main ) << "String option lookups this frame: " << total << top;
+    }
+    option_lookups_this_frame.clear();
+}
@@ -370,4 +370,11 @@ inline T get_option( const std::string &name )
     return get_options().get_option( name ).value_as<T>();
 }
 
+/**
+ * In debug mode, logs how many string-keyed option lookups were made since the last call
+ * and resets the counters. Nothing is counted otherwise. Hot lookups should become typed handles,
+ * see typed_options.h. Called once per frame.
+ */
+void report_option_lookups();
+
 #endif // CATA_SRC_OPTIONS_H
@@ -15,6 +15,7 @@
 #include <optional>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <unordered_set>
 #include <vector>
 
@@ -2934,6 +2935,7 @@ void overmap::init_layers()
 {
     for( int k = 0; k < OVERMAP_LAYERS; ++k ) {
         const oter_id tid = get_default_terrain( k - OVERMAP_DEPTH );
+        terrain_unpacked[k] = true;
 
         for( int i = 0; i < OMAPX; ++i ) {
             for( int j = 0; j < OMAPY; ++j ) {
@@ -2953,7 +2955,17 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
         return;
     }
 
-    layer[p.z() + OVERMAP_DEPTH].terrain[p.x()][p.y()] = id;
+    const int z = p.z() + OVERMAP_DEPTH;
+    if( !terrain_unpacked[z] ) {
+        unpack_terrain( z );
+    }
+    oter_id &current = layer[z].terrain[p.x()][p.y()];
+    if( current == id ) {
+        return;
+    }
+    current = id;
+    packed_terrain[z].clear();
+    terrain_generation++;
 }
 
 const oter_id &overmap::ter( const tripoint_om_omt &p ) const
@@ -2963,7 +2975,11 @@ const oter_id &overmap::ter( const tripoint_om_omt &p ) const
         return ot_null;
     }
 
-    return layer[p.z() + OVERMAP_DEPTH].terrain[p.x()][p.y()];
+    const int z = p.z() + OVERMAP_DEPTH;
+    if( !terrain_unpacked[z] ) {
+        unpack_terrain( z );
+    }
+    return layer[z].terrain[p.x()][p.y()];
 }
 
 std::string *overmap::join_used_at( const om_pos_dir &p )
@@ -2984,14 +3000,6 @@ std::optional<mapgen_arguments> *overmap::mapgen_args( const tripoint_om_omt &p
     return &mapgen_arg_storage[it->second];
 }
 
-bool &overmap::seen( const tripoint_om_omt &p )
-{
-    if( !inbounds( p ) ) {
-        nullbool = false;
-        return nullbool;
-    }
-    return layer[p.z() + OVERMAP_DEPTH].visible[p.x()][p.y()];
-}
 
 bool overmap::seen( const tripoint_om_omt &p ) const
 {
@@ -3001,15 +3009,19 @@ bool overmap::seen( const tripoint_om_omt &p ) const
     return layer[p.z() + OVERMAP_DEPTH].visible[p.x()][p.y()];
 }
 
-bool &overmap::explored( const tripoint_om_omt &p )
+void overmap::set_seen( const tripoint_om_omt &p, bool seen )
 {
     if( !inbounds( p ) ) {
-        nullbool = false;
-        return nullbool;
+        return;
+    }
+    bool &value = layer[p.z() + OVERMAP_DEPTH].visible[p.x()][p.y()];
+    if( value != seen ) {
+        value = seen;
+        view_generation++;
     }
-    return layer[p.z() + OVERMAP_DEPTH].explored[p.x()][p.y()];
 }
 
+
 bool overmap::is_explored( const tripoint_om_omt &p ) const
 {
     if( !inbounds( p ) ) {
@@ -3018,15 +3030,19 @@ bool overmap::is_explored( const tripoint_om_omt &p ) const
     return layer[p.z() + OVERMAP_DEPTH].explored[p.x()][p.y()];
 }
 
-bool &overmap::path( const tripoint_om_omt &p )
+void overmap::set_explored( const tripoint_om_omt &p, bool explored )
 {
     if( !inbounds( p ) ) {
-        nullbool = false;
-        return nullbool;
+        return;
+    }
+    bool &value = layer[p.z() + OVERMAP_DEPTH].explored[p.x()][p.y()];
+    if( value != explored ) {
+        value = explored;
+        view_generation++;
     }
-    return layer[p.z() + OVERMAP_DEPTH].path[p.x()][p.y()];
 }
 
+
 bool overmap::is_path( const tripoint_om_omt &p ) const
 {
     if( !inbounds( p ) ) {
@@ -3035,6 +3051,18 @@ bool overmap::is_path( const tripoint_om_omt &p ) const
     return layer[p.z() + OVERMAP_DEPTH].path[p.x()][p.y()];
 }
 
+void overmap::set_path( const tripoint_om_omt &p, bool path )
+{
+    if( !inbounds( p ) ) {
+        return;
+    }
+    bool &value = layer[p.z() + OVERMAP_DEPTH].path[p.x()][p.y()];
+    if( value != path ) {
+        value = path;
+        view_generation++;
+    }
+}
+
 bool overmap::mongroup_check( const mongroup &candidate ) const
 {
     const auto matching_range = zg.equal_range( candidate.pos );
@@ -3188,12 +3216,16 @@ void overmap::add_note( const tripoint_om_omt &p, std::string message )
     } );
 
     if( it == std::end( notes ) ) {
+        if( message.empty() ) {
+            return;
+        }
         notes.emplace_back( om_note{ std::move( message ), p.xy() } );
     } else if( !message.empty() ) {
         it->text = std::move( message );
     } else {
         notes.erase( it );
     }
+    view_generation++;
 }
 
 void overmap::mark_note_dangerous( const tripoint_om_omt &p, int radius, bool is_dangerous )
@@ -3202,6 +3234,7 @@ void overmap::mark_note_dangerous( const tripoint_om_omt &p, int radius, bool is
         if( p.xy() == i.p ) {
             i.dangerous = is_dangerous;
             i.danger_radius = radius;
+            view_generation++;
             return;
         }
     }
@@ -3269,12 +3302,16 @@ void overmap::add_extra( const tripoint_om_omt &p, const string_id<map_extra> &i
     } );
 
     if( it == std::end( extras ) ) {
+        if( id.is_null() ) {
+            return;
+        }
         extras.emplace_back( om_map_extra{ id, p.xy() } );
     } else if( !id.is_null() ) {
         it->id = id;
     } else {
         extras.erase( it );
     }
+    view_generation++;
 }
 
 void overmap::delete_extra( const tripoint_om_omt &p )
@@ -6109,13 +6146,22 @@ void overmap::open( overmap_special_batch &enabled_specials )
 // Note: this may throw io errors from std::ofstream
 void overmap::save() const
 {
-    write_to_file( overmapbuffer::player_filename( loc ), [&]( std::ostream & stream ) {
-        serialize_view( stream );
-    } );
+    if( saved_view_generation != view_generation ) {
+        write_to_file( overmapbuffer::player_filename( loc ), [&]( std::ostream & stream ) {
+            serialize_view( stream );
+        } );
+        saved_view_generation = view_generation;
+    }
 
-    write_to_file( overmapbuffer::terrain_filename( loc ), [&]( std::ostream & stream ) {
-        serialize( stream );
-    } );
+    const std::string data = serialize_data();
+    const std::size_t data_hash = std::hash<std::string>()( data );
+    if( saved_terrain_generation != terrain_generation || saved_data_hash != data_hash ) {
+        write_to_file( overmapbuffer::terrain_filename( loc ), [&]( std::ostream & stream ) {
+            serialize( stream, data );
+        } );
+        saved_terrain_generation = terrain_generation;
+        saved_data_hash = data_hash;
+    }
 }
 
 void overmap::add_mon_group( const mongroup &group )
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <climits>
+#include <cstddef>
 #include <cstdlib>
 #include <functional>
 #include <iosfwd>
@@ -233,12 +234,12 @@ class overmap
         const oter_id &ter( const tripoint_om_omt &p ) const;
         std::string *join_used_at( const om_pos_dir & );
         std::optional<mapgen_arguments> *mapgen_args( const tripoint_om_omt & );
-        bool &seen( const tripoint_om_omt &p );
         bool seen( const tripoint_om_omt &p ) const;
-        bool &explored( const tripoint_om_omt &p );
+        void set_seen( const tripoint_om_omt &p, bool seen );
         bool is_explored( const tripoint_om_omt &p ) const;
-        bool &path( const tripoint_om_omt &p );
+        void set_explored( const tripoint_om_omt &p, bool explored );
         bool is_path( const tripoint_om_omt &p ) const;
+        void set_path( const tripoint_om_omt &p, bool path );
 
         bool has_note( const tripoint_om_omt &p ) const;
         std::optional<int> has_note_with_danger_radius( const tripoint_om_omt &p ) const;
@@ -355,10 +356,14 @@ class overmap
 
         std::vector<shared_ptr_fast<npc>> npcs;
 
-        bool nullbool = false;
         point_abs_om loc;
 
         std::array<map_layer, OVERMAP_LAYERS> layer;
+        // Terrain of the layers as it was loaded or last saved, kept while it matches the layer.
+        // Layers are left packed until they're used, and packed again only after they changed.
+        mutable std::array<std::string, OVERMAP_LAYERS> packed_terrain;
+        // Whether layer[z].terrain holds the terrain, rather than only packed_terrain[z]
+        mutable std::array<bool, OVERMAP_LAYERS> terrain_unpacked = {};
         std::unordered_map<tripoint_abs_omt, scent_trace> scents;
 
         // Records the locations where a given overmap special was placed, which
@@ -378,12 +383,28 @@ class overmap
         std::vector<std::optional<mapgen_arguments>> mapgen_arg_storage;
         std::unordered_map<tripoint_om_omt, int> mapgen_args_index;
 
+        // Changed by everything that modifies what serialize_view writes,
+        // so save() can skip the view file if it didn't change since it was last written
+        int view_generation = 1;
+        mutable int saved_view_generation = 0;
+        // Changed by ter_set, so save() knows whether the layers need writing again
+        int terrain_generation = 1;
+        mutable int saved_terrain_generation = 0;
+        // Hash of the rest of the terrain file as it was last loaded or written. It has NPCs
+        // and hordes, which change without going through the overmap, so it's compared.
+        mutable std::size_t saved_data_hash = 0;
+
         oter_id get_default_terrain( int z ) const;
 
         // Initialize
         void init_layers();
         // open existing overmap, or generate a new one
         void open( overmap_special_batch &enabled_specials );
+        // Unpacks the terrain of a layer before it's first used
+        void unpack_terrain( int z ) const;
+        // Parse the JSON data of an overmap file, all of it in files from before the chunked format
+        void unserialize_json( std::istream &fin, const std::string &file_path );
+        void unserialize_view_json( std::istream &fin, const std::string &file_path );
     public:
 
         /**
@@ -400,6 +421,10 @@ class overmap
         void unserialize_view( std::istream &fin, const std::string &file_path );
         // Save data in an opened overmap file
         void serialize( std::ostream &fout ) const;
+        // Save data in an opened overmap file, with the part from serialize_data() given
+        void serialize( std::ostream &fout, const std::string &data ) const;
+        // Everything in the overmap file except the terrain layers
+        std::string serialize_data() const;
         // Save per-player overmap view data.
         void serialize_view( std::ostream &fout ) const;
     private:
@@ -0,0 +1,126 @@
+#include "overmap_file.h"
+
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+namespace overmap_file
+{
+
+// Doesn't start with '#', so it can't be mistaken for the version line of a JSON save
+static constexpr char magic[] = "CBNOMAP1";
+static constexpr std::size_t magic_size = sizeof( magic ) - 1;
+
+static std::uint32_t read_varint( std::istream &fin )
+{
+    std::uint32_t value = 0;
+    for( int shift = 0; shift < 32; shift += 7 ) {
+        const int c = fin.get();
+        if( c == std::char_traits<char>::eof() ) {
+            throw std::runtime_error( "overmap file is truncated" );
+        }
+        value |= static_cast<std::uint32_t>( c & 0x7f ) << shift;
+        if( ( c & 0x80 ) == 0 ) {
+            return value;
+        }
+    }
+    throw std::runtime_error( "overmap file has an invalid number" );
+}
+
+bool is_chunked( std::istream &fin )
+{
+    const std::istream::pos_type start = fin.tellg();
+    char buffer[magic_size] = {};
+    fin.read( buffer, magic_size );
+    const bool result = fin.gcount() == static_cast<std::streamsize>( magic_size ) &&
+                        std::memcmp( buffer, magic, magic_size ) == 0;
+    fin.clear();
+    fin.seekg( start );
+    return result;
+}
+
+void write( std::ostream &fout, const std::vector<chunk> &chunks )
+{
+    std::string toc;
+    write_varint( toc, chunks.size() );
+    std::uint32_t offset = 0;
+    for( const chunk &c : chunks ) {
+        write_varint( toc, c.name.size() );
+        toc += c.name;
+        write_varint( toc, offset );
+        write_varint( toc, c.data.size() );
+        offset += c.data.size();
+    }
+    fout.write( magic, magic_size );
+    fout << toc;
+    for( const chunk &c : chunks ) {
+        fout << c.data;
+    }
+}
+
+std::vector<chunk> read( std::istream &fin,
+                         const std::function<bool( const std::string & )> &wanted )
+{
+    if( !is_chunked( fin ) ) {
+        throw std::runtime_error( "not an overmap file" );
+    }
+    fin.ignore( magic_size );
+
+    struct entry {
+        std::string name;
+        std::uint32_t offset;
+        std::uint32_t size;
+    };
+    std::vector<entry> toc( read_varint( fin ) );
+    for( entry &e : toc ) {
+        e.name.resize( read_varint( fin ) );
+        fin.read( &e.name[0], e.name.size() );
+        e.offset = read_varint( fin );
+        e.size = read_varint( fin );
+    }
+    const std::istream::pos_type data_start = fin.tellg();
+    if( !fin || data_start == std::istream::pos_type( -1 ) ) {
+        throw std::runtime_error( "overmap file has an invalid table of contents" );
+    }
+
+    std::vector<chunk> result;
+    for( const entry &e : toc ) {
+        if( wanted && !wanted( e.name ) ) {
+            continue;
+        }
+        chunk c{ e.name, std::string( e.size, '\0' ) };
+        fin.seekg( data_start + static_cast<std::streamoff>( e.offset ) );
+        fin.read( &c.data[0], e.size );
+        if( fin.gcount() != static_cast<std::streamsize>( e.size ) ) {
+            throw std::runtime_error( "overmap file is truncated" );
+        }
+        result.push_back( std::move( c ) );
+    }
+    return result;
+}
+
+void write_varint( std::string &out, std::uint32_t value )
+{
+    while( value >= 0x80 ) {
+        out += static_cast<char>( ( value & 0x7f ) | 0x80 );
+        value >>= 7;
+    }
+    out += static_cast<char>( value );
+}
+
+std::uint32_t read_varint( const std::string &in, std::size_t &pos )
+{
+    std::uint32_t value = 0;
+    for( int shift = 0; shift < 32 && pos < in.size(); shift += 7 ) {
+        const unsigned char c = in[pos++];
+        value |= static_cast<std::uint32_t>( c & 0x7f ) << shift;
+        if( ( c & 0x80 ) == 0 ) {
+            return value;
+        }
+    }
+    throw std::runtime_error( "overmap data is truncated" );
+}
+
+} // namespace overmap_file
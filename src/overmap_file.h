@@ -0,0 +1,48 @@
+#pragma once
+#ifndef CATA_SRC_OVERMAP_FILE_H
+#define CATA_SRC_OVERMAP_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * Binary container for the overmap terrain and view files.
+ *
+ * The file starts with a magic string and a table of contents, followed by named chunks
+ * of data. Readers can pick the chunks they want and skip the others without parsing them.
+ * The chunks are written by @ref overmap::serialize and @ref overmap::serialize_view,
+ * overmaps saved as JSON text before are still read and are written in this format when
+ * they are saved again.
+ */
+namespace overmap_file
+{
+
+struct chunk {
+    std::string name;
+    std::string data;
+};
+
+/** Whether @p fin is at the start of a chunked file. Doesn't consume anything. */
+bool is_chunked( std::istream &fin );
+
+void write( std::ostream &fout, const std::vector<chunk> &chunks );
+
+/**
+ * Reads the chunks for which @p wanted returns true, or all of them if it's empty.
+ * Throws std::runtime_error if the file is malformed.
+ */
+std::vector<chunk> read( std::istream &fin,
+                         const std::function<bool( const std::string & )> &wanted = nullptr );
+
+/** Variable length encoding of unsigned integers, 7 bits per byte. */
+void write_varint( std::string &out, std::uint32_t value );
+/** Reads a value written by @ref write_varint at @p pos and advances it, throws if truncated. */
+std::uint32_t read_varint( const std::string &in, std::size_t &pos );
+
+} // namespace overmap_file
+
+#endif // CATA_SRC_OVERMAP_FILE_H
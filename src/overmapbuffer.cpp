@@ -395,7 +395,7 @@ bool overmapbuffer::is_explored( const tripoint_abs_omt &p )
 void overmapbuffer::toggle_explored( const tripoint_abs_omt &p )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
-    om_loc.om->explored( om_loc.local ) = !om_loc.om->explored( om_loc.local );
+    om_loc.om->set_explored( om_loc.local, !om_loc.om->is_explored( om_loc.local ) );
 }
 
 bool overmapbuffer::is_path( const tripoint_abs_omt &p )
@@ -409,7 +409,7 @@ bool overmapbuffer::is_path( const tripoint_abs_omt &p )
 void overmapbuffer::toggle_path( const tripoint_abs_omt &p )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
-    om_loc.om->path( om_loc.local ) = !om_loc.om->path( om_loc.local );
+    om_loc.om->set_path( om_loc.local, !om_loc.om->is_path( om_loc.local ) );
 }
 
 bool overmapbuffer::has_horde( const tripoint_abs_omt &p )
@@ -638,7 +638,7 @@ bool overmapbuffer::seen( const tripoint_abs_omt &p )
 void overmapbuffer::set_seen( const tripoint_abs_omt &p, bool seen )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
-    om_loc.om->seen( om_loc.local ) = seen;
+    om_loc.om->set_seen( om_loc.local, seen );
 }
 
 const oter_id &overmapbuffer::ter( const tripoint_abs_omt &p )
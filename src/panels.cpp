@@ -1,6 +1,8 @@
 #include "panels.h"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
@@ -51,8 +53,10 @@
 #include "string_formatter.h"
 #include "string_id.h"
 #include "tileray.h"
+#include "turn_profiler.h"
 #include "translations.h"
 #include "type_id.h"
+#include "typed_options.h"
 #include "ui_manager.h"
 #include "units.h"
 #include "units_utility.h"
@@ -711,8 +715,8 @@ static std::pair<nc_color, std::string> mana_stat( const player &u )
 static nc_color safe_color()
 {
     nc_color s_color = g->safe_mode ? c_green : c_red;
-    if( g->safe_mode == SAFE_MODE_OFF && get_option<bool>( "AUTOSAFEMODE" ) ) {
-        int s_return = get_option<int>( "AUTOSAFEMODETURNS" );
+    if( g->safe_mode == SAFE_MODE_OFF && get_option( option::AUTOSAFEMODE ) ) {
+        int s_return = get_option( option::AUTOSAFEMODETURNS );
         int iPercent = g->turnssincelastmon * 100 / s_return;
         if( iPercent >= 100 ) {
             s_color = c_green;
@@ -824,7 +828,7 @@ static void draw_limb2( avatar &u, const catacurses::window &w )
 
     // print safe mode
     std::string safe_str;
-    if( g->safe_mode || get_option<bool>( "AUTOSAFEMODE" ) ) {
+    if( g->safe_mode || get_option( option::AUTOSAFEMODE ) ) {
         safe_str = _( "SAFE" );
     }
     mvwprintz( w, point( 22, 2 ), safe_color(), safe_str );
@@ -1601,7 +1605,7 @@ static void draw_health_classic( avatar &u, const catacurses::window &w )
 
     // print safe mode// print safe mode
     std::string safe_str;
-    if( g->safe_mode || get_option<bool>( "AUTOSAFEMODE" ) ) {
+    if( g->safe_mode || get_option( option::AUTOSAFEMODE ) ) {
         safe_str = "SAFE";
     }
     mvwprintz( w, point( 40, 4 ), safe_color(), safe_str );
@@ -1826,6 +1830,30 @@ static void draw_ai_goal( const avatar &u, const catacurses::window &w )
     wnoutrefresh( w );
 }
 
+static void draw_turn_profiler( const avatar &, const catacurses::window &w )
+{
+    werase( w );
+    const cata::turn_profiler &profiler = cata::get_turn_profiler();
+    const int turns = std::max( profiler.recorded_turns(), 1 );
+    const auto to_ms = [turns]( std::chrono::nanoseconds t ) {
+        return std::chrono::duration<double, std::milli>( t ).count() / turns;
+    };
+    const int width = getmaxx( w );
+    // NOLINTNEXTLINE(cata-use-named-point-constants)
+    mvwprintz( w, point( 1, 0 ), c_light_gray, "%d turns, %.2f ms/turn", profiler.recorded_turns(),
+               to_ms( profiler.recorded_time() ) );
+    int y = 1;
+    for( const cata::turn_profiler::zone_usage &zone :
+         profiler.top_zones( static_cast<size_t>( std::max( getmaxy( w ) - 1, 0 ) ) ) ) {
+        const std::string time = string_format( "%.2f ms", to_ms( zone.total ) );
+        const int name_width = std::max( width - 3 - static_cast<int>( time.size() ), 0 );
+        mvwprintz( w, point( 1, y ), c_white, utf8_truncate( zone.name, name_width ) );
+        right_print( w, y, 1, c_light_gray, time );
+        y++;
+    }
+    wnoutrefresh( w );
+}
+
 static void draw_location_classic( const avatar &u, const catacurses::window &w )
 {
     werase( w );
@@ -2011,6 +2039,11 @@ static bool spell_panel()
     return has_manacasting;
 }
 
+static bool profiler_panel()
+{
+    return cata::get_turn_profiler().is_running();
+}
+
 bool default_render()
 {
     return true;
@@ -2045,6 +2078,7 @@ static std::vector<window_panel> initialize_default_classic_panels()
                       default_render, true );
 #endif // TILES
     ret.emplace_back( draw_ai_goal, "AI Needs", 1, 44, false );
+    ret.emplace_back( draw_turn_profiler, "Profiler", 8, 44, true, profiler_panel );
     return ret;
 }
 
@@ -2071,6 +2105,7 @@ static std::vector<window_panel> initialize_default_compact_panels()
                       default_render, true );
 #endif // TILES
     ret.emplace_back( draw_ai_goal, "AI Needs", 1, 32, false );
+    ret.emplace_back( draw_turn_profiler, "Profiler", 8, 32, true, profiler_panel );
 
     return ret;
 }
@@ -2103,6 +2138,7 @@ static std::vector<window_panel> initialize_default_label_narrow_panels()
                       default_render, true );
 #endif // TILES
     ret.emplace_back( draw_ai_goal, "AI Needs", 1, 32, false );
+    ret.emplace_back( draw_turn_profiler, "Profiler", 8, 32, true, profiler_panel );
 
     return ret;
 }
@@ -2136,6 +2172,7 @@ static std::vector<window_panel> initialize_default_label_panels()
                       default_render, true );
 #endif // TILES
     ret.emplace_back( draw_ai_goal, "AI Needs", 1, 44, false );
+    ret.emplace_back( draw_turn_profiler, "Profiler", 8, 44, true, profiler_panel );
 
     return ret;
 }
@@ -2177,7 +2214,7 @@ std::string panel_manager::get_current_layout_id() const
 
 int panel_manager::get_width_right()
 {
-    if( get_option<std::string>( "SIDEBAR_POSITION" ) == "left" ) {
+    if( get_option( option::SIDEBAR_POSITION ) == "left" ) {
         return width_left;
     }
     return width_right;
@@ -2185,7 +2222,7 @@ int panel_manager::get_width_right()
 
 int panel_manager::get_width_left()
 {
-    if( get_option<std::string>( "SIDEBAR_POSITION" ) == "left" ) {
+    if( get_option( option::SIDEBAR_POSITION ) == "left" ) {
         return width_right;
     }
     return width_left;
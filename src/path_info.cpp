@@ -300,6 +300,14 @@ std::string PATH_INFO::lua_doc_output()
 {
     return config_dir_value + "lua_doc.md";
 }
+std::string PATH_INFO::lua_profile_output()
+{
+    return config_dir_value + "lua_profile.folded";
+}
+std::string PATH_INFO::turn_profile_output()
+{
+    return config_dir_value + "turn_profile.json";
+}
 std::string PATH_INFO::gfxdir()
 {
     return gfxdir_value;
@@ -58,6 +58,8 @@ std::string mods_dev_default();
 std::string mods_user_default();
 std::string soundpack_conf();
 std::string lua_doc_output();
+std::string lua_profile_output();
+std::string turn_profile_output();
 
 std::string credits();
 std::string motd();
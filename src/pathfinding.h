@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_PATHFINDING_H
 #define CATA_SRC_PATHFINDING_H
 
+#include <bitset>
+
 #include "game_constants.h"
 
 enum pf_special : int {
@@ -43,6 +45,8 @@ struct pathfinding_cache {
     ~pathfinding_cache() = default;
 
     bool dirty;
+    // Submaps to update when the whole cache isn't dirty, indexed by x * MAPSIZE + y
+    std::bitset<MAPSIZE *MAPSIZE> dirty_submaps;
 
     pf_special special[MAPSIZE_X][MAPSIZE_Y];
 };
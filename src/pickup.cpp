@@ -52,6 +52,7 @@
 #include "string_input_popup.h"
 #include "translations.h"
 #include "type_id.h"
+#include "typed_options.h"
 #include "ui.h"
 #include "ui_manager.h"
 #include "units.h"
@@ -275,7 +276,7 @@ static bool pick_one_up( pickup::pick_drop_selection &selection, bool &got_water
         // Ammo can sometimes be picked up into containers
         newloc = u.i_add_to_container( std::move( newloc ), false );
 
-        if( !newloc || ( newloc->count_by_charges() && newloc->charges == 0 ) ) {
+        if( !newloc || ( newloc->count_by_charges() && newloc->charges() == 0 ) ) {
             // We've picked up everything into containers, skip the options part
             picked_up = true;
             option = NUM_ANSWERS;
@@ -730,7 +731,7 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
             } else if( position == "right" ) {
                 pickupX = TERMX - panel_manager::get_manager().get_width_right() - pickupW;
             } else if( position == "overlapping" ) {
-                if( get_option<std::string>( "SIDEBAR_POSITION" ) == "right" ) {
+                if( get_option( option::SIDEBAR_POSITION ) == "right" ) {
                     pickupX = TERMX - pickupW;
                 }
             }
@@ -858,7 +859,7 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
                         // TODO: transition to the item_location system used for the inventory
                         unsigned int charges_total = 0;
                         for( const item_stack::iterator &it : stacked_here[true_it] ) {
-                            charges_total += ( *it )->charges;
+                            charges_total += ( *it )->charges();
                         }
                         //Picking up none or all the cards in a stack
                         if( !getitem[true_it].pick || !getitem[true_it].count ) {
@@ -870,7 +871,7 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
                             int c = item_count;
                             for( std::list<item_stack::iterator>::const_iterator it = stacked_here[true_it].begin();
                                  it != stacked_here[true_it].end() && c > 0; ++it, --c ) {
-                                charges += ( **it )->charges;
+                                charges += ( **it )->charges();
                             }
 
                             item_name = ( *stacked_here[true_it].front() )->display_money( item_count, charges_total, charges );
@@ -1047,7 +1048,7 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
                 pickup_count &selected_stack = getitem[true_idx];
                 if( itemcount || selected_stack.count ) {
                     const item &temp = **stacked_here[true_idx].front();
-                    int amount_available = temp.count_by_charges() ? temp.charges : stacked_here[true_idx].size();
+                    int amount_available = temp.count_by_charges() ? temp.charges() : stacked_here[true_idx].size();
                     if( itemcount && *itemcount >= amount_available ) {
                         itemcount.reset();
                     }
@@ -1130,8 +1131,8 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
                     if( getitem[i].pick ) {
                         // Make a copy for calculating weight/volume
                         item &temp = *item::spawn_temporary( **stacked_here[i].front() );
-                        if( temp.count_by_charges() && getitem[i].count && *getitem[i].count < temp.charges ) {
-                            temp.charges = *getitem[i].count;
+                        if( temp.count_by_charges() && getitem[i].count && *getitem[i].count < temp.charges() ) {
+                            temp.set_charges( *getitem[i].count );
                         }
                         int num_picked = std::min( stacked_here[i].size(),
                                                    getitem[i].count ? *getitem[i].count : stacked_here[i].size() );
@@ -1182,7 +1183,7 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
             }
 
             if( ( *it )->count_by_charges() ) {
-                int num_picked = std::min( ( *it )->charges, count );
+                int num_picked = std::min( ( *it )->charges(), count );
                 pick_values.emplace_back( it, num_picked );
                 count -= num_picked;
             } else {
@@ -1232,10 +1233,10 @@ detached_ptr<item> pickup::handle_spillable_contents( Character &c, detached_ptr
 {
     if( it->is_bucket_nonempty() ) {
         const item &it_cont = it->contents.front();
-        int num_charges = it_cont.charges;
+        int num_charges = it_cont.charges();
         while( !it->spill_contents( c ) ) {
-            if( num_charges > it_cont.charges ) {
-                num_charges = it_cont.charges;
+            if( num_charges > it_cont.charges() ) {
+                num_charges = it_cont.charges();
             } else {
                 break;
             }
@@ -151,13 +151,13 @@ detached_ptr<item> player::reduce_charges( int position, int quantity )
         debugmsg( "invalid item position %d for reduce_charges", position );
         return detached_ptr<item>();
     }
-    if( it.charges <= quantity ) {
+    if( it.charges() <= quantity ) {
         return i_rem( position );
     }
     it.mod_charges( -quantity );
 
     auto taken = item::spawn( it );
-    taken->charges = quantity;
+    taken->set_charges( quantity );
     return taken;
 }
 
@@ -167,13 +167,13 @@ detached_ptr<item> player::reduce_charges( item *it, int quantity )
         debugmsg( "invalid item (name %s) for reduce_charges", it->tname() );
         return detached_ptr<item>();
     }
-    if( it->charges <= quantity ) {
+    if( it->charges() <= quantity ) {
         return it->detach();
     }
     it->mod_charges( -quantity );
 
     auto taken = item::spawn( *it );
-    taken->charges = quantity;
+    taken->set_charges( quantity );
     return taken;
 }
 
@@ -689,13 +689,13 @@ std::vector<detached_ptr<item>> json_item_substitution::get_substitution( const
             }
         } else {
             detached_ptr<item> result = item::spawn( inf.new_item, advanced_spawn_time() );
-            result->mod_charges( -result->charges + new_amt );
-            while( result->charges > 0 ) {
+            result->mod_charges( -result->charges() + new_amt );
+            while( result->charges() > 0 ) {
                 item &pushed = *result;
                 ret.push_back( item::in_its_container( std::move( result ) ) );
                 result = item::spawn( pushed );
-                result->mod_charges( pushed.contents.empty() ? -pushed.charges :
-                                     -pushed.contents.back().charges );
+                result->mod_charges( pushed.contents.empty() ? -pushed.charges() :
+                                     -pushed.contents.back().charges() );
             }
         }
     }
@@ -4,10 +4,18 @@
 
 #if defined(USE_TRACY)
 #   include "tracy/Tracy.hpp"
+#   include "turn_profiler.h"
+
+// Named zones are recorded by the built-in cata::turn_profiler too, for the turn benchmark
+#   undef ZoneScopedN
+#   define ZoneScopedN(x) ZoneNamedN( ___tracy_scoped_zone, x, true ); \
+        cata::profile_zone cata_profile_zone( x )
 #else
+#   include "turn_profiler.h"
 
 // copy-pasted from tracy/Tracy.hpp
 // TODO: remove when all dependencies are managed via cmake
+// Scoped zones are recorded by the built-in cata::turn_profiler instead
 #define TracyNoop
 
 #define ZoneNamed(x,y)
@@ -18,10 +26,10 @@
 #define ZoneTransient(x,y)
 #define ZoneTransientN(x,y,z)
 
-#define ZoneScoped
-#define ZoneScopedN(x)
-#define ZoneScopedC(x)
-#define ZoneScopedNC(x,y)
+#define ZoneScoped cata::profile_zone cata_profile_zone( __func__ )
+#define ZoneScopedN(x) cata::profile_zone cata_profile_zone( x )
+#define ZoneScopedC(x) cata::profile_zone cata_profile_zone( __func__ )
+#define ZoneScopedNC(x,y) cata::profile_zone cata_profile_zone( x )
 
 #define ZoneText(x,y)
 #define ZoneTextV(x,y,z)
@@ -81,10 +89,10 @@
 #define ZoneTransientS(x,y,z)
 #define ZoneTransientNS(x,y,z,w)
 
-#define ZoneScopedS(x)
-#define ZoneScopedNS(x,y)
-#define ZoneScopedCS(x,y)
-#define ZoneScopedNCS(x,y,z)
+#define ZoneScopedS(x) cata::profile_zone cata_profile_zone( __func__ )
+#define ZoneScopedNS(x,y) cata::profile_zone cata_profile_zone( x )
+#define ZoneScopedCS(x,y) cata::profile_zone cata_profile_zone( __func__ )
+#define ZoneScopedNCS(x,y,z) cata::profile_zone cata_profile_zone( x )
 
 #define TracyAllocS(x,y,z)
 #define TracyFreeS(x,y)
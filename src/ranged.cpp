@@ -1104,9 +1104,9 @@ int throwing_dispersion( const Character &c, const item &to_throw, Creature *cri
 {
     units::mass weight = to_throw.weight();
     units::volume volume = to_throw.volume();
-    if( to_throw.count_by_charges() && to_throw.charges > 1 ) {
-        weight /= to_throw.charges;
-        volume /= to_throw.charges;
+    if( to_throw.count_by_charges() && to_throw.charges() > 1 ) {
+        weight /= to_throw.charges();
+        volume /= to_throw.charges();
     }
 
     int throw_difficulty = 1000;
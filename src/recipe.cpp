@@ -459,20 +459,20 @@ detached_ptr<item> recipe::create_result() const
 {
     detached_ptr<item> newit = item::spawn( result_, calendar::turn, item::default_charges_tag{} );
     if( charges ) {
-        newit->charges = *charges;
+        newit->set_charges( *charges );
     }
 
     if( !newit->craft_has_charges() ) {
-        newit->charges = 0;
+        newit->set_charges( 0 );
     } else if( result_mult != 1 ) {
         // TODO: Make it work for charge-less items (update makes amount)
-        newit->charges *= result_mult;
+        newit->set_charges( newit->charges() * result_mult );
     }
 
     // Show crafted items as fitting
     // They might end up not fitting, but it's rare
     if( newit->has_flag( flag_VARSIZE ) ) {
-        newit->item_tags.insert( flag_FIT );
+        newit->set_flag( flag_FIT );
     }
 
     if( contained ) {
@@ -495,7 +495,7 @@ std::vector<detached_ptr<item>> recipe::create_results( int batch ) const
         }
     } else {
         detached_ptr<item> newit = create_result();
-        newit->charges *= batch;
+        newit->set_charges( newit->charges() * batch );
         items.push_back( std::move( newit ) );
     }
 
@@ -512,12 +512,12 @@ std::vector<detached_ptr<item>> recipe::create_byproducts( int batch ) const
         }
 
         if( obj->count_by_charges() ) {
-            obj->charges *= e.second * batch;
+            obj->set_charges( obj->charges() * ( e.second * batch ) );
             bps.push_back( std::move( obj ) );
 
         } else {
             if( !obj->craft_has_charges() ) {
-                obj->charges = 0;
+                obj->set_charges( 0 );
             }
             for( int i = 0; i < e.second * batch; ++i ) {
                 bps.push_back( item::spawn( *obj ) );
@@ -973,10 +973,23 @@ void region_terrain_and_furniture_settings::finalize()
             furniture[template_fid.id()].add( fid.id(), actual_pr.second );
         }
     }
+
+    regional_terrain.assign( ter_t::count(), false );
+    for( const auto &pr : terrain ) {
+        regional_terrain[pr.first.to_i()] = true;
+    }
+    regional_furniture.assign( furn_t::count(), false );
+    for( const auto &pr : furniture ) {
+        regional_furniture[pr.first.to_i()] = true;
+    }
 }
 
 ter_id region_terrain_and_furniture_settings::resolve( const ter_id &tid ) const
 {
+    if( static_cast<size_t>( tid.to_i() ) >= regional_terrain.size() ||
+        !regional_terrain[tid.to_i()] ) {
+        return tid;
+    }
     ter_id result = tid;
     auto region_list = terrain.find( result );
     while( region_list != terrain.end() ) {
@@ -988,6 +1001,10 @@ ter_id region_terrain_and_furniture_settings::resolve( const ter_id &tid ) const
 
 furn_id region_terrain_and_furniture_settings::resolve( const furn_id &fid ) const
 {
+    if( static_cast<size_t>( fid.to_i() ) >= regional_furniture.size() ||
+        !regional_furniture[fid.to_i()] ) {
+        return fid;
+    }
     furn_id result = fid;
     auto region_list = furniture.find( result );
     while( region_list != furniture.end() ) {
@@ -206,6 +206,10 @@ struct region_terrain_and_furniture_settings {
     std::map<std::string, std::map<std::string, int>> unfinalized_furniture;
     std::map<ter_id, weighted_int_list<ter_id>> terrain;
     std::map<furn_id, weighted_int_list<furn_id>> furniture;
+    // Indexed by id, whether it's a key of terrain/furniture. Most tiles of a map
+    // aren't, resolving those shouldn't need a map lookup.
+    std::vector<bool> regional_terrain;
+    std::vector<bool> regional_furniture;
 
     void finalize();
     ter_id resolve( const ter_id & ) const;
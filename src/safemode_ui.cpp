@@ -28,6 +28,7 @@
 #include "string_input_popup.h"
 #include "string_utils.h"
 #include "translations.h"
+#include "typed_options.h"
 #include "ui_manager.h"
 
 safemode &get_safemode()
@@ -181,8 +182,8 @@ void safemode::show( const std::string &custom_name_in, bool is_safemode_in )
         locx = 55;
         mvwprintz( w_header, point( locx, 0 ), c_white, _( "Safe Mode enabled:" ) );
         locx += shortcut_print( w_header, point( locx, 1 ),
-                                ( ( get_option<bool>( "SAFEMODE" ) ) ? c_light_green : c_light_red ), c_white,
-                                ( ( get_option<bool>( "SAFEMODE" ) ) ? _( "True" ) : _( "False" ) ) );
+                                ( ( get_option( option::SAFEMODE ) ) ? c_light_green : c_light_red ), c_white,
+                                ( ( get_option( option::SAFEMODE ) ) ? _( "True" ) : _( "False" ) ) );
         locx += shortcut_print( w_header, point( locx, 1 ), c_white, c_light_green, "  " );
         locx += shortcut_print( w_header, point( locx, 1 ), c_white, c_light_green, _( "<S>witch" ) );
         shortcut_print( w_header, point( locx, 1 ), c_white, c_light_green, "  " );
@@ -285,14 +286,14 @@ void safemode::show( const std::string &custom_name_in, bool is_safemode_in )
         } else if( action == "ADD_DEFAULT_RULESET" ) {
             changes_made = true;
             current_tab.emplace_back( "*", true, false, Attitude::A_HOSTILE,
-                                      get_option<int>( "SAFEMODEPROXIMITY" )
+                                      get_option( option::SAFEMODEPROXIMITY )
                                       , HOSTILE_SPOTTED );
             current_tab.emplace_back( "*", true, true, Attitude::A_HOSTILE, 5, SOUND );
             line = current_tab.size() - 1;
         } else if( action == "ADD_RULE" ) {
             changes_made = true;
             current_tab.emplace_back( "", true, false, Attitude::A_HOSTILE,
-                                      get_option<int>( "SAFEMODEPROXIMITY" ), HOSTILE_SPOTTED );
+                                      get_option( option::SAFEMODEPROXIMITY ), HOSTILE_SPOTTED );
             line = current_tab.size() - 1;
         } else if( action == "REMOVE_RULE" && !current_tab.empty() ) {
             changes_made = true;
@@ -411,13 +412,13 @@ void safemode::show( const std::string &custom_name_in, bool is_safemode_in )
                                   .title( _( "Proximity Distance (0=max view distance)" ) )
                                   .width( 4 )
                                   .text( std::to_string( current_tab[line].proximity ) )
-                                  .description( _( "Option: " ) + std::to_string( get_option<int>( "SAFEMODEPROXIMITY" ) ) +
+                                  .description( _( "Option: " ) + std::to_string( get_option( option::SAFEMODEPROXIMITY ) ) +
                                                 " " + get_options().get_option( "SAFEMODEPROXIMITY" ).getDefaultText() )
                                   .max_length( 3 )
                                   .only_digits( true )
                                   .query_string();
                 if( text.empty() ) {
-                    current_tab[line].proximity = get_option<int>( "SAFEMODEPROXIMITY" );
+                    current_tab[line].proximity = get_option( option::SAFEMODEPROXIMITY );
                 } else {
                     //Let the options class handle the validity of the new value
                     auto temp_option = get_options().get_option( "SAFEMODEPROXIMITY" );
@@ -606,7 +607,7 @@ void safemode::add_rule( const std::string &rule_in, const Attitude attitude_in,
                                   attitude_in, proximity_in, HOSTILE_SPOTTED );
     create_rules();
 
-    if( !get_option<bool>( "SAFEMODE" ) &&
+    if( !get_option( option::SAFEMODE ) &&
         query_yn( _( "Safe Mode is not enabled in the options.  Enable it now?" ) ) ) {
         get_options().get_option( "SAFEMODE" ).setNext();
         get_options().save();
@@ -1,8 +1,10 @@
 #include "game.h" // IWYU pragma: associated
 
 #include <algorithm>
+#include <cstdint>
 #include <map>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -33,13 +35,16 @@
 #include "options.h"
 #include "output.h"
 #include "overmap.h"
+#include "overmap_file.h"
 #include "overmap_types.h"
 #include "popup.h"
 #include "regional_settings.h"
 #include "scent_map.h"
 #include "stats_tracker.h"
+#include "string_formatter.h"
 #include "string_id.h"
 #include "translations.h"
+#include "typed_options.h"
 #include "ui_manager.h"
 #include "weather.h"
 
@@ -216,7 +221,7 @@ void game::unserialize( std::istream &fin )
         );
 
         safe_mode = static_cast<safe_mode_type>( tmprun );
-        if( get_option<bool>( "SAFEMODE" ) && safe_mode == SAFE_MODE_OFF ) {
+        if( get_option( option::SAFEMODE ) && safe_mode == SAFE_MODE_OFF ) {
             safe_mode = SAFE_MODE_ON;
         }
 
@@ -376,8 +381,213 @@ void overmap::load_legacy_monstergroups( JsonIn &jsin )
     }
 }
 
+// throws std::exception
+static std::string layer_chunk_name( const char *kind, int z )
+{
+    return string_format( "%s.%d", kind, z - OVERMAP_DEPTH );
+}
+
+static std::string *find_chunk( std::vector<overmap_file::chunk> &chunks, const std::string &name )
+{
+    for( overmap_file::chunk &c : chunks ) {
+        if( c.name == name ) {
+            return &c.data;
+        }
+    }
+    return nullptr;
+}
+
+// Packed terrain is a palette of the ids in the layer, followed by runs of palette
+// indices in the same order as the JSON format.
+static std::string pack_terrain( const oter_id( &terrain )[OMAPX][OMAPY] )
+{
+    std::vector<oter_id> palette;
+    std::unordered_map<int, std::uint32_t> palette_index;
+    std::string runs;
+    std::uint32_t last = 0;
+    std::uint32_t count = 0;
+    for( int j = 0; j < OMAPY; j++ ) {
+        // NOLINTNEXTLINE(modernize-loop-convert)
+        for( int i = 0; i < OMAPX; i++ ) {
+            const oter_id t = terrain[i][j];
+            const auto iter = palette_index.emplace( t.to_i(), palette.size() ).first;
+            if( iter->second == palette.size() ) {
+                palette.push_back( t );
+            }
+            if( count > 0 && iter->second == last ) {
+                count++;
+                continue;
+            }
+            if( count > 0 ) {
+                overmap_file::write_varint( runs, last );
+                overmap_file::write_varint( runs, count );
+            }
+            last = iter->second;
+            count = 1;
+        }
+    }
+    overmap_file::write_varint( runs, last );
+    overmap_file::write_varint( runs, count );
+
+    std::string result;
+    overmap_file::write_varint( result, palette.size() );
+    for( const oter_id &t : palette ) {
+        const std::string &name = t.id().str();
+        overmap_file::write_varint( result, name.size() );
+        result += name;
+    }
+    return result + runs;
+}
+
+static std::vector<std::string> read_terrain_palette( const std::string &data, std::size_t &pos )
+{
+    std::vector<std::string> palette( overmap_file::read_varint( data, pos ) );
+    for( std::string &name : palette ) {
+        const std::uint32_t size = overmap_file::read_varint( data, pos );
+        if( size > data.size() - pos ) {
+            throw std::runtime_error( "overmap terrain is truncated" );
+        }
+        name = data.substr( pos, size );
+        pos += size;
+    }
+    return palette;
+}
+
+// Whether the packed terrain has ids that must be migrated or reported when it's loaded
+static bool terrain_needs_migration( const std::string &data )
+{
+    std::size_t pos = 0;
+    for( const std::string &name : read_terrain_palette( data, pos ) ) {
+        if( overmap::is_oter_id_obsolete( name ) || !oter_str_id( name ).is_valid() ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void unpack_terrain_data( const std::string &data, oter_id( &terrain )[OMAPX][OMAPY],
+                                 int z, std::unordered_map<tripoint_om_omt, std::string> &migrations )
+{
+    std::size_t pos = 0;
+    const std::vector<std::string> names = read_terrain_palette( data, pos );
+    std::vector<oter_id> palette;
+    std::vector<bool> obsolete;
+    palette.reserve( names.size() );
+    for( const std::string &name : names ) {
+        obsolete.push_back( overmap::is_oter_id_obsolete( name ) );
+        if( obsolete.back() ) {
+            palette.push_back( oter_omt_obsolete );
+        } else if( oter_str_id( name ).is_valid() ) {
+            palette.emplace_back( name );
+        } else {
+            debugmsg( "Loaded invalid oter_id '%s'", name );
+            palette.push_back( oter_omt_obsolete );
+        }
+    }
+
+    constexpr int cells = OMAPX * OMAPY;
+    int cell = 0;
+    while( cell < cells ) {
+        const std::uint32_t index = overmap_file::read_varint( data, pos );
+        const std::uint32_t count = overmap_file::read_varint( data, pos );
+        if( index >= palette.size() || count == 0 ||
+            count > static_cast<std::uint32_t>( cells - cell ) ) {
+            throw std::runtime_error( "overmap terrain is corrupted" );
+        }
+        for( const int end = cell + count; cell < end; cell++ ) {
+            const point p( cell % OMAPX, cell / OMAPX );
+            terrain[p.x][p.y] = palette[index];
+            if( obsolete[index] ) {
+                migrations.emplace( tripoint_om_omt( p.x, p.y, z - OVERMAP_DEPTH ), names[index] );
+            }
+        }
+    }
+}
+
+// Bit per tile, in the same order as the terrain. Empty if none are set.
+static std::string pack_bits( const bool ( &array )[OMAPX][OMAPY] )
+{
+    std::string result( ( OMAPX * OMAPY + 7 ) / 8, '\0' );
+    bool any = false;
+    for( int j = 0; j < OMAPY; j++ ) {
+        for( int i = 0; i < OMAPX; i++ ) {
+            if( array[i][j] ) {
+                const int cell = j * OMAPX + i;
+                result[cell / 8] = static_cast<char>( result[cell / 8] | ( 1 << ( cell % 8 ) ) );
+                any = true;
+            }
+        }
+    }
+    return any ? result : std::string();
+}
+
+static void unpack_bits( const std::string *data, bool ( &array )[OMAPX][OMAPY] )
+{
+    if( data != nullptr && data->size() != ( OMAPX * OMAPY + 7 ) / 8 ) {
+        throw std::runtime_error( "overmap view is corrupted" );
+    }
+    for( int j = 0; j < OMAPY; j++ ) {
+        for( int i = 0; i < OMAPX; i++ ) {
+            const int cell = j * OMAPX + i;
+            array[i][j] = data != nullptr && ( ( *data )[cell / 8] >> ( cell % 8 ) & 1 ) != 0;
+        }
+    }
+}
+
 // throws std::exception
 void overmap::unserialize( std::istream &fin, const std::string &file_path )
+{
+    if( !overmap_file::is_chunked( fin ) ) {
+        // Saved before the chunked format, it's converted when the overmap is saved again
+        unserialize_json( fin, file_path );
+        return;
+    }
+    std::vector<overmap_file::chunk> chunks = overmap_file::read( fin );
+    std::unordered_map<tripoint_om_omt, std::string> oter_id_migrations;
+    bool migrated = false;
+    for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
+        std::string *data = find_chunk( chunks, layer_chunk_name( "terrain", z ) );
+        if( data == nullptr ) {
+            migrated = true;
+            continue;
+        }
+        if( terrain_needs_migration( *data ) ) {
+            unpack_terrain_data( *data, layer[z].terrain, z, oter_id_migrations );
+            migrated = true;
+        } else {
+            packed_terrain[z] = std::move( *data );
+            terrain_unpacked[z] = false;
+        }
+    }
+    migrate_oter_ids( oter_id_migrations );
+    // Layers that were migrated are written in the current format on the next save
+    if( !migrated ) {
+        saved_terrain_generation = terrain_generation;
+    }
+
+    if( std::string *data = find_chunk( chunks, "data" ) ) {
+        saved_data_hash = std::hash<std::string>()( *data );
+        std::istringstream data_in( *data );
+        unserialize_json( data_in, file_path );
+    }
+}
+
+void overmap::unpack_terrain( int z ) const
+{
+    terrain_unpacked[z] = true;
+    // Layers that need migrations were unpacked on load
+    std::unordered_map<tripoint_om_omt, std::string> migrations;
+    // Unpacking doesn't change the terrain, only how it's stored
+    map_layer &unpacked = const_cast<map_layer &>( layer[z] );
+    try {
+        unpack_terrain_data( packed_terrain[z], unpacked.terrain, z, migrations );
+    } catch( const std::exception &err ) {
+        debugmsg( "overmap %s failed to load layer %d: %s", loc.to_string(), z - OVERMAP_DEPTH,
+                  err.what() );
+    }
+}
+
+void overmap::unserialize_json( std::istream &fin, const std::string &file_path )
 {
     chkversion( fin );
     JsonIn jsin( fin, file_path );
@@ -634,6 +844,27 @@ static void unserialize_array_from_compacted_sequence( JsonIn &jsin, bool ( &arr
 
 // throws std::exception
 void overmap::unserialize_view( std::istream &fin, const std::string &file_path )
+{
+    if( !overmap_file::is_chunked( fin ) ) {
+        unserialize_view_json( fin, file_path );
+        return;
+    }
+    std::vector<overmap_file::chunk> chunks = overmap_file::read( fin );
+    for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
+        unpack_bits( find_chunk( chunks, layer_chunk_name( "visible", z ) ), layer[z].visible );
+        unpack_bits( find_chunk( chunks, layer_chunk_name( "explored", z ) ), layer[z].explored );
+        unpack_bits( find_chunk( chunks, layer_chunk_name( "path", z ) ), layer[z].path );
+    }
+    if( std::string *data = find_chunk( chunks, "view" ) ) {
+        std::istringstream data_in( *data );
+        unserialize_view_json( data_in, file_path );
+    }
+    // The file has what save() would write, older formats are written again
+    saved_view_generation = view_generation;
+}
+
+// throws std::exception
+void overmap::unserialize_view_json( std::istream &fin, const std::string &file_path )
 {
     chkversion( fin );
     JsonIn jsin( fin, file_path );
@@ -702,68 +933,27 @@ void overmap::unserialize_view( std::istream &fin, const std::string &file_path
     }
 }
 
-static void serialize_array_to_compacted_sequence( JsonOut &json,
-        const bool ( &array )[OMAPX][OMAPY] )
-{
-    int count = 0;
-    int lastval = -1;
-    for( int j = 0; j < OMAPY; j++ ) {
-        for( const auto &array_col : array ) {
-            const int value = array_col[j];
-            if( value != lastval ) {
-                if( count ) {
-                    json.write( count );
-                    json.end_array();
-                }
-                lastval = value;
-                json.start_array();
-                json.write( static_cast<bool>( value ) );
-                count = 1;
-            } else {
-                count++;
-            }
-        }
-    }
-    json.write( count );
-    json.end_array();
-}
-
 void overmap::serialize_view( std::ostream &fout ) const
 {
-    fout << "# version " << savegame_version << '\n';
-
-    JsonOut json( fout, false );
-    json.start_object();
-
-    json.member( "visible" );
-    json.start_array();
+    std::vector<overmap_file::chunk> chunks;
+    // Layers nobody has seen are left out
+    const auto add_bits = [&]( const char *kind, int z, const bool ( &array )[OMAPX][OMAPY] ) {
+        std::string bits = pack_bits( array );
+        if( !bits.empty() ) {
+            chunks.push_back( { layer_chunk_name( kind, z ), std::move( bits ) } );
+        }
+    };
     for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-        json.start_array();
-        serialize_array_to_compacted_sequence( json, layer[z].visible );
-        json.end_array();
-        fout << '\n';
+        add_bits( "visible", z, layer[z].visible );
+        add_bits( "explored", z, layer[z].explored );
+        add_bits( "path", z, layer[z].path );
     }
-    json.end_array();
 
-    json.member( "explored" );
-    json.start_array();
-    for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-        json.start_array();
-        serialize_array_to_compacted_sequence( json, layer[z].explored );
-        json.end_array();
-        fout << '\n';
-    }
-    json.end_array();
+    std::ostringstream data;
+    data << "# version " << savegame_version << '\n';
 
-    json.member( "path" );
-    json.start_array();
-    for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-        json.start_array();
-        serialize_array_to_compacted_sequence( json, layer[z].path );
-        json.end_array();
-        fout << '\n';
-    }
-    json.end_array();
+    JsonOut json( data, false );
+    json.start_object();
 
     json.member( "notes" );
     json.start_array();
@@ -777,7 +967,7 @@ void overmap::serialize_view( std::ostream &fout ) const
             json.write( i.dangerous );
             json.write( i.danger_radius );
             json.end_array();
-            fout << '\n';
+            data << '\n';
         }
         json.end_array();
     }
@@ -793,13 +983,16 @@ void overmap::serialize_view( std::ostream &fout ) const
             json.write( i.p.y() );
             json.write( i.id );
             json.end_array();
-            fout << '\n';
+            data << '\n';
         }
         json.end_array();
     }
     json.end_array();
 
     json.end_object();
+    chunks.push_back( { "view", data.str() } );
+
+    overmap_file::write( fout, chunks );
 }
 
 // Compares all fields except position and monsters
@@ -867,52 +1060,38 @@ void overmap::save_monster_groups( JsonOut &jout ) const
 
 void overmap::serialize( std::ostream &fout ) const
 {
-    fout << "# version " << savegame_version << '\n';
-
-    JsonOut json( fout, false );
-    json.start_object();
+    serialize( fout, serialize_data() );
+}
 
-    json.member( "layers" );
-    json.start_array();
+void overmap::serialize( std::ostream &fout, const std::string &data ) const
+{
+    std::vector<overmap_file::chunk> chunks;
     for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-        auto &layer_terrain = layer[z].terrain;
-        int count = 0;
-        oter_id last_tertype( -1 );
-        json.start_array();
-        for( int j = 0; j < OMAPY; j++ ) {
-            // NOLINTNEXTLINE(modernize-loop-convert)
-            for( int i = 0; i < OMAPX; i++ ) {
-                oter_id t = layer_terrain[i][j];
-                if( t != last_tertype ) {
-                    if( count ) {
-                        json.write( count );
-                        json.end_array();
-                    }
-                    last_tertype = t;
-                    json.start_array();
-                    json.write( t.id() );
-                    count = 1;
-                } else {
-                    count++;
-                }
-            }
+        // Layers that didn't change are written as they were loaded or last saved
+        if( packed_terrain[z].empty() ) {
+            packed_terrain[z] = pack_terrain( layer[z].terrain );
         }
-        json.write( count );
-        // End the last entry for a z-level.
-        json.end_array();
-        // End the z-level
-        json.end_array();
-        // Insert a newline occasionally so the file isn't totally unreadable.
-        fout << '\n';
+        chunks.push_back( { layer_chunk_name( "terrain", z ), packed_terrain[z] } );
     }
-    json.end_array();
+    chunks.push_back( { "data", data } );
+
+    overmap_file::write( fout, chunks );
+}
+
+std::string overmap::serialize_data() const
+{
+    std::ostringstream data;
+    data << "# version " << savegame_version << '\n';
+
+    JsonOut json( data, false );
+    json.start_object();
 
     // temporary, to allow user to manually switch regions during play until regionmap is done.
     json.member( "region_id", settings->id );
-    fout << '\n';
+    data << '\n';
 
     save_monster_groups( json );
-    fout << '\n';
+    data << '\n';
 
     json.member( "cities" );
     json.start_array();
@@ -925,10 +1104,10 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << '\n';
+    data << '\n';
 
     json.member( "connections_out", connections_out );
-    fout << '\n';
+    data << '\n';
 
     json.member( "radios" );
     json.start_array();
@@ -943,7 +1122,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << '\n';
+    data << '\n';
 
     json.member( "monster_map" );
     json.start_array();
@@ -952,7 +1131,7 @@ void overmap::serialize( std::ostream &fout ) const
         i.second.serialize( json );
     }
     json.end_array();
-    fout << '\n';
+    data << '\n';
 
     json.member( "tracked_vehicles" );
     json.start_array();
@@ -965,7 +1144,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << '\n';
+    data << '\n';
 
     json.member( "scent_traces" );
     json.start_array();
@@ -977,7 +1156,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << '\n';
+    data << '\n';
 
     json.member( "npcs" );
     json.start_array();
@@ -985,7 +1164,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.write( *i );
     }
     json.end_array();
-    fout << '\n';
+    data << '\n';
 
     // Condense the overmap special placements so that all placements of a given special
     // are grouped under a single key for that special.
@@ -1018,7 +1197,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << '\n';
+    data << '\n';
 
     json.member( "electric_grid_connections" );
     json.start_array();
@@ -1039,7 +1218,7 @@ void overmap::serialize( std::ostream &fout ) const
                 joins_used.begin(), joins_used.end() );
     json.member( "joins_used", flattened_joins_used );
     json.member( "mapgen_arg_storage", mapgen_arg_storage );
-    fout << '\n';
+    data << '\n';
     json.member( "mapgen_arg_index" );
     json.start_array();
     for( const std::pair<const tripoint_om_omt, int> &p : mapgen_args_index ) {
@@ -1049,10 +1228,11 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_array();
     }
     json.end_array();
-    fout << '\n';
+    data << '\n';
 
     json.end_object();
-    fout << '\n';
+    data << '\n';
+    return data.str();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
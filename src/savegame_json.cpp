@@ -187,6 +187,7 @@ void item_contents::deserialize( JsonIn &jsin )
     JsonObject data = jsin.get_object();
     data.allow_omitted_members();
     data.read( "items", items );
+    on_changed();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2161,8 +2162,8 @@ void item::io( Archive &archive )
     }, io::required_tag() );
 
     // normalize legacy saves to always have charges >= 0
-    archive.io( "charges", charges, 0 );
-    charges = std::max( charges, 0 );
+    archive.io( "charges", charges_, 0 );
+    charges_ = std::max( charges_, 0 );
 
     archive.io( "energy", energy, 0_J );
 
@@ -2175,7 +2176,7 @@ void item::io( Archive &archive )
     archive.io( "bday", bday, calendar::start_of_cataclysm );
     archive.io( "mission_id", mission_id, -1 );
     archive.io( "player_id", player_id, -1 );
-    archive.io( "item_vars", item_vars, io::empty_default_tag() );
+    archive.io( "item_vars", vars, io::empty_default_tag() );
     // TODO: change default to empty string
     archive.io( "name", corpse_name, std::string() );
     archive.io( "owner", owner, owner.NULL_ID() );
@@ -2259,8 +2260,8 @@ void item::io( Archive &archive )
     // Compatibility for item type changes: for example soap changed from being a generic item
     // (item::charges -1 or 0 or anything else) to comestible (and thereby counted by charges),
     // old saves still have invalid charges, this fixes the charges value to the default charges.
-    if( count_by_charges() && charges <= 0 ) {
-        charges = item( type, calendar::start_of_cataclysm ).charges;
+    if( count_by_charges() && charges_ <= 0 ) {
+        charges_ = item( type, calendar::start_of_cataclysm ).charges();
     }
     if( is_food() ) {
         active = true;
@@ -2278,31 +2279,27 @@ void item::io( Archive &archive )
     // Books without any chapters don't need to store a remaining-chapters
     // counter, it will always be 0 and it prevents proper stacking.
     if( get_chapters() == 0 ) {
-        for( auto it = item_vars.begin(); it != item_vars.end(); ) {
-            if( it->first.compare( 0, 19, "remaining-chapters-" ) == 0 ) {
-                item_vars.erase( it++ );
-            } else {
-                ++it;
-            }
-        }
+        vars.erase_if( []( const std::string & name ) {
+            return name.compare( 0, 19, "remaining-chapters-" ) == 0;
+        } );
     }
 
     // Remove stored translated gerund in favor of storing the inscription tool type
-    item_vars.erase( "item_label_type" );
-    item_vars.erase( "item_note_type" );
+    vars.erase( "item_label_type" );
+    vars.erase( "item_note_type" );
 
     // Activate corpses from old saves
     if( is_corpse() && !active ) {
         active = true;
     }
 
-    if( charges != 0 && !type->can_have_charges() ) {
+    if( charges_ != 0 && !type->can_have_charges() ) {
         // Types that are known to have charges, but should not have them.
         // We fix it here, but it's expected from bugged saves and does not require a message.
         if( charge_removal_blacklist::get().count( type->get_id() ) == 0 ) {
             debugmsg( "Item %s was loaded with charges, but can not have any!", type->get_id() );
         }
-        charges = 0;
+        charges_ = 0;
     }
 
     // Relic check. Kinda late, but that's how relics have to be
@@ -2317,6 +2314,7 @@ void item::deserialize( JsonIn &jsin )
     data.allow_omitted_members();
     io::JsonObjectInputArchive archive( data );
     io( archive );
+    invalidate_caches();
     // made for fast forwarding time from 0.D to 0.E
     if( savegame_loading_version < 27 ) {
         legacy_fast_forward_time();
@@ -2488,7 +2486,7 @@ void vehicle_part::deserialize( JsonIn &jsin )
         if( ammo_capacity() > 0 ) {
             ammo_set( legacy_fuel, data.get_int( "amount" ) );
         }
-        base->item_tags.insert( flag_id( "VEHICLE" ) );
+        base->set_flag( flag_id( "VEHICLE" ) );
     }
 
     if( data.has_int( "hp" ) && id.obj().durability > 0 ) {
@@ -2501,7 +2499,7 @@ void vehicle_part::deserialize( JsonIn &jsin )
     if( is_turret() && !items.empty() ) {
         const int qty = std::accumulate( items.begin(), items.end(), 0, []( int lhs,
         const item * const & rhs ) {
-            return lhs + rhs->charges;
+            return lhs + rhs->charges();
         } );
         ammo_set( ( *items.begin() )->ammo_current(), qty );
         items.clear();
@@ -3195,7 +3193,8 @@ struct mm_elem {
     }
 };
 
-void mm_submap::serialize( JsonOut &jsout ) const
+void mm_submap::serialize( JsonOut &jsout,
+                           const std::unordered_map<std::uint32_t, int> &name_index ) const
 {
     jsout.start_array();
 
@@ -3206,9 +3205,9 @@ void mm_submap::serialize( JsonOut &jsout ) const
 
     const auto write_seq = [&]() {
         jsout.start_array();
-        jsout.write( last.tile.tile );
-        jsout.write( last.tile.subtile );
-        jsout.write( last.tile.rotation );
+        jsout.write( name_index.at( last.tile.tile.to_i() ) );
+        jsout.write( static_cast<int>( last.tile.subtile ) );
+        jsout.write( static_cast<int>( last.tile.rotation ) );
         jsout.write( last.symbol );
         if( num_same != 1 ) {
             jsout.write( num_same );
@@ -3238,7 +3237,7 @@ void mm_submap::serialize( JsonOut &jsout ) const
     jsout.end_array();
 }
 
-void mm_submap::deserialize( JsonIn &jsin )
+void mm_submap::deserialize( JsonIn &jsin, const std::vector<memorized_tile_id> &names )
 {
     jsin.start_array();
 
@@ -3253,9 +3252,18 @@ void mm_submap::deserialize( JsonIn &jsin )
                 remaining -= 1;
             } else {
                 jsin.start_array();
-                elem.tile.tile = jsin.get_string();
-                elem.tile.subtile = jsin.get_int();
-                elem.tile.rotation = jsin.get_int();
+                if( jsin.test_string() ) {
+                    // Region files from before the table of names
+                    elem.tile.tile = memorized_tile_id( jsin.get_string() );
+                } else {
+                    const int name = jsin.get_int();
+                    if( name < 0 || static_cast<size_t>( name ) >= names.size() ) {
+                        jsin.error( "invalid tile name index" );
+                    }
+                    elem.tile.tile = names[name];
+                }
+                elem.tile.subtile = static_cast<std::uint8_t>( jsin.get_int() );
+                elem.tile.rotation = static_cast<std::int16_t>( jsin.get_int() );
                 elem.symbol = jsin.get_int();
                 if( jsin.test_int() ) {
                     remaining = jsin.get_int() - 1;
@@ -3277,6 +3285,32 @@ void mm_submap::deserialize( JsonIn &jsin )
 
 void mm_region::serialize( JsonOut &jsout ) const
 {
+    std::vector<memorized_tile_id> names;
+    std::unordered_map<std::uint32_t, int> name_index;
+    for( const auto &column : submaps ) {
+        for( const shared_ptr_fast<mm_submap> &sm : column ) {
+            if( sm->is_empty() ) {
+                continue;
+            }
+            for( int y = 0; y < SEEY; y++ ) {
+                for( int x = 0; x < SEEX; x++ ) {
+                    const memorized_tile_id &name = sm->tile( point( x, y ) ).tile;
+                    if( name_index.emplace( name.to_i(), static_cast<int>( names.size() ) ).second ) {
+                        names.push_back( name );
+                    }
+                }
+            }
+        }
+    }
+
+    jsout.start_object();
+    jsout.member( "names" );
+    jsout.start_array();
+    for( const memorized_tile_id &name : names ) {
+        jsout.write( name.str() );
+    }
+    jsout.end_array();
+    jsout.member( "submaps" );
     jsout.start_array();
     // NOLINTNEXTLINE(modernize-loop-convert): leaving as is for readability
     for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
@@ -3286,32 +3320,58 @@ void mm_region::serialize( JsonOut &jsout ) const
             if( sm->is_empty() ) {
                 jsout.write_null();
             } else {
-                sm->serialize( jsout );
+                sm->serialize( jsout, name_index );
             }
         }
     }
     jsout.end_array();
+    jsout.end_object();
 }
 
-void mm_region::deserialize( JsonIn &jsin )
+static void deserialize_mm_submaps( JsonIn &jsin, mm_region &region,
+                                    const std::vector<memorized_tile_id> &names )
 {
     jsin.start_array();
     // NOLINTNEXTLINE(modernize-loop-convert): leaving as is for readability
     for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
         // NOLINTNEXTLINE(modernize-loop-convert): leaving as is for readability
         for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
-            shared_ptr_fast<mm_submap> &sm = submaps[x][y];
+            shared_ptr_fast<mm_submap> &sm = region.submaps[x][y];
             sm = make_shared_fast<mm_submap>();
             if( jsin.test_null() ) {
                 jsin.skip_null();
             } else {
-                sm->deserialize( jsin );
+                sm->deserialize( jsin, names );
             }
         }
     }
     jsin.end_array();
 }
 
+void mm_region::deserialize( JsonIn &jsin )
+{
+    std::vector<memorized_tile_id> names;
+    if( jsin.test_object() ) {
+        jsin.start_object();
+        while( !jsin.end_object() ) {
+            const std::string name = jsin.get_member_name();
+            if( name == "names" ) {
+                jsin.start_array();
+                while( !jsin.end_array() ) {
+                    names.emplace_back( jsin.get_string() );
+                }
+            } else if( name == "submaps" ) {
+                deserialize_mm_submaps( jsin, *this, names );
+            } else {
+                jsin.skip_value();
+            }
+        }
+    } else {
+        // Region files from before the table of names are only the array of submaps
+        deserialize_mm_submaps( jsin, *this, names );
+    }
+}
+
 void map_memory::load_legacy( JsonIn &jsin )
 {
     struct mig_elem {
@@ -3329,9 +3389,9 @@ void map_memory::load_legacy( JsonIn &jsin )
         p.y = jsin.get_int();
         p.z = jsin.get_int();
         mig_elem &elem = elems[p];
-        elem.tile.tile = jsin.get_string();
-        elem.tile.subtile = jsin.get_int();
-        elem.tile.rotation = jsin.get_int();
+        elem.tile.tile = memorized_tile_id( jsin.get_string() );
+        elem.tile.subtile = static_cast<std::uint8_t>( jsin.get_int() );
+        elem.tile.rotation = static_cast<std::int16_t>( jsin.get_int() );
         jsin.end_array();
     }
     jsin.start_array();
@@ -3593,6 +3653,7 @@ void event_multiset::deserialize( JsonIn &jsin )
 
 void stats_tracker::serialize( JsonOut &jsout ) const
 {
+    merge_all_pending();
     jsout.start_object();
     jsout.member( "data", data );
     jsout.member( "initial_scores", initial_scores );
@@ -3604,6 +3665,9 @@ void stats_tracker::deserialize( JsonIn &jsin )
     JsonObject jo = jsin.get_object();
     jo.allow_omitted_members();
     jo.read( "data", data );
+    for( std::unique_ptr<pending_events> &p : pending ) {
+        p.reset();
+    }
     for( std::pair<const event_type, event_multiset> &d : data ) {
         d.second.set_type( d.first );
     }
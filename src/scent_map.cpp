@@ -14,6 +14,7 @@
 #include "generic_factory.h"
 #include "map.h"
 #include "output.h"
+#include "profile.h"
 #include "string_id.h"
 
 static constexpr int SCENT_RADIUS = 40;
@@ -149,6 +150,7 @@ bool scent_map::inbounds( const tripoint &p ) const
 }
 void scent_map::update( const tripoint &center, map &m )
 {
+    ZoneScopedN( "scent_map::update" );
     // Stop updating scent after X turns of the player not moving.
     // Once wind is added, need to reset this on wind shifts as well.
     if( !player_last_position || center != *player_last_position ) {
@@ -135,6 +135,26 @@ void base_watcher::on_unsubscribe( stats_tracker *s )
 
 stats_tracker_state::~stats_tracker_state() = default;
 
+template<event_type Type>
+class typed_pending_events : public pending_events
+{
+    public:
+        using payload_type = typename cata::typed_event<Type>::payload_type;
+
+        void add( const payload_type &payload ) {
+            counts[payload]++;
+        }
+
+        void merge_into( event_multiset &events ) override {
+            for( const std::pair<const payload_type, int> &p : counts ) {
+                events.add( { cata::typed_event<Type>::to_data( p.first ), p.second } );
+            }
+            counts.clear();
+        }
+    private:
+        std::map<payload_type, int> counts;
+};
+
 stats_tracker::~stats_tracker()
 {
     unwatch_all();
@@ -142,6 +162,7 @@ stats_tracker::~stats_tracker()
 
 event_multiset &stats_tracker::get_events( event_type type )
 {
+    merge_pending( type );
     return data.emplace( type, event_multiset( type ) ).first->second;
 }
 
@@ -248,6 +269,9 @@ void stats_tracker::clear()
 {
     unwatch_all();
     data.clear();
+    for( std::unique_ptr<pending_events> &p : pending ) {
+        p.reset();
+    }
     event_transformation_states.clear();
     stat_states.clear();
     initial_scores.clear();
@@ -267,17 +291,58 @@ void stats_tracker::unwatch_all()
     unsub_all( stat_watchers );
 }
 
-void stats_tracker::notify( const cata::event &e )
+void stats_tracker::merge_pending( event_type type ) const
 {
-    const event_type type = e.type();
-    get_events( type ).add( e );
+    const std::unique_ptr<pending_events> &p = pending[static_cast<size_t>( type )];
+    if( p ) {
+        p->merge_into( data.emplace( type, event_multiset( type ) ).first->second );
+    }
+}
+
+void stats_tracker::merge_all_pending() const
+{
+    for( size_t i = 0; i < pending.size(); ++i ) {
+        merge_pending( static_cast<event_type>( i ) );
+    }
+}
+
+enum_bitset<event_type> stats_tracker::notified_types() const
+{
+    return enum_bitset<event_type>();
+}
+
+void stats_tracker::listen_to( event_bus &bus )
+{
+    listen_to( bus, std::make_integer_sequence<int, static_cast<int>( event_type::num_event_types )> {} );
+}
+
+template<int... I>
+void stats_tracker::listen_to( event_bus &bus, std::integer_sequence<int, I...> )
+{
+    bool discard[] = {
+        ( bus.listen<static_cast<event_type>( I )>( this, [this](
+        const cata::typed_event<static_cast<event_type>( I )> &e ) {
+            record( e );
+        } ), true )...
+    };
+    ( void ) discard;
+}
+
+template<event_type Type>
+void stats_tracker::record( const cata::typed_event<Type> &e )
+{
+    std::unique_ptr<pending_events> &p = pending[static_cast<size_t>( Type )];
+    if( !p ) {
+        p = std::make_unique<typed_pending_events<Type>>();
+    }
+    static_cast<typed_pending_events<Type> &>( *p ).add( e.payload() );
 
-    auto it = event_type_watchers.find( type );
-    if( it != event_type_watchers.end() ) {
-        it->second.send_to_all( &event_multiset_watcher::event_added, e, *this );
+    auto it = event_type_watchers.find( Type );
+    if( it != event_type_watchers.end() && !it->second.empty() ) {
+        it->second.send_to_all( &event_multiset_watcher::event_added, e.to_event(), *this );
     }
 
-    if( e.type() == event_type::game_start ) {
+    if( Type == event_type::game_start ) {
         assert( initial_scores.empty() );
         for( const score &scr : score::get_all() ) {
             initial_scores.insert( scr.id );
@@ -1,15 +1,18 @@
 #ifndef CATA_SRC_STATS_TRACKER_H
 #define CATA_SRC_STATS_TRACKER_H
 
+#include <array>
 #include <memory>
 #include <set>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "cata_variant.h"
+#include "enum_bitset.h"
 #include "event.h"
 #include "event_bus.h"
 #include "hash_utils.h"
@@ -120,6 +123,10 @@ class watcher_set
             return watchers_.erase( watcher );
         }
 
+        bool empty() const {
+            return watchers_.empty();
+        }
+
         template<typename Class, typename... FnArgs, typename... Args>
         void send_to_all( void ( Class::*mem_fn )( FnArgs... ), Args &&... args ) const {
             static_assert( std::is_base_of<Class, Watcher>::value,
@@ -146,6 +153,15 @@ class stats_tracker_state
         virtual ~stats_tracker_state() = 0;
 };
 
+// Events of one type which stats_tracker has received but not yet merged
+// into its event_multiset, counted by their statically typed payload.
+class pending_events
+{
+    public:
+        virtual ~pending_events() = default;
+        virtual void merge_into( event_multiset & ) = 0;
+};
+
 class stats_tracker : public event_subscriber
 {
     public:
@@ -173,14 +189,26 @@ class stats_tracker : public event_subscriber
         std::vector<const score *> valid_scores() const;
 
         void clear();
-        void notify( const cata::event & ) override;
+        enum_bitset<event_type> notified_types() const override;
+        void listen_to( event_bus & ) override;
 
         void serialize( JsonOut & ) const;
         void deserialize( JsonIn & );
     private:
+        template<event_type Type>
+        void record( const cata::typed_event<Type> & );
+        template<int... I>
+        void listen_to( event_bus &, std::integer_sequence<int, I...> );
+
+        void merge_pending( event_type ) const;
+        void merge_all_pending() const;
         void unwatch_all();
 
-        std::unordered_map<event_type, event_multiset> data;
+        // Events are counted by typed payload when they arrive and only
+        // converted to the map-based form when they are queried or saved.
+        mutable std::unordered_map<event_type, event_multiset> data;
+        mutable std::array<std::unique_ptr<pending_events>,
+                static_cast<size_t>( event_type::num_event_types )> pending;
 
         std::unordered_map<event_type, watcher_set<event_multiset_watcher>> event_type_watchers;
         std::unordered_map<string_id<event_transformation>, watcher_set<event_multiset_watcher>>
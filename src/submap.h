@@ -222,6 +222,9 @@ class submap : maptile_soa<SEEX, SEEY>
         // If is_uniform is true, this submap is a solid block of terrain
         // Uniform submaps aren't saved/loaded, because regenerating them is faster
         bool is_uniform;
+        // False if the submap hasn't changed since it was last written to or loaded from its file.
+        // Set when a map loads or saves it, and by the few things that change submaps outside of a map.
+        bool modified = true;
 
         std::vector<cosmetic_t> cosmetics; // Textual "visuals" for squares
 
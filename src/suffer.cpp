@@ -1293,10 +1293,10 @@ void Character::suffer_from_bad_bionics()
         mod_power_level( -bio_dis_shock->power_trigger );
 
         item &weapon = primary_weapon();
-        if( weapon.typeId() == itype_e_handcuffs && weapon.charges > 0 ) {
-            weapon.charges -= rng( 1, 3 ) * 50;
-            if( weapon.charges < 1 ) {
-                weapon.charges = 1;
+        if( weapon.typeId() == itype_e_handcuffs && weapon.charges() > 0 ) {
+            weapon.set_charges( weapon.charges() - ( rng( 1, 3 ) * 50 ) );
+            if( weapon.charges() < 1 ) {
+                weapon.set_charges( 1 );
             }
 
             add_msg_if_player( m_good, _( "The %s seems to be affected by the discharge." ),
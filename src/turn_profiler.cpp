@@ -0,0 +1,227 @@
+#include "turn_profiler.h"
+
+#include <algorithm>
+#include <map>
+#include <ostream>
+#include <utility>
+
+#include "fstream_utils.h"
+#include "json.h"
+
+namespace cata
+{
+
+std::atomic<bool> turn_profiler::recording{ false };
+
+thread_local turn_profiler::thread_buffer *turn_profiler::local_buffer = nullptr;
+
+static std::int64_t to_ns( std::chrono::steady_clock::time_point t )
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>( t.time_since_epoch() ).count();
+}
+
+turn_profiler &get_turn_profiler()
+{
+    static turn_profiler profiler;
+    return profiler;
+}
+
+void turn_profiler::start()
+{
+    reset();
+    recording = true;
+}
+
+void turn_profiler::stop()
+{
+    recording = false;
+}
+
+void turn_profiler::reset()
+{
+    std::lock_guard<std::mutex> guard( buffers_lock );
+    for( const std::unique_ptr<thread_buffer> &buf : buffers ) {
+        std::lock_guard<std::mutex> buf_guard( buf->lock );
+        buf->written = 0;
+        buf->summed = 0;
+    }
+    history.clear();
+    since_start = turn_summary();
+    turn_start = std::chrono::steady_clock::now();
+    dropped = 0;
+}
+
+turn_profiler::thread_buffer &turn_profiler::add_thread_buffer()
+{
+    std::lock_guard<std::mutex> guard( buffers_lock );
+    buffers.push_back( std::make_unique<thread_buffer>() );
+    thread_buffer &buf = *buffers.back();
+    buf.events.resize( ring_size );
+    buf.tid = static_cast<int>( buffers.size() );
+    return buf;
+}
+
+void turn_profiler::record( const char *name, std::chrono::steady_clock::time_point start )
+{
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    if( local_buffer == nullptr ) {
+        local_buffer = &get_turn_profiler().add_thread_buffer();
+    }
+    thread_buffer &buf = *local_buffer;
+    std::lock_guard<std::mutex> guard( buf.lock );
+    buf.events[buf.written % ring_size] = event{ name, to_ns( start ), to_ns( end ) };
+    buf.written++;
+}
+
+void turn_profiler::end_turn()
+{
+    if( !is_running() ) {
+        return;
+    }
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    turn_summary turn;
+    turn.duration = now - turn_start;
+    turn_start = now;
+    {
+        std::lock_guard<std::mutex> guard( buffers_lock );
+        for( const std::unique_ptr<thread_buffer> &buf : buffers ) {
+            std::lock_guard<std::mutex> buf_guard( buf->lock );
+            if( buf->written - buf->summed > ring_size ) {
+                dropped += static_cast<int>( buf->written - buf->summed - ring_size );
+                buf->summed = buf->written - ring_size;
+            }
+            for( ; buf->summed < buf->written; buf->summed++ ) {
+                const event &e = buf->events[buf->summed % ring_size];
+                const std::chrono::nanoseconds spent( e.end_ns - e.start_ns );
+                zone_totals &totals = turn.zones[e.name];
+                totals.calls++;
+                totals.total += spent;
+                totals.max = std::max( totals.max, spent );
+            }
+        }
+    }
+    since_start.duration += turn.duration;
+    for( const std::pair<const char *const, zone_totals> &e : turn.zones ) {
+        zone_totals &totals = since_start.zones[e.first];
+        totals.calls += e.second.calls;
+        totals.total += e.second.total;
+        totals.max = std::max( totals.max, e.second.max );
+    }
+    history.push_back( std::move( turn ) );
+    while( history.size() > static_cast<size_t>( history_turns ) ) {
+        history.pop_front();
+    }
+}
+
+int turn_profiler::recorded_turns() const
+{
+    return static_cast<int>( history.size() );
+}
+
+std::chrono::nanoseconds turn_profiler::recorded_time() const
+{
+    std::chrono::nanoseconds ret( 0 );
+    for( const turn_summary &turn : history ) {
+        ret += turn.duration;
+    }
+    return ret;
+}
+
+void turn_profiler::add_zones( std::map<std::string, zone_usage> &by_name,
+                               const turn_summary &turn )
+{
+    // The same name may be at different addresses in different translation units
+    for( const std::pair<const char *const, zone_totals> &e : turn.zones ) {
+        zone_usage &usage = by_name[e.first];
+        usage.calls += e.second.calls;
+        usage.total += e.second.total;
+        usage.max = std::max( usage.max, e.second.max );
+    }
+}
+
+std::vector<turn_profiler::zone_usage> turn_profiler::sorted_zones(
+    std::map<std::string, zone_usage> &by_name )
+{
+    std::vector<zone_usage> ret;
+    ret.reserve( by_name.size() );
+    for( std::pair<const std::string, zone_usage> &e : by_name ) {
+        e.second.name = e.first;
+        ret.push_back( std::move( e.second ) );
+    }
+    std::sort( ret.begin(), ret.end(), []( const zone_usage & a, const zone_usage & b ) {
+        return a.total > b.total;
+    } );
+    return ret;
+}
+
+std::vector<turn_profiler::zone_usage> turn_profiler::top_zones( size_t count ) const
+{
+    std::map<std::string, zone_usage> by_name;
+    for( const turn_summary &turn : history ) {
+        add_zones( by_name, turn );
+    }
+    std::vector<zone_usage> ret = sorted_zones( by_name );
+    if( ret.size() > count ) {
+        ret.resize( count );
+    }
+    return ret;
+}
+
+std::vector<turn_profiler::zone_usage> turn_profiler::zones_since_start() const
+{
+    std::map<std::string, zone_usage> by_name;
+    add_zones( by_name, since_start );
+    return sorted_zones( by_name );
+}
+
+bool turn_profiler::write_chrome_trace( const std::string &path ) const
+{
+    struct trace_event {
+        const char *name;
+        std::int64_t start_ns;
+        std::int64_t end_ns;
+        int tid;
+    };
+    std::vector<trace_event> events;
+    {
+        std::lock_guard<std::mutex> guard( buffers_lock );
+        for( const std::unique_ptr<thread_buffer> &buf : buffers ) {
+            std::lock_guard<std::mutex> buf_guard( buf->lock );
+            const std::uint64_t first = buf->written > ring_size ? buf->written - ring_size : 0;
+            for( std::uint64_t i = first; i < buf->written; i++ ) {
+                const event &e = buf->events[i % ring_size];
+                events.push_back( trace_event{ e.name, e.start_ns, e.end_ns, buf->tid } );
+            }
+        }
+    }
+    std::int64_t epoch = 0;
+    if( !events.empty() ) {
+        epoch = std::min_element( events.begin(), events.end(),
+        []( const trace_event & a, const trace_event & b ) {
+            return a.start_ns < b.start_ns;
+        } )->start_ns;
+    }
+
+    return write_to_file( path, [&]( std::ostream & out ) {
+        JsonOut jsout( out );
+        jsout.start_object();
+        jsout.member( "displayTimeUnit", "ms" );
+        jsout.member( "traceEvents" );
+        jsout.start_array();
+        for( const trace_event &e : events ) {
+            jsout.start_object();
+            jsout.member( "name", e.name );
+            jsout.member( "ph", "X" );
+            // Timestamps and durations are in microseconds
+            jsout.member( "ts", static_cast<double>( e.start_ns - epoch ) / 1000.0 );
+            jsout.member( "dur", static_cast<double>( e.end_ns - e.start_ns ) / 1000.0 );
+            jsout.member( "pid", 1 );
+            jsout.member( "tid", e.tid );
+            jsout.end_object();
+        }
+        jsout.end_array();
+        jsout.end_object();
+    }, "turn profile" );
+}
+
+} // namespace cata
@@ -0,0 +1,149 @@
+#pragma once
+#ifndef CATA_SRC_TURN_PROFILER_H
+#define CATA_SRC_TURN_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cata
+{
+
+/**
+ * Built-in profiler for builds without Tracy.
+ *
+ * When Tracy is not used, the ZoneScoped and ZoneScopedN macros from profile.h create a
+ * @ref profile_zone. While the profiler is running, each zone that ends is written to a ring
+ * buffer of the thread it ran on. @ref end_turn sums up the zones of every turn, and the
+ * last @ref history_turns turns are kept for the sidebar panel. The sums of all turns since
+ * the profiler was started are kept as well, for the turn benchmark.
+ *
+ * The ring buffers also hold the latest zones in order, they can be written out as
+ * a Chrome trace (chrome://tracing, Perfetto) with @ref write_chrome_trace.
+ */
+class turn_profiler
+{
+    public:
+        /** Number of turns summed up for @ref top_zones. */
+        static constexpr int history_turns = 100;
+        /** Zones kept per thread for the Chrome trace. */
+        static constexpr size_t ring_size = 1 << 15;
+
+        struct zone_usage {
+            std::string name;
+            int calls = 0;
+            std::chrono::nanoseconds total{ 0 };
+            std::chrono::nanoseconds max{ 0 };
+        };
+
+        void start();
+        void stop();
+        bool is_running() const {
+            return recording.load( std::memory_order_relaxed );
+        }
+        /** Discards recorded zones and turns. */
+        void reset();
+
+        /** Sums up the zones recorded since the previous call as one turn. */
+        void end_turn();
+
+        /** Number of turns the history holds, up to @ref history_turns. */
+        int recorded_turns() const;
+        /** Total time of the turns in the history, as measured between calls to @ref end_turn. */
+        std::chrono::nanoseconds recorded_time() const;
+        /** The @p count zones with the most time over the turns in the history, longest first. */
+        std::vector<zone_usage> top_zones( size_t count ) const;
+        /** Every zone over all turns since @ref start or @ref reset, longest first. */
+        std::vector<zone_usage> zones_since_start() const;
+        /** Zones that didn't fit into the ring buffer before they were summed up. */
+        int dropped_zones() const {
+            return dropped;
+        }
+
+        /** Writes the zones in the ring buffers in Chrome trace event format. */
+        bool write_chrome_trace( const std::string &path ) const;
+
+        /** Records a zone that started at @p start and ends now. */
+        static void record( const char *name, std::chrono::steady_clock::time_point start );
+
+    private:
+        friend class profile_zone;
+
+        struct event {
+            const char *name;
+            std::int64_t start_ns;
+            std::int64_t end_ns;
+        };
+        struct thread_buffer {
+            std::mutex lock;
+            std::vector<event> events;
+            // Events ever written, the latest is at ( written - 1 ) % ring_size
+            std::uint64_t written = 0;
+            // Events already summed up by end_turn
+            std::uint64_t summed = 0;
+            int tid = 0;
+        };
+        struct zone_totals {
+            int calls = 0;
+            std::chrono::nanoseconds total{ 0 };
+            std::chrono::nanoseconds max{ 0 };
+        };
+        struct turn_summary {
+            std::chrono::nanoseconds duration{ 0 };
+            // Zone names are string literals or __func__, keyed by address
+            std::unordered_map<const char *, zone_totals> zones;
+        };
+
+        thread_buffer &add_thread_buffer();
+        static void add_zones( std::map<std::string, zone_usage> &by_name, const turn_summary &turn );
+        static std::vector<zone_usage> sorted_zones( std::map<std::string, zone_usage> &by_name );
+
+        static std::atomic<bool> recording;
+        static thread_local thread_buffer *local_buffer;
+
+        mutable std::mutex buffers_lock;
+        std::vector<std::unique_ptr<thread_buffer>> buffers;
+
+        std::deque<turn_summary> history;
+        // All turns since start, summed up
+        turn_summary since_start;
+        std::chrono::steady_clock::time_point turn_start;
+        int dropped = 0;
+};
+
+turn_profiler &get_turn_profiler();
+
+/** A scope measured by @ref turn_profiler, see ZoneScoped in profile.h. */
+class profile_zone
+{
+    public:
+        explicit profile_zone( const char *zone_name )
+            : name( turn_profiler::recording.load( std::memory_order_relaxed ) ? zone_name : nullptr ) {
+            if( name != nullptr ) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+        profile_zone( const profile_zone & ) = delete;
+        profile_zone &operator=( const profile_zone & ) = delete;
+        ~profile_zone() {
+            if( name != nullptr ) {
+                turn_profiler::record( name, start );
+            }
+        }
+
+    private:
+        const char *name;
+        std::chrono::steady_clock::time_point start;
+};
+
+} // namespace cata
+
+#endif // CATA_SRC_TURN_PROFILER_H
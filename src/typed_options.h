@@ -0,0 +1,84 @@
+#pragma once
+#ifndef CATA_SRC_TYPED_OPTIONS_H
+#define CATA_SRC_TYPED_OPTIONS_H
+
+#include <string>
+
+/**
+ * Options read often enough (every turn, every frame) that a string-keyed lookup
+ * per read is noticeable.
+ *
+ * Each entry generates a member of @ref typed_option_values and a constexpr
+ * @ref option_handle of the same name in namespace `option`, so reads look like
+ * `get_option( option::AUTOSAVE )`. The type must match the one the option
+ * is registered with in options.cpp.
+ *
+ * Only options that are always registered belong here. External options added by mods
+ * (see @ref options_manager::add_external) don't exist until mods are loaded, while the
+ * values are first refreshed before that.
+ *
+ * Values are refreshed from @ref options_manager the first time a handle is read
+ * after any option changes, so the common path is a flag test and a member read.
+ */
+#define CATA_TYPED_OPTIONS( X ) \
+    X( bool, ANIMATIONS ) \
+    X( bool, AUTOSAFEMODE ) \
+    X( int, AUTOSAFEMODETURNS ) \
+    X( bool, AUTOSAVE ) \
+    X( int, AUTOSAVE_MINUTES ) \
+    X( int, AUTOSAVE_TURNS ) \
+    X( bool, FORCE_REDRAW ) \
+    X( bool, ITEM_HEALTH_BAR ) \
+    X( std::string, LUA_BUDGET_ACTION ) \
+    X( int, LUA_TURN_BUDGET ) \
+    X( int, MAPGEN_PREFETCH_BUDGET ) \
+    X( float, MONSTER_UPGRADE_FACTOR ) \
+    X( bool, SAFEMODE ) \
+    X( int, SAFEMODEPROXIMITY ) \
+    X( std::string, SIDEBAR_POSITION )
+
+struct typed_option_values {
+#define CATA_TYPED_OPTION_MEMBER( type, name ) type name{};
+    CATA_TYPED_OPTIONS( CATA_TYPED_OPTION_MEMBER )
+#undef CATA_TYPED_OPTION_MEMBER
+};
+
+template<typename T>
+struct option_handle {
+    T typed_option_values::*member;
+    const char *name;
+};
+
+namespace option
+{
+#define CATA_TYPED_OPTION_HANDLE( type, name ) \
+    constexpr option_handle<type> name{ &typed_option_values::name, #name };
+CATA_TYPED_OPTIONS( CATA_TYPED_OPTION_HANDLE )
+#undef CATA_TYPED_OPTION_HANDLE
+} // namespace option
+
+namespace typed_options
+{
+extern typed_option_values values;
+extern bool stale;
+
+/** Re-reads every typed option from @ref options_manager. */
+void refresh();
+} // namespace typed_options
+
+/** Marks the typed option values as outdated, called whenever any option changes. */
+inline void invalidate_typed_options()
+{
+    typed_options::stale = true;
+}
+
+template<typename T>
+inline const T &get_option( const option_handle<T> &handle )
+{
+    if( typed_options::stale ) {
+        typed_options::refresh();
+    }
+    return typed_options::values.*( handle.member );
+}
+
+#endif // CATA_SRC_TYPED_OPTIONS_H
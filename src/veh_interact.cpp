@@ -3213,7 +3213,7 @@ void veh_interact::complete_vehicle( player &p )
                 }
 
             } else if( pt.is_fuel_store() ) {
-                auto qty = src->charges;
+                auto qty = src->charges();
                 pt.base->reload( p, *src, qty );
 
                 //~ 1$s vehicle name, 2$s reactor name
@@ -385,6 +385,17 @@ vehicle::vehicle( const vproto_id &type_id, int init_veh_fuel,
     refresh();
 }
 
+uint64_t vehicle::next_footprint_revision()
+{
+    static uint64_t last_revision = 0;
+    return ++last_revision;
+}
+
+void vehicle::invalidate_footprint()
+{
+    footprint_revision = next_footprint_revision();
+}
+
 vehicle::vehicle() : vehicle( vproto_id() )
 {
     sm_pos = tripoint_zero;
@@ -4827,8 +4838,12 @@ std::vector<vehicle_part *> vehicle::lights( bool active )
 int vehicle::total_accessory_epower_w() const
 {
     int epower = 0;
-    for( const vpart_reference &vp : get_enabled_parts( VPFLAG_ENABLED_DRAINS_EPOWER ) ) {
-        epower += vp.info().epower;
+    // Same parts as get_enabled_parts( VPFLAG_ENABLED_DRAINS_EPOWER ), without scanning all of them
+    for( int p : accessories ) {
+        const vehicle_part &pt = parts[p];
+        if( !pt.removed && pt.enabled && !pt.is_broken() && pt.is_available() ) {
+            epower += pt.info().epower;
+        }
     }
     return epower;
 }
@@ -4978,11 +4993,13 @@ void vehicle::power_parts()
     int epower = engine_epower + total_accessory_epower_w() + total_alternator_epower_w();
 
     int delta_energy_bat = power_to_energy_bat( epower, 1_turns );
-    int storage_deficit_bat = std::max( 0, fuel_capacity( fuel_type_battery ) -
-                                        fuel_left( fuel_type_battery ) - delta_energy_bat );
     // Reactors trigger only on demand. If we'd otherwise run out of power, see
     // if we can spin up the reactors.
-    if( !reactors.empty() && storage_deficit_bat > 0 ) {
+    // Battery totals scan every part, so they're only counted for vehicles with reactors.
+    const int storage_deficit_bat = reactors.empty() ? 0 :
+                                    std::max( 0, fuel_capacity( fuel_type_battery ) -
+                                              fuel_left( fuel_type_battery ) - delta_energy_bat );
+    if( storage_deficit_bat > 0 ) {
         // Still not enough surplus epower to fully charge battery
         // Produce additional epower from any reactors
         bool reactor_working = false;
@@ -5091,6 +5108,8 @@ vehicle *vehicle::find_vehicle( const tripoint &where )
     for( auto &elem : sm->vehicles ) {
         vehicle *found_veh = elem.get();
         if( veh_in_sm.xy() == found_veh->pos ) {
+            // Callers charge and discharge it, with no map to save it afterwards
+            sm->modified = true;
             return found_veh;
         }
     }
@@ -5109,7 +5128,14 @@ void vehicle::enumerate_vehicles( std::map<vehicle *, bool> &connected_vehicles,
     for( vehicle *veh : vehicle_list ) {
         // This autovivifies, and also overwrites the value if already present.
         connected_vehicles[veh] = true;
-        distribution_graph::traverse( *veh, enumerate_visitor, distribution_graph::noop_visitor_grid );
+        // Most vehicles aren't plugged into anything, don't set up a traversal for them
+        const bool has_cables = std::any_of( veh->loose_parts.begin(), veh->loose_parts.end(),
+        [veh]( int p ) {
+            return veh->part_info( p ).has_flag( "POWER_TRANSFER" );
+        } );
+        if( has_cables ) {
+            distribution_graph::traverse( *veh, enumerate_visitor, distribution_graph::noop_visitor_grid );
+        }
     }
 }
 
@@ -5277,30 +5303,157 @@ void traverse( StartPoint &start,
 
 } // namespace distribution_graph
 
+// Charge of the battery at the given percentage, the same rounding as the percentage steps used to be
+static int charge_at_percent( const vehicles::battery_level &b, int percent )
+{
+    return static_cast<int>( static_cast<int64_t>( percent ) * b.capacity / 100 );
+}
+
+// Percentage of the battery is lower than that of the other one
+static bool emptier( const vehicles::battery_level &l, const vehicles::battery_level &r )
+{
+    return static_cast<int64_t>( l.charge ) * r.capacity < static_cast<int64_t>( r.charge ) * l.capacity;
+}
+
+int vehicles::charge_batteries( std::vector<battery_level> &batteries, int amount )
+{
+    if( amount <= 0 ) {
+        return amount;
+    }
+    int64_t room = 0;
+    for( const battery_level &b : batteries ) {
+        room += b.capacity - b.charge;
+    }
+    if( amount >= room ) {
+        for( battery_level &b : batteries ) {
+            b.charge = b.capacity;
+        }
+        return amount - static_cast<int>( room );
+    }
+
+    const auto needed = [&batteries]( int percent ) {
+        int64_t total = 0;
+        for( const battery_level &b : batteries ) {
+            total += std::max( 0, charge_at_percent( b, percent ) - b.charge );
+        }
+        return total;
+    };
+    // Highest percentage every battery can be raised to
+    int low = 0;
+    int high = 100;
+    while( low < high ) {
+        const int mid = ( low + high + 1 ) / 2;
+        if( needed( mid ) <= amount ) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    std::vector<battery_level *> not_full;
+    for( battery_level &b : batteries ) {
+        const int target = charge_at_percent( b, low );
+        if( target > b.charge ) {
+            amount -= target - b.charge;
+            b.charge = target;
+        }
+        if( b.charge < b.capacity ) {
+            not_full.push_back( &b );
+        }
+    }
+    // What is left isn't enough to raise all of them by another percent
+    std::stable_sort( not_full.begin(), not_full.end(),
+    []( const battery_level * l, const battery_level * r ) {
+        return emptier( *l, *r );
+    } );
+    for( battery_level *b : not_full ) {
+        if( amount <= 0 ) {
+            break;
+        }
+        const int next = std::min( b->capacity, std::max( charge_at_percent( *b, low + 1 ), b->charge + 1 ) );
+        const int qty = std::min( amount, next - b->charge );
+        b->charge += qty;
+        amount -= qty;
+    }
+    return amount;
+}
+
+int vehicles::discharge_batteries( std::vector<battery_level> &batteries, int amount )
+{
+    if( amount <= 0 ) {
+        return amount;
+    }
+    int64_t stored = 0;
+    for( const battery_level &b : batteries ) {
+        stored += b.charge;
+    }
+    if( amount >= stored ) {
+        for( battery_level &b : batteries ) {
+            b.charge = 0;
+        }
+        return amount - static_cast<int>( stored );
+    }
+
+    const auto given = [&batteries]( int percent ) {
+        int64_t total = 0;
+        for( const battery_level &b : batteries ) {
+            total += std::max( 0, b.charge - charge_at_percent( b, percent ) );
+        }
+        return total;
+    };
+    // Lowest percentage every battery can be drained to
+    int low = 0;
+    int high = 100;
+    while( low < high ) {
+        const int mid = ( low + high ) / 2;
+        if( given( mid ) <= amount ) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    std::vector<battery_level *> not_empty;
+    for( battery_level &b : batteries ) {
+        const int target = charge_at_percent( b, low );
+        if( target < b.charge ) {
+            amount -= b.charge - target;
+            b.charge = target;
+        }
+        if( b.charge > 0 ) {
+            not_empty.push_back( &b );
+        }
+    }
+    std::stable_sort( not_empty.begin(), not_empty.end(),
+    []( const battery_level * l, const battery_level * r ) {
+        return emptier( *r, *l );
+    } );
+    for( battery_level *b : not_empty ) {
+        if( amount <= 0 ) {
+            break;
+        }
+        const int prev = std::max( 0, charge_at_percent( *b, low - 1 ) );
+        const int qty = std::min( amount, b->charge - prev );
+        b->charge -= qty;
+        amount -= qty;
+    }
+    return amount;
+}
+
 int vehicle::charge_battery( int amount, bool include_other_vehicles )
 {
-    // Key parts by percentage charge level.
-    std::multimap<int, vehicle_part *> chargeable_parts;
+    std::vector<vehicle_part *> chargeable_parts;
+    std::vector<vehicles::battery_level> levels;
     for( vehicle_part &p : parts ) {
         if( p.is_available() && p.is_battery() && p.ammo_capacity() > p.ammo_remaining() ) {
-            chargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity(), &p } );
-        }
-    }
-    while( amount > 0 && !chargeable_parts.empty() ) {
-        // Grab first part, charge until it reaches the next %, then re-insert with new % key.
-        auto iter = chargeable_parts.begin();
-        int charge_level = iter->first;
-        vehicle_part *p = iter->second;
-        chargeable_parts.erase( iter );
-        // Calculate number of charges to reach the next %, but insure it's at least
-        // one more than current charge.
-        int next_charge_level = ( ( charge_level + 1 ) * p->ammo_capacity() ) / 100;
-        next_charge_level = std::max( next_charge_level, p->ammo_remaining() + 1 );
-        int qty = std::min( amount, next_charge_level - p->ammo_remaining() );
-        p->ammo_set( fuel_type_battery, p->ammo_remaining() + qty );
-        amount -= qty;
-        if( p->ammo_capacity() > p->ammo_remaining() ) {
-            chargeable_parts.insert( { ( p->ammo_remaining() * 100 ) / p->ammo_capacity(), p } );
+            chargeable_parts.push_back( &p );
+            levels.push_back( { p.ammo_remaining(), p.ammo_capacity() } );
+        }
+    }
+    if( !levels.empty() ) {
+        amount = vehicles::charge_batteries( levels, amount );
+        for( size_t i = 0; i < levels.size(); i++ ) {
+            if( levels[i].charge != chargeable_parts[i]->ammo_remaining() ) {
+                chargeable_parts[i]->ammo_set( fuel_type_battery, levels[i].charge );
+            }
         }
     }
 
@@ -5326,27 +5479,21 @@ int vehicle::charge_battery( int amount, bool include_other_vehicles )
 
 int vehicle::discharge_battery( int amount, bool recurse )
 {
-    // Key parts by percentage charge level.
-    std::multimap<int, vehicle_part *> dischargeable_parts;
+    std::vector<vehicle_part *> dischargeable_parts;
+    std::vector<vehicles::battery_level> levels;
     for( vehicle_part &p : parts ) {
         if( p.is_available() && p.is_battery() && p.ammo_remaining() > 0 ) {
-            dischargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity(), &p } );
+            dischargeable_parts.push_back( &p );
+            levels.push_back( { p.ammo_remaining(), p.ammo_capacity() } );
         }
     }
-    while( amount > 0 && !dischargeable_parts.empty() ) {
-        // Grab first part, discharge until it reaches the next %, then re-insert with new % key.
-        auto iter = std::prev( dischargeable_parts.end() );
-        int charge_level = iter->first;
-        vehicle_part *p = iter->second;
-        dischargeable_parts.erase( iter );
-        // Calculate number of charges to reach the previous %.
-        int prev_charge_level = ( ( charge_level - 1 ) * p->ammo_capacity() ) / 100;
-        prev_charge_level = std::max( 0, prev_charge_level );
-        int amount_to_discharge = std::min( p->ammo_remaining() - prev_charge_level, amount );
-        p->ammo_consume( amount_to_discharge, global_part_pos3( *p ) );
-        amount -= amount_to_discharge;
-        if( p->ammo_remaining() > 0 ) {
-            dischargeable_parts.insert( { ( p->ammo_remaining() * 100 ) / p->ammo_capacity(), p } );
+    if( !levels.empty() ) {
+        amount = vehicles::discharge_batteries( levels, amount );
+        for( size_t i = 0; i < levels.size(); i++ ) {
+            vehicle_part &p = *dischargeable_parts[i];
+            if( levels[i].charge != p.ammo_remaining() ) {
+                p.ammo_consume( p.ammo_remaining() - levels[i].charge, global_part_pos3( p ) );
+            }
         }
     }
 
@@ -5414,7 +5561,7 @@ void vehicle::idle( bool on_map )
     }
 
     // Disallow running a planter underground for now
-    if( !warm_enough_to_plant( g->u.pos() ) || global_pos3().z < 0 ) {
+    if( !planters.empty() && ( !warm_enough_to_plant( g->u.pos() ) || global_pos3().z < 0 ) ) {
         for( const vpart_reference &vp : get_enabled_parts( "PLANTER" ) ) {
             if( g->u.sees( global_pos3() ) ) {
                 add_msg( _( "The %s's planter turns off due to low temperature." ), name );
@@ -5431,16 +5578,18 @@ void vehicle::idle( bool on_map )
 
     process_emitters();
 
-    if( has_part( "STEREO", true ) ) {
-        play_music();
-    }
+    if( !idle_effects.empty() ) {
+        if( has_part( "STEREO", true ) ) {
+            play_music();
+        }
 
-    if( has_part( "CHIMES", true ) ) {
-        play_chimes();
-    }
+        if( has_part( "CHIMES", true ) ) {
+            play_chimes();
+        }
 
-    if( has_part( "CRASH_TERRAIN_AROUND", true ) ) {
-        crash_terrain_around();
+        if( has_part( "CRASH_TERRAIN_AROUND", true ) ) {
+            crash_terrain_around();
+        }
     }
 
     if( is_alarm_on ) {
@@ -5542,11 +5691,11 @@ detached_ptr<item> vehicle::add_charges( int part, detached_ptr<item> &&itm )
     }
 
     detached_ptr<item> itm_copy = item::spawn( *itm );
-    itm_copy->charges = amount;
-    itm->charges -= amount;
+    itm_copy->set_charges( amount );
+    itm->set_charges( itm->charges() - amount );
     detached_ptr<item> remaining = add_item( part, std::move( itm_copy ) );
-    itm->charges += remaining->charges;
-    return itm->charges > 0 ? std::move( itm ) : detached_ptr<item>();
+    itm->set_charges( itm->charges() + remaining->charges() );
+    return itm->charges() > 0 ? std::move( itm ) : detached_ptr<item>();
 }
 
 detached_ptr<item> vehicle::add_item( vehicle_part &pt, detached_ptr<item> &&obj )
@@ -5580,7 +5729,7 @@ detached_ptr<item> vehicle::add_item( int part, detached_ptr<item> &&itm )
     bool charge = itm->count_by_charges();
     vehicle_stack istack = get_items( part );
     const int to_move = istack.amount_can_fit( *itm );
-    if( to_move == 0 || ( charge && to_move < itm->charges ) ) {
+    if( to_move == 0 || ( charge && to_move < itm->charges() ) ) {
         return std::move( itm ); // @add_charges should be used in the latter case
     }
     if( charge ) {
@@ -5834,6 +5983,8 @@ void vehicle::enable_refresh()
  */
 void vehicle::refresh()
 {
+    // Parts may have been added or removed even if the rest has to wait
+    invalidate_footprint();
     if( no_refresh ) {
         return;
     }
@@ -5855,6 +6006,9 @@ void vehicle::refresh()
     steering.clear();
     speciality.clear();
     floating.clear();
+    accessories.clear();
+    planters.clear();
+    idle_effects.clear();
     alternator_load = 0;
     extra_drag = 0;
     rail_profile.clear();
@@ -5899,6 +6053,16 @@ void vehicle::refresh()
         if( vpi.has_flag( VPFLAG_FLOATS ) ) {
             floating.push_back( p );
         }
+        if( vpi.has_flag( VPFLAG_ENABLED_DRAINS_EPOWER ) ) {
+            accessories.push_back( p );
+        }
+        if( vpi.has_flag( "PLANTER" ) ) {
+            planters.push_back( p );
+        }
+        if( vpi.has_flag( "STEREO" ) || vpi.has_flag( "CHIMES" ) ||
+            vpi.has_flag( "CRASH_TERRAIN_AROUND" ) ) {
+            idle_effects.push_back( p );
+        }
 
         if( vp.part().is_unavailable() ) {
             continue;
@@ -5,6 +5,7 @@
 #include <array>
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <optional>
@@ -64,6 +65,23 @@ namespace vehicles
 // ratio of constant rolling resistance to the part that varies with velocity
 constexpr double rolling_constant_to_variable = 33.33;
 constexpr float vmiph_per_tile = 400.0f;
+
+struct battery_level {
+    int charge = 0;
+    int capacity = 0;
+};
+/**
+ * Charges the batteries by @p amount, emptiest (by percentage) first, so they end up
+ * evenly charged. The level they are raised to is calculated directly, so this is
+ * O(n log n) regardless of the amount.
+ * @return amount of charge left over.
+ */
+int charge_batteries( std::vector<battery_level> &batteries, int amount );
+/**
+ * Discharges the batteries by @p amount, fullest (by percentage) first.
+ * @return amount of request unfulfilled.
+ */
+int discharge_batteries( std::vector<battery_level> &batteries, int amount );
 } // namespace vehicles
 struct rider_data {
     Creature *psg = nullptr;
@@ -488,6 +506,15 @@ class vehicle
         void suspend_refresh();
         void enable_refresh();
 
+        /**
+         * Changes whenever parts are added, removed, damaged, repaired, opened or closed.
+         * Unique across vehicles, so map can tell its cached footprint of this vehicle is outdated.
+         */
+        uint64_t get_footprint_revision() const {
+            return footprint_revision;
+        }
+        void invalidate_footprint();
+
         inline void attach() {
             attached = true;
         }
@@ -1573,6 +1600,10 @@ class vehicle
         // List of parts that will not be on a vehicle very often, or which only one will be present
         std::vector<int> speciality;
         std::vector<int> floating;         // List of parts that provide buoyancy to boats
+        // Parts checked every turn by idle(), including unavailable ones
+        std::vector<int> accessories;      // List of ENABLED_DRAINS_EPOWER parts
+        std::vector<int> planters;         // List of PLANTER parts
+        std::vector<int> idle_effects;     // List of STEREO, CHIMES and CRASH_TERRAIN_AROUND parts
 
         /**
          * Rail profile of the vehicle.
@@ -1728,6 +1759,10 @@ class vehicle
         // is the vehicle currently placed on the map
         bool attached = false;
 
+        // see get_footprint_revision()
+        uint64_t footprint_revision = next_footprint_revision();
+        static uint64_t next_footprint_revision();
+
     public:
         // vehicle being driven by player/npc automatically
         bool is_autodriving = false;
@@ -160,7 +160,7 @@ detached_ptr<item> vehicle_part::properties_to_item() const
             tmp->erase_var( "source_z" );
             tmp->erase_var( "state" );
             tmp->active = false;
-            tmp->charges = tmp->type->maximum_charges();
+            tmp->set_charges( tmp->type->maximum_charges() );
         } else {
             const tripoint local_pos = here.getlocal( target.first );
             if( !here.veh_at( local_pos ) ) {
@@ -326,7 +326,7 @@ int vehicle_part::ammo_capacity() const
 int vehicle_part::ammo_remaining() const
 {
     if( is_tank() ) {
-        return base->contents.empty() ? 0 : base->contents.back().charges;
+        return base->contents.empty() ? 0 : base->contents.back().charges();
     }
 
     if( is_fuel_store( false ) || is_turret() ) {
@@ -376,8 +376,8 @@ int vehicle_part::ammo_consume( int qty, const tripoint &pos )
     if( is_tank() && !base->contents.empty() ) {
         const int res = std::min( ammo_remaining(), qty );
         item &liquid = base->contents.back();
-        liquid.charges -= res;
-        if( liquid.charges == 0 ) {
+        liquid.set_charges( liquid.charges() - res );
+        if( liquid.charges() == 0 ) {
             base->contents.clear_items();
         }
         return res;
@@ -402,11 +402,11 @@ double vehicle_part::consume_energy( const itype_id &ftype, double energy_j )
         if( !charges_to_use ) {
             return 0.0;
         }
-        if( charges_to_use >= fuel.charges ) {
-            charges_to_use = fuel.charges;
+        if( charges_to_use >= fuel.charges() ) {
+            charges_to_use = fuel.charges();
             base->contents.clear_items();
         } else {
-            fuel.charges -= charges_to_use;
+            fuel.set_charges( fuel.charges() - charges_to_use );
         }
         //TODO!: push up
         item &fuel_consumed = *item::spawn_temporary( ftype, calendar::turn, charges_to_use );
@@ -612,6 +612,7 @@ const vpart_info &vehicle_part::info() const
 
 void vehicle::set_hp( vehicle_part &pt, int qty )
 {
+    invalidate_footprint();
     if( qty == pt.info().durability || pt.info().durability <= 0 ) {
         pt.base->set_damage( 0 );
 
@@ -625,6 +626,7 @@ void vehicle::set_hp( vehicle_part &pt, int qty )
 
 bool vehicle::mod_hp( vehicle_part &pt, int qty, damage_type dt )
 {
+    invalidate_footprint();
     if( pt.info().durability > 0 ) {
         return pt.base->mod_damage( -( pt.base->max_damage() * qty / pt.info().durability ), dt );
     } else {
@@ -1440,17 +1440,17 @@ void vehicle::operate_planter()
                     sounds::sound( loc, rng( 10, 20 ), sounds::sound_t::combat, _( "Clink" ), false, "smash_success",
                                    "hit_vehicle" );
                 }
-                if( !i->count_by_charges() || i->charges == 1 ) {
+                if( !i->count_by_charges() || i->charges() == 1 ) {
                     i->set_age( 0_turns );
                     detached_ptr<item> det;
                     v.erase( it, &det );
                     g->m.add_item( loc, std::move( det ) );
                 } else {
                     detached_ptr<item> tmp = item::spawn( *i );
-                    tmp->charges = 1;
+                    tmp->set_charges( 1 );
                     tmp->set_age( 0_turns );
                     g->m.add_item( loc, std::move( tmp ) );
-                    i->charges--;
+                    i->set_charges( i->charges() - 1 );
                 }
                 break;
             }
@@ -1615,6 +1615,7 @@ void vehicle::open_or_close( const int part_index, const bool opening )
     //find_lines_of_parts() doesn't return the part_index we passed, so we set it on it's own
     parts[part_index].open = opening;
     insides_dirty = true;
+    invalidate_footprint();
     map &here = get_map();
     here.set_transparency_cache_dirty( sm_pos.z );
     const tripoint part_location = mount_to_tripoint( parts[part_index].mount );
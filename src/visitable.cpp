@@ -651,6 +651,7 @@ void item_contents::remove_items_with( const std::function < VisitResponse(
         detached_ptr<item> && ) > &filter )
 {
     visit_internal( filter, items );
+    on_changed();
 }
 
 /** @relates visitable */
@@ -970,7 +971,7 @@ static int charges_of_internal( const T &self, const M &main, const itype_id &id
 
             } else if( e->count_by_charges() ) {
                 if( e->typeId() == id ) {
-                    qty = sum_no_wrap( qty, e->charges );
+                    qty = sum_no_wrap( qty, e->charges() );
                 }
                 // items counted by charges are not themselves expected to be containers
                 return qty < limit ? VisitResponse::SKIP : VisitResponse::ABORT;
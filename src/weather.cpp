@@ -226,15 +226,15 @@ void item::add_rain_to_container( bool acid, int charges )
             // Funnels aren't always clean enough for water. // TODO: disinfectant squeegie->funnel
             ret->poison = one_in( 10 ) ? 1 : 0;
         }
-        ret->charges = std::min( charges, capa );
+        ret->set_charges( std::min( charges, capa ) );
         put_in( std::move( ret ) );
     } else {
         // The container already has a liquid.
         item &liq = contents.front();
-        int orig = liq.charges;
+        int orig = liq.charges();
         int added = std::min( charges, capa );
         if( capa > 0 ) {
-            liq.charges += added;
+            liq.set_charges( liq.charges() + added );
         }
 
         if( liq.typeId() == ret->typeId() || liq.typeId() == itype_water_acid_weak ) {
@@ -249,8 +249,8 @@ void item::add_rain_to_container( bool acid, int charges )
             // charges of water, the liquid will now be 1/8th acid or,
             // equivalently, 1/4th weak acid (the rest being water). A
             // stochastic approach gives the liquid a 1 in 4 (or 2 in
-            // liquid.charges) chance of becoming weak acid.
-            const bool transmute = x_in_y( 2 * added, liq.charges );
+            // liquid.charges()) chance of becoming weak acid.
+            const bool transmute = x_in_y( 2 * added, liq.charges() );
 
             if( transmute ) {
                 contents.front().convert( itype_water_acid_weak );
@@ -259,9 +259,9 @@ void item::add_rain_to_container( bool acid, int charges )
                 // into weak acid. Poison the water instead, assuming 1
                 // charge of acid would act like a charge of water with poison 5.
                 int total_poison = liq.poison * orig + 5 * added;
-                liq.poison = total_poison / liq.charges;
-                int leftover_poison = total_poison - liq.poison * liq.charges;
-                if( leftover_poison > rng( 0, liq.charges ) ) {
+                liq.poison = total_poison / liq.charges();
+                int leftover_poison = total_poison - liq.poison * liq.charges();
+                if( leftover_poison > rng( 0, liq.charges() ) ) {
                     liq.poison++;
                 }
             }
@@ -286,7 +286,7 @@ double funnel_charges_per_turn( const double surface_area_mm2, const double rain
     item &water = *item::spawn_temporary( itype_water, calendar::start_of_cataclysm );
     // 250ml
     static const double charge_ml = static_cast<double>( to_gram( water.weight() ) ) /
-                                    water.charges;
+                                    water.charges();
 
     const double vol_mm3_per_hour = surface_area_mm2 * rain_depth_mm_per_hour;
     const double vol_mm3_per_turn = vol_mm3_per_hour / to_turns<int>( 1_hours );
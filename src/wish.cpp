@@ -718,7 +718,9 @@ void debug_menu::wishitem( player *p, const tripoint &pos )
                 granted = item::in_its_container( std::move( granted ) );
             }
             if( cb.has_flag ) {
+                // Not set_flag, the debug menu may add flags that aren't defined in json
                 granted->item_tags.insert( flag_id( cb.flag ) );
+                granted->invalidate_caches();
             }
             // If the item has an ammunition, this loads it to capacity, including magazines.
             if( !granted->ammo_default().is_null() ) {
@@ -751,7 +753,7 @@ void debug_menu::wishitem( player *p, const tripoint &pos )
                 if( p != nullptr ) {
                     if( granted->count_by_charges() ) {
                         if( amount > 0 ) {
-                            granted->charges = amount;
+                            granted->set_charges( amount );
                             p->i_add_or_drop( item::spawn( *granted ) );
                         }
                     } else {
@@ -11,6 +11,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "async_file_writer.h"
 #include "cata_utility.h"
 #include "catacharset.h"
 #include "catalua.h"
@@ -225,6 +226,8 @@ WORLDPTR worldfactory::make_new_world( special_game_type special_type )
 
 void worldfactory::set_active_world( WORLDPTR world )
 {
+    // Files of the previous world may still be being written
+    get_async_file_writer().wait();
     world_generator->active_world = world;
     if( world ) {
         get_options().set_world_options( &world->WORLD_OPTIONS );
@@ -1729,6 +1732,8 @@ static bool isForbidden( const std::string &candidate )
 
 void worldfactory::delete_world( const std::string &worldname, const bool delete_folder )
 {
+    // Otherwise files still being written would show up again after the world is gone
+    get_async_file_writer().wait();
     std::string worldpath = get_world( worldname )->folder_path();
     std::set<std::string> directory_paths;
 
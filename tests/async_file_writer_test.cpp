@@ -0,0 +1,55 @@
+#include "catch/catch.hpp"
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include "async_file_writer.h"
+#include "cata_utility.h"
+#include "filesystem.h"
+#include "fstream_utils.h"
+#include "game.h"
+
+TEST_CASE( "async_file_writer_writes_snapshot", "[filesystem]" )
+{
+    const std::string base = g->get_world_base_save_path() + "/async_test_" + get_pid_string() + "/";
+    REQUIRE( assure_dir_exist( base ) );
+    const std::string path = base + "data.txt";
+    REQUIRE( write_to_file( path, []( std::ostream & out ) {
+        out << "old";
+    }, nullptr ) );
+
+    async_file_writer &writer = get_async_file_writer();
+    std::string value = "new";
+    writer.begin_capture();
+    // A failed check mustn't leave the writer capturing the files of later tests
+    on_out_of_scope end_capture( [&]() {
+        if( writer.capturing() ) {
+            writer.end_capture();
+        }
+        writer.wait();
+    } );
+    REQUIRE( write_to_file( path, [&]( std::ostream & out ) {
+        out << value;
+    }, nullptr ) );
+    // Only captured so far, the old file is still there
+    std::string content;
+    REQUIRE( read_from_file( path, [&]( std::istream & in ) {
+        in >> content;
+    } ) );
+    CHECK( content == "old" );
+    writer.end_capture();
+
+    // Changes after the capture aren't in the snapshot
+    value = "changed";
+    // Reading waits for the writer
+    REQUIRE( read_from_file( path, [&]( std::istream & in ) {
+        in >> content;
+    } ) );
+    CHECK( content == "new" );
+
+    writer.wait();
+    CHECK( writer.finished() );
+    CHECK( remove_file( path ) );
+    CHECK( remove_directory( base ) );
+}
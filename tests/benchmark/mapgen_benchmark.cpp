@@ -0,0 +1,178 @@
+#include "catch/catch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "calendar.h"
+#include "cata_utility.h"
+#include "coordinates.h"
+#include "fstream_utils.h"
+#include "game_constants.h"
+#include "map.h"
+#include "mapgen.h"
+#include "omdata.h"
+#include "overmapbuffer.h"
+#include "rng.h"
+#include "state_helpers.h"
+#include "string_formatter.h"
+#include "submap.h"
+
+// Allocations are counted by replacing the global allocation functions.  That's why this
+// is built as its own binary, cata_mapgen_benchmark, instead of being part of cata_test.
+static std::atomic<std::uint64_t> allocation_count{ 0 };
+
+void *operator new( std::size_t size )
+{
+    allocation_count.fetch_add( 1, std::memory_order_relaxed );
+    // NOLINTNEXTLINE(cata-no-malloc)
+    if( void *p = std::malloc( size == 0 ? 1 : size ) ) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete( void *p ) noexcept
+{
+    // NOLINTNEXTLINE(cata-no-malloc)
+    std::free( p );
+}
+
+void operator delete( void *p, std::size_t ) noexcept
+{
+    // NOLINTNEXTLINE(cata-no-malloc)
+    std::free( p );
+}
+
+namespace
+{
+
+struct mapgen_benchmark_result {
+    std::string oter;
+    int runs = 0;
+    std::chrono::microseconds total_time{ 0 };
+    std::chrono::microseconds max_time{ 0 };
+    std::uint64_t allocations = 0;
+    int items = 0;
+    int monsters = 0;
+    int vehicles = 0;
+    int nested_chunks = 0;
+    int max_nested_depth = 0;
+};
+
+} // namespace
+
+static std::string env_or( const char *name, const std::string &fallback )
+{
+    const char *value = std::getenv( name );
+    return value != nullptr && *value != '\0' ? value : fallback;
+}
+
+static void count_contents( const submap &sm, mapgen_benchmark_result &result )
+{
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            result.items += sm.get_items( point( x, y ) ).size();
+        }
+    }
+    for( const spawn_point &spawn : sm.spawns ) {
+        result.monsters += spawn.count;
+    }
+    result.vehicles += sm.vehicles.size();
+}
+
+/**
+ * Generates the overmap terrain of every mapgen id a few times with fixed seeds and
+ * writes the average time, allocations, spawned items, monsters and vehicles and the
+ * nested mapgen use of each to a CSV file.
+ *
+ * Run with the mapgen_benchmark (CMake) or mapgen-benchmark (make) build target.
+ * Environment variables:
+ * - CATA_MAPGEN_BENCHMARK_FILTER: only mapgen ids containing this text
+ * - CATA_MAPGEN_BENCHMARK_RUNS: generations per mapgen id, 5 by default
+ * - CATA_MAPGEN_BENCHMARK_OUTPUT: output file, mapgen_benchmark.csv by default
+ */
+TEST_CASE( "mapgen_benchmark", "[mapgen_benchmark]" )
+{
+    clear_all_state();
+    restore_on_out_of_scope<bool> restore_disable_mapgen( disable_mapgen );
+    disable_mapgen = false;
+
+    const std::string filter = env_or( "CATA_MAPGEN_BENCHMARK_FILTER", "" );
+    const int runs = std::max( 1, std::atoi( env_or( "CATA_MAPGEN_BENCHMARK_RUNS", "5" ).c_str() ) );
+    const std::string output = env_or( "CATA_MAPGEN_BENCHMARK_OUTPUT", "mapgen_benchmark.csv" );
+
+    // Rotations of a terrain share its mapgen, so one terrain per mapgen id is enough
+    std::map<std::string, oter_id> targets;
+    for( const oter_t &ter : overmap_terrains::get_all() ) {
+        const std::string mapgen_id = ter.get_mapgen_id();
+        if( !has_mapgen_for( mapgen_id ) ||
+            ( !filter.empty() && mapgen_id.find( filter ) == std::string::npos ) ) {
+            continue;
+        }
+        targets.emplace( mapgen_id, ter.id.id() );
+    }
+    REQUIRE( !targets.empty() );
+
+    // Away from the reality bubble, so nothing there refers to the generated submaps
+    const tripoint_abs_omt where( 140, 140, 0 );
+    const oter_id original_ter = overmap_buffer.ter( where );
+
+    std::map<std::string, mapgen_benchmark_result> results;
+    for( const std::pair<const std::string, oter_id> &target : targets ) {
+        overmap_buffer.ter_set( where, target.second );
+        mapgen_benchmark_result &result = results[target.first];
+        result.oter = target.second.id().str();
+        for( int run = 0; run < runs; run++ ) {
+            rng_set_engine_seed( 1000 + run );
+            get_mapgen_counters() = mapgen_counters();
+            std::vector<std::unique_ptr<submap>> submaps;
+            tinymap tmp_map;
+
+            const std::uint64_t allocations_before = allocation_count.load();
+            const auto start = std::chrono::steady_clock::now();
+            tmp_map.generate( project_to<coords::sm>( where ).raw(), calendar::turn, &submaps );
+            const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                                  std::chrono::steady_clock::now() - start );
+
+            result.runs++;
+            result.total_time += time;
+            result.max_time = std::max( result.max_time, time );
+            result.allocations += allocation_count.load() - allocations_before;
+            result.nested_chunks += get_mapgen_counters().nested_chunks;
+            result.max_nested_depth = std::max( result.max_nested_depth,
+                                                get_mapgen_counters().max_nested_depth );
+            for( const std::unique_ptr<submap> &sm : submaps ) {
+                count_contents( *sm, result );
+            }
+        }
+    }
+    overmap_buffer.ter_set( where, original_ter );
+
+    write_to_file( output, [&]( std::ostream & out ) {
+        out << "mapgen_id,oter,runs,mean_us,max_us,allocations,items,monsters,vehicles,"
+            "nested_chunks,max_nested_depth\n";
+        for( const std::pair<const std::string, mapgen_benchmark_result> &e : results ) {
+            const mapgen_benchmark_result &r = e.second;
+            out << string_format( "%s,%s,%d,%.1f,%d,%.1f,%.1f,%.1f,%.1f,%.1f,%d\n",
+                                  e.first, r.oter, r.runs,
+                                  static_cast<double>( r.total_time.count() ) / r.runs,
+                                  static_cast<int>( r.max_time.count() ),
+                                  static_cast<double>( r.allocations ) / r.runs,
+                                  static_cast<double>( r.items ) / r.runs,
+                                  static_cast<double>( r.monsters ) / r.runs,
+                                  static_cast<double>( r.vehicles ) / r.runs,
+                                  static_cast<double>( r.nested_chunks ) / r.runs,
+                                  r.max_nested_depth );
+        }
+    } );
+    cata_printf( "Mapgen benchmark of %d mapgen ids written to %s\n", results.size(), output );
+}
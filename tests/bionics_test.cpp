@@ -31,12 +31,12 @@ static void test_consumable_charges( player &p, std::string &itemname, bool when
     INFO( "\'" + it.tname() + "\' is count-by-charges" );
     CHECK( it.count_by_charges() );
 
-    it.charges = 0;
-    INFO( "consume \'" + it.tname() + "\' with " + std::to_string( it.charges ) + " charges" );
+    it.set_charges( 0 );
+    INFO( "consume \'" + it.tname() + "\' with " + std::to_string( it.charges() ) + " charges" );
     REQUIRE( p.can_consume( it ) == when_none );
 
-    it.charges = INT_MAX;
-    INFO( "consume \'" + it.tname() + "\' with " + std::to_string( it.charges ) + " charges" );
+    it.set_charges( INT_MAX );
+    INFO( "consume \'" + it.tname() + "\' with " + std::to_string( it.charges() ) + " charges" );
     REQUIRE( p.can_consume( it ) == when_max );
 }
 
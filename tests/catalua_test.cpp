@@ -3,7 +3,9 @@
 
 #include "avatar.h"
 #include "catacharset.h"
+#include "catalua.h"
 #include "catalua_impl.h"
+#include "catalua_profiler.h"
 #include "catalua_serde.h"
 #include "catalua_sol.h"
 #include "clzones.h"
@@ -13,8 +15,10 @@
 #include "json.h"
 #include "mapdata.h"
 #include "options.h"
+#include "options_helpers.h"
 #include "point.h"
 #include "string_formatter.h"
+#include "string_utils.h"
 #include "stringmaker.h"
 #include "type_id.h"
 #include "units_angle.h"
@@ -770,4 +774,113 @@ TEST_CASE( "lua_units_functions", "[lua]" )
     REQUIRE( lua_volume_milliliters == units::to_milliliter( units::from_liter( volume_liters ) ) );
 }
 
+TEST_CASE( "lua_profiler_attributes_stacks_to_mods", "[lua]" )
+{
+    cata::lua_state state{ make_lua_state() };
+    state.lua.script( R"(
+        function inner()
+            local t = {}
+            for i = 1, 1000 do t[i] = tostring( i ) end
+            return #t
+        end
+        function outer()
+            local n = inner()
+            return n
+        end
+    )" );
+    sol::protected_function outer = state.lua["outer"];
+
+    cata::lua_profiler &profiler = cata::get_lua_profiler();
+    profiler.reset();
+    profiler.start( state );
+    {
+        cata::lua_call_scope scope( mod_id( "test_mod" ) );
+        REQUIRE( scope.allowed() );
+        sol::protected_function_result res = outer();
+        check_func_result( res );
+    }
+    profiler.stop();
+
+    const auto &mods = profiler.get_mod_usage();
+    REQUIRE( mods.count( mod_id( "test_mod" ) ) == 1 );
+    const cata::lua_profiler::mod_usage &usage = mods.at( mod_id( "test_mod" ) );
+    CHECK( usage.calls == 1 );
+    CHECK( usage.alloc_bytes > 0 );
+
+    // Stacks start at the mod, then go through outer and inner
+    bool found_inner = false;
+    for( const auto &e : profiler.get_stack_usage() ) {
+        CHECK( string_starts_with( e.first, "test_mod" ) );
+        const std::string leaf = e.first.substr( e.first.rfind( ';' ) + 1 );
+        if( e.first.find( "outer" ) != std::string::npos &&
+            leaf.find( "inner" ) != std::string::npos ) {
+            found_inner = true;
+            CHECK( e.second.calls == 1 );
+            CHECK( e.second.alloc_bytes > 0 );
+        }
+    }
+    CHECK( found_inner );
+    profiler.reset();
+}
+
+TEST_CASE( "lua_budget_throttles_mods_for_the_rest_of_the_turn", "[lua]" )
+{
+    override_option budget( "LUA_TURN_BUDGET", "1" );
+    override_option action( "LUA_BUDGET_ACTION", "throttle" );
+    cata::lua_state state{ make_lua_state() };
+    state.lua.script( "function slow() local x = 0 for i = 1, 100000 do x = x + i end return x end" );
+    sol::protected_function slow = state.lua["slow"];
+
+    cata::lua_profiler &profiler = cata::get_lua_profiler();
+    profiler.reset();
+    {
+        cata::lua_call_scope scope( mod_id( "slow_mod" ) );
+        REQUIRE( scope.allowed() );
+        sol::protected_function_result res = slow();
+        check_func_result( res );
+    }
+    {
+        cata::lua_call_scope scope( mod_id( "slow_mod" ), cata::lua_call_kind::periodic );
+        CHECK_FALSE( scope.allowed() );
+    }
+    {
+        // Save, load, mapgen and item use hooks are never skipped
+        cata::lua_call_scope scope( mod_id( "slow_mod" ) );
+        CHECK( scope.allowed() );
+    }
+    {
+        cata::lua_call_scope scope( mod_id( "other_mod" ), cata::lua_call_kind::periodic );
+        CHECK( scope.allowed() );
+    }
+    const cata::lua_profiler::mod_usage &usage = profiler.get_mod_usage().at( mod_id( "slow_mod" ) );
+    CHECK( usage.turns_over_budget == 1 );
+    CHECK( usage.throttled_calls == 1 );
+    profiler.reset();
+}
+
+TEST_CASE( "lua_hooks_changed_while_running", "[lua]" )
+{
+    std::unique_ptr<cata::lua_state, cata::lua_state_deleter> state = cata::make_wrapped_state();
+    cata::init_global_state_tables( *state, {} );
+    state->lua.script( R"(
+        calls = 0
+        local hooks = game.hooks.on_game_save
+        hooks[#hooks + 1] = function()
+            calls = calls + 1
+            hooks[#hooks + 1] = function() calls = calls + 10 end
+        end
+    )" );
+
+    // Hooks added by a running hook are called from the next run on
+    cata::run_on_game_save_hooks( *state );
+    CHECK( state->lua.get<int>( "calls" ) == 1 );
+    cata::run_on_game_save_hooks( *state );
+    CHECK( state->lua.get<int>( "calls" ) == 12 );
+
+    // Replacing a hook doesn't change the length of the table
+    state->lua.script( "calls = 0 game.hooks.on_game_save[1] = function() calls = calls + 100 end" );
+    cata::run_on_game_save_hooks( *state );
+    CHECK( state->lua.get<int>( "calls" ) == 120 );
+}
+
 #endif
@@ -93,7 +93,7 @@ static int byproduct_calories( const recipe &recipe_obj )
     int kcal = 0;
     for( detached_ptr<item> &it : byproducts ) {
         if( it->is_comestible() ) {
-            kcal += it->type->comestible->default_nutrition.kcal * it->charges;
+            kcal += it->type->comestible->default_nutrition.kcal * it->charges();
         }
     }
     return kcal;
@@ -147,8 +147,8 @@ TEST_CASE( "recipe_permutations", "[recipe]" )
         if( res_it.type->comestible ) {
             default_calories = res_it.type->comestible->default_nutrition.kcal;
         }
-        if( res_it.charges > 0 ) {
-            default_calories *= res_it.charges;
+        if( res_it.charges() > 0 ) {
+            default_calories *= res_it.charges();
         }
 
         const bool is_drink = res->type->comestible && res->type->comestible->comesttype == "DRINK";
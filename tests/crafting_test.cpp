@@ -536,7 +536,7 @@ static void verify_inventory( const std::vector<std::string> &has,
     std::ostringstream os;
     os << "Inventory:\n";
     for( const item *i : g->u.inv_dump() ) {
-        os << "  " << i->typeId().str() << " (" << i->charges << ")\n";
+        os << "  " << i->typeId().str() << " (" << i->charges() << ")\n";
     }
     os << "Wielded:\n" << g->u.primary_weapon().tname() << "\n";
     INFO( os.str() );
@@ -7,6 +7,7 @@
 #include "calendar.h"
 #include "cata_variant.h"
 #include "character_id.h"
+#include "enum_bitset.h"
 #include "event.h"
 #include "event_bus.h"
 #include "string_id.h"
@@ -58,3 +59,101 @@ TEST_CASE( "destroy_bus_before_subscriber", "[event]" )
                   character_id( 5 ), mtype_id( "zombie" ) ) );
     CHECK( sub.events.size() == 1 );
 }
+
+TEST_CASE( "typed_event_round_trip", "[event]" )
+{
+    using kills_monster = cata::typed_event<event_type::character_kills_monster>;
+    const kills_monster e( calendar::turn, character_id( 7 ), mtype_id( "zombie" ) );
+    CHECK( e.get<kills_monster::field( "killer" )>() == character_id( 7 ) );
+    CHECK( e.get<kills_monster::field( "victim_type" )>() == mtype_id( "zombie" ) );
+
+    const cata::event generic = e.to_event();
+    CHECK( generic.type() == event_type::character_kills_monster );
+    CHECK( generic.get<character_id>( "killer" ) == character_id( 7 ) );
+    CHECK( generic.get<mtype_id>( "victim_type" ) == mtype_id( "zombie" ) );
+
+    const kills_monster back = kills_monster::from_event( generic );
+    CHECK( back.payload() == e.payload() );
+}
+
+struct typed_test_subscriber : public event_subscriber {
+    enum_bitset<event_type> notified_types() const override {
+        return enum_bitset<event_type>().set( event_type::game_start );
+    }
+    void notify( const cata::event &e ) override {
+        events.push_back( e );
+    }
+    void listen_to( event_bus &bus ) override {
+        using kills_monster = cata::typed_event<event_type::character_kills_monster>;
+        bus.listen<event_type::character_kills_monster>( this, [this]( const kills_monster & e ) {
+            victims.push_back( e.get<kills_monster::field( "victim_type" )>() );
+        } );
+    }
+
+    std::vector<cata::event> events;
+    std::vector<mtype_id> victims;
+};
+
+TEST_CASE( "send_typed_event_through_bus", "[event]" )
+{
+    event_bus bus;
+    typed_test_subscriber sub;
+    bus.subscribe( &sub );
+
+    bus.send<event_type::character_kills_monster>( character_id( 5 ), mtype_id( "zombie" ) );
+    bus.send( cata::event::make<event_type::character_kills_monster>(
+                  character_id( 5 ), mtype_id( "mon_dog" ) ) );
+    bus.send<event_type::character_wakes_up>( character_id( 5 ) );
+    bus.send<event_type::game_start>( character_id( 5 ) );
+
+    CHECK( sub.victims == std::vector<mtype_id> { mtype_id( "zombie" ), mtype_id( "mon_dog" ) } );
+    REQUIRE( sub.events.size() == 1 );
+    CHECK( sub.events[0].type() == event_type::game_start );
+
+    bus.unsubscribe( &sub );
+    bus.send<event_type::character_kills_monster>( character_id( 5 ), mtype_id( "zombie" ) );
+    CHECK( sub.victims.size() == 2 );
+}
+
+struct ordered_test_subscriber : public event_subscriber {
+    ordered_test_subscriber( std::vector<std::string> &log, const std::string &name, bool typed )
+        : log( log ), name( name ), typed( typed ) {}
+
+    enum_bitset<event_type> notified_types() const override {
+        return typed ? enum_bitset<event_type>() : enum_bitset<event_type>().set_all();
+    }
+    void notify( const cata::event & ) override {
+        log.push_back( name );
+    }
+    void listen_to( event_bus &bus ) override {
+        if( typed ) {
+            using wakes_up = cata::typed_event<event_type::character_wakes_up>;
+            bus.listen<event_type::character_wakes_up>( this, [this]( const wakes_up & ) {
+                log.push_back( name );
+            } );
+        }
+    }
+
+    std::vector<std::string> &log;
+    std::string name;
+    bool typed;
+};
+
+TEST_CASE( "bus_notifies_in_subscription_order", "[event]" )
+{
+    std::vector<std::string> log;
+    event_bus bus;
+    ordered_test_subscriber first( log, "first", false );
+    ordered_test_subscriber second( log, "second", true );
+    ordered_test_subscriber third( log, "third", false );
+    bus.subscribe( &first );
+    bus.subscribe( &second );
+    bus.subscribe( &third );
+
+    const std::vector<std::string> expected{ "first", "second", "third" };
+    bus.send<event_type::character_wakes_up>( character_id( 5 ) );
+    CHECK( log == expected );
+    log.clear();
+    bus.send( cata::event::make<event_type::character_wakes_up>( character_id( 5 ) ) );
+    CHECK( log == expected );
+}
@@ -38,7 +38,7 @@ namespace
 void set_off_explosion( item &explosive, const tripoint &origin )
 {
     explosion_handler::get_explosion_queue().clear();
-    explosive.charges = 0;
+    explosive.set_charges( 0 );
     explosive.type->invoke( g->u, explosive, origin );
     explosion_handler::get_explosion_queue().execute();
 }
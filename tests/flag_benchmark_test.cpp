@@ -0,0 +1,130 @@
+#include "catch/catch.hpp"
+
+#include <string>
+#include <vector>
+
+#include "flag.h"
+#include "item.h"
+#include "item_factory.h"
+#include "itype.h"
+#include "mapdata.h"
+
+// Compares flag lookups through the flag bitsets with the tree lookups they replaced.
+// Run with `cata_test "[flag][benchmark]"`.
+
+static const std::vector<flag_id> &benchmark_flags()
+{
+    static const std::vector<flag_id> flags = {
+        flag_id( "VARSIZE" ), flag_id( "WATERPROOF" ), flag_id( "FIRESTARTER" ),
+        flag_id( "NO_UNLOAD" ), flag_id( "DIAMOND" ), flag_id( "UNARMED_WEAPON" )
+    };
+    return flags;
+}
+
+TEST_CASE( "itype_flag_benchmark", "[.][item][flag][benchmark]" )
+{
+    const std::vector<const itype *> types = item_controller->all();
+    const std::vector<flag_id> &flags = benchmark_flags();
+
+    int by_set = 0;
+    int by_bits = 0;
+    for( const itype *t : types ) {
+        for( const flag_id &f : flags ) {
+            by_set += t->get_flags().count( f );
+            by_bits += t->has_flag( f );
+        }
+    }
+    CHECK( by_set == by_bits );
+
+    BENCHMARK( "filter item types, std::set" ) {
+        int found = 0;
+        for( const itype *t : types ) {
+            for( const flag_id &f : flags ) {
+                found += t->get_flags().count( f );
+            }
+        }
+        return found;
+    };
+    BENCHMARK( "filter item types, bitset" ) {
+        int found = 0;
+        for( const itype *t : types ) {
+            for( const flag_id &f : flags ) {
+                found += t->has_flag( f );
+            }
+        }
+        return found;
+    };
+}
+
+TEST_CASE( "item_flag_benchmark", "[.][item][flag][benchmark]" )
+{
+    item &gun = *item::spawn_temporary( "win70" );
+    gun.put_in( item::spawn( "shoulder_strap" ) );
+    const std::vector<flag_id> &flags = benchmark_flags();
+
+    BENCHMARK( "item with gunmod, has_flag" ) {
+        int found = 0;
+        for( const flag_id &f : flags ) {
+            found += gun.has_flag( f );
+        }
+        return found;
+    };
+}
+
+TEST_CASE( "terrain_flag_benchmark", "[.][map][flag][benchmark]" )
+{
+    const std::vector<ter_t> &terrain = ter_t::get_all();
+    const std::vector<furn_t> &furniture = furn_t::get_all();
+    const std::vector<std::string> names = {
+        "BURROWABLE", "PLOWABLE", "MOUNTABLE", "DOOR", "LADDER", "EASY_DECONSTRUCT"
+    };
+    std::vector<ter_furn_flag> flags;
+    for( const std::string &name : names ) {
+        flags.emplace_back( name );
+    }
+
+    int by_set = 0;
+    int by_bits = 0;
+    for( const ter_t &t : terrain ) {
+        for( size_t i = 0; i < names.size(); i++ ) {
+            by_set += t.has_flag( names[i] );
+            by_bits += t.has_flag( flags[i] );
+        }
+    }
+    for( const furn_t &f : furniture ) {
+        for( size_t i = 0; i < names.size(); i++ ) {
+            by_set += f.has_flag( names[i] );
+            by_bits += f.has_flag( flags[i] );
+        }
+    }
+    CHECK( by_set == by_bits );
+
+    BENCHMARK( "terrain and furniture flags, std::set" ) {
+        int found = 0;
+        for( const ter_t &t : terrain ) {
+            for( const std::string &name : names ) {
+                found += t.has_flag( name );
+            }
+        }
+        for( const furn_t &f : furniture ) {
+            for( const std::string &name : names ) {
+                found += f.has_flag( name );
+            }
+        }
+        return found;
+    };
+    BENCHMARK( "terrain and furniture flags, bitset" ) {
+        int found = 0;
+        for( const ter_t &t : terrain ) {
+            for( const ter_furn_flag &f : flags ) {
+                found += t.has_flag( f );
+            }
+        }
+        for( const furn_t &f : furniture ) {
+            for( const ter_furn_flag &flag : flags ) {
+                found += f.has_flag( flag );
+            }
+        }
+        return found;
+    };
+}
@@ -69,7 +69,7 @@ TEST_CASE( "explosion_on_ground", "[.]" )
 
     const tripoint area_center( area_dim / 2, area_dim / 2, 0 );
     item &rdx_keg = *item::spawn_temporary( rdx_keg_typeid );
-    rdx_keg.charges = 0;
+    rdx_keg.set_charges( 0 );
     rdx_keg.type->invoke( get_avatar(), rdx_keg, area_center );
 
     // Check area to see if any t_flat_roof is present.
@@ -116,7 +116,7 @@ TEST_CASE( "explosion_on_floor_with_rock_floor_basement", "[.]" )
 
     const tripoint area_center( area_dim / 2, area_dim / 2, 0 );
     item &rdx_keg = *item::spawn_temporary( rdx_keg_typeid );
-    rdx_keg.charges = 0;
+    rdx_keg.set_charges( 0 );
     rdx_keg.type->invoke( get_avatar(), rdx_keg, area_center );
 
     // Check z0 for open air
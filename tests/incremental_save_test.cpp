@@ -0,0 +1,115 @@
+#include "catch/catch.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cata_utility.h"
+#include "coordinate_conversions.h"
+#include "filesystem.h"
+#include "game.h"
+#include "game_constants.h"
+#include "map.h"
+#include "mapbuffer.h"
+#include "overmap.h"
+#include "overmapbuffer.h"
+#include "point.h"
+#include "state_helpers.h"
+#include "string_formatter.h"
+#include "submap.h"
+#include "type_id.h"
+
+static std::string quad_path( const tripoint &omt )
+{
+    const tripoint segment = omt_to_seg_copy( omt );
+    return string_format( "%s/maps/%d.%d.%d/%d.%d.%d.map", g->get_world_base_save_path(),
+                          segment.x, segment.y, segment.z, omt.x, omt.y, omt.z );
+}
+
+static void add_quad( const tripoint &omt )
+{
+    static const ter_str_id t_dirt( "t_dirt" );
+    for( const point &offset : {
+             point_zero, point_south, point_east, point_south_east
+         } ) {
+        const tripoint sm_pos = omt_to_sm_copy( omt ) + offset;
+        std::unique_ptr<submap> sm = std::make_unique<submap>( sm_to_ms_copy( sm_pos ) );
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                sm->set_ter( point( x, y ), t_dirt.id() );
+            }
+        }
+        REQUIRE( MAPBUFFER.add_submap( sm_pos, sm ) );
+    }
+}
+
+TEST_CASE( "saving_skips_unchanged_submap_quads", "[mapbuffer]" )
+{
+    clear_all_state();
+    // Saving is skipped entirely while mapgen is disabled
+    restore_on_out_of_scope<bool> restore_disable_mapgen( disable_mapgen );
+    disable_mapgen = false;
+
+    const std::string maps_dir = g->get_world_base_save_path() + "/maps";
+    const std::vector<std::string> files_before = get_files_from_path( ".map", maps_dir, true, true );
+
+    // Away from the reality bubble, so the save drops them from MAPBUFFER
+    const tripoint changed_omt = sm_to_omt_copy( get_map().get_abs_sub() ) + tripoint( 30, 0, 0 );
+    const tripoint unchanged_omt = changed_omt + tripoint( 2, 0, 0 );
+    add_quad( changed_omt );
+    add_quad( unchanged_omt );
+    MAPBUFFER.save();
+    REQUIRE( file_exist( quad_path( changed_omt ) ) );
+    REQUIRE( file_exist( quad_path( unchanged_omt ) ) );
+    REQUIRE( !MAPBUFFER.is_submap_loaded( omt_to_sm_copy( unchanged_omt ) ) );
+
+    // Loaded again, but only changed through a map
+    REQUIRE( MAPBUFFER.lookup_submap( omt_to_sm_copy( unchanged_omt ) ) != nullptr );
+    {
+        tinymap tm;
+        tm.load( omt_to_sm_copy( changed_omt ), false );
+        tm.ter_set( tripoint_zero, ter_str_id( "t_grass" ).id() );
+    }
+    // Whatever is written now shows up again
+    REQUIRE( remove_file( quad_path( changed_omt ) ) );
+    REQUIRE( remove_file( quad_path( unchanged_omt ) ) );
+    MAPBUFFER.save();
+    CHECK( file_exist( quad_path( changed_omt ) ) );
+    CHECK( !file_exist( quad_path( unchanged_omt ) ) );
+
+    for( const std::string &file : get_files_from_path( ".map", maps_dir, true, true ) ) {
+        if( std::find( files_before.begin(), files_before.end(), file ) == files_before.end() ) {
+            remove_file( file );
+        }
+    }
+}
+
+TEST_CASE( "saving_skips_unchanged_overmap_files", "[overmap]" )
+{
+    clear_all_state();
+    overmap om( point_abs_om( 40, 40 ) );
+    const std::string terrain_file = overmapbuffer::terrain_filename( om.pos() );
+    const std::string view_file = overmapbuffer::player_filename( om.pos() );
+
+    // Never written before
+    om.save();
+    REQUIRE( remove_file( terrain_file ) );
+    REQUIRE( remove_file( view_file ) );
+
+    om.save();
+    CHECK( !file_exist( terrain_file ) );
+    CHECK( !file_exist( view_file ) );
+
+    om.set_seen( { 10, 10, 0 }, true );
+    om.save();
+    CHECK( !file_exist( terrain_file ) );
+    CHECK( file_exist( view_file ) );
+    remove_file( view_file );
+
+    om.ter_set( { 10, 10, 0 }, oter_id( "forest" ) );
+    om.save();
+    CHECK( file_exist( terrain_file ) );
+    CHECK( !file_exist( view_file ) );
+    remove_file( terrain_file );
+}
@@ -80,7 +80,7 @@ TEST_CASE( "item_modifier modifies charges for item", "[item_group]" )
         REQUIRE( subject->is_ammo() );
         REQUIRE( subject->count_by_charges() );
         REQUIRE( subject->count() == default_charges );
-        REQUIRE( subject->charges == default_charges );
+        REQUIRE( subject->charges() == default_charges );
 
         AND_GIVEN( "a modifier that does not modify charges" ) {
             Item_modifier modifier;
@@ -89,7 +89,7 @@ TEST_CASE( "item_modifier modifies charges for item", "[item_group]" )
                 subject = modifier.modify( std::move( subject ) );
 
                 THEN( "charges should be unchanged" ) {
-                    CHECK( subject->charges == default_charges );
+                    CHECK( subject->charges() == default_charges );
                 }
             }
         }
@@ -104,7 +104,7 @@ TEST_CASE( "item_modifier modifies charges for item", "[item_group]" )
                 subject = modifier.modify( std::move( subject ) );
 
                 THEN( "charges are set to 1" ) {
-                    CHECK( subject->charges == 1 );
+                    CHECK( subject->charges() == 1 );
                 }
             }
         }
@@ -119,7 +119,7 @@ TEST_CASE( "item_modifier modifies charges for item", "[item_group]" )
                 subject = modifier.modify( std::move( subject ) );
 
                 THEN( "charges should be unchanged" ) {
-                    CHECK( subject->charges == default_charges );
+                    CHECK( subject->charges() == default_charges );
                 }
             }
         }
@@ -138,7 +138,7 @@ TEST_CASE( "item_modifier modifies charges for item", "[item_group]" )
                 results.reserve( 100 );
                 for( int i = 0; i < 100; i++ ) {
                     subject = modifier.modify( std::move( subject ) );
-                    results.emplace_back( subject->charges );
+                    results.emplace_back( subject->charges() );
                 }
 
                 THEN( "charges are set to the expected range of values" ) {
@@ -164,7 +164,7 @@ TEST_CASE( "item_modifier modifies charges for item", "[item_group]" )
                 results.reserve( 100 );
                 for( int i = 0; i < 100; i++ ) {
                     subject = modifier.modify( std::move( subject ) );
-                    results.emplace_back( subject->charges );
+                    results.emplace_back( subject->charges() );
                 }
 
                 THEN( "charges are set to the expected value" ) {
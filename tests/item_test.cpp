@@ -6,6 +6,7 @@
 
 #include "calendar.h"
 #include "enums.h"
+#include "flag.h"
 #include "item.h"
 #include "itype.h"
 #include "ret_val.h"
@@ -28,9 +29,9 @@ TEST_CASE( "item_volume", "[item]" )
          } ) {
         INFO( "checking batteries that fit in " << v );
         const int charges_that_should_fit = i.charges_per_volume( v );
-        i.charges = charges_that_should_fit;
+        i.set_charges( charges_that_should_fit );
         CHECK( i.volume() <= v ); // this many charges should fit
-        i.charges++;
+        i.set_charges( i.charges() + 1 );
         CHECK( i.volume() > v ); // one more charge should not fit
     }
 }
@@ -53,6 +54,60 @@ TEST_CASE( "gun_layer", "[item]" )
     CHECK( gun.get_layer() == BELTED_LAYER );
 }
 
+TEST_CASE( "gunmod_flags_are_inherited", "[item]" )
+{
+    const flag_id inherited( "NO_UNLOAD" );
+    const flag_id not_inherited( "DIAMOND" );
+    item &gun = *item::spawn_temporary( "win70" );
+    REQUIRE_FALSE( gun.has_flag( inherited ) );
+    REQUIRE_FALSE( gun.has_flag( not_inherited ) );
+
+    gun.put_in( item::spawn( "shoulder_strap" ) );
+    item &mod = *gun.gunmods().front();
+    // Changes to the flags of an installed mod must show up on the gun
+    mod.set_flag( inherited );
+    mod.set_flag( not_inherited );
+    CHECK( mod.has_flag( inherited ) );
+    CHECK( gun.has_flag( inherited ) );
+    CHECK_FALSE( gun.has_flag( not_inherited ) );
+
+    detached_ptr<item> removed = gun.contents.remove_top( &mod );
+    CHECK_FALSE( gun.has_flag( inherited ) );
+    CHECK( removed->has_flag( inherited ) );
+
+    gun.set_flag( not_inherited );
+    CHECK( gun.has_flag( not_inherited ) );
+    gun.unset_flag( not_inherited );
+    CHECK_FALSE( gun.has_flag( not_inherited ) );
+}
+
+TEST_CASE( "cached_weight_and_volume_follow_changes", "[item]" )
+{
+    item &bottle = *item::spawn_temporary( "bottle_plastic" );
+    const units::mass empty_weight = bottle.weight();
+    const units::volume empty_volume = bottle.volume();
+
+    bottle.put_in( item::spawn( "water_clean", calendar::turn_zero, 2 ) );
+    item &water = bottle.contents.front();
+    const units::mass water_weight = water.weight();
+    CHECK( bottle.weight() == empty_weight + water_weight );
+
+    // Changing the charges of the contents drops the cached weight of the container
+    water.set_charges( 1 );
+    CHECK( water.weight() * 2 == water_weight );
+    CHECK( bottle.weight() == empty_weight + water.weight() );
+
+    water.set_charges( 2 );
+    CHECK( bottle.weight() == empty_weight + water_weight );
+
+    bottle.contents.clear_items();
+    CHECK( bottle.weight() == empty_weight );
+    CHECK( bottle.volume() == empty_volume );
+
+    bottle.set_var( "weight", to_milligram( empty_weight ) * 2 );
+    CHECK( bottle.weight() == empty_weight * 2 );
+}
+
 TEST_CASE( "stacking_cash_cards", "[item]" )
 {
     // Differently-charged cash cards should stack if neither is zero.
@@ -0,0 +1,112 @@
+#include "catch/catch.hpp"
+
+#include <sstream>
+#include <string>
+
+#include "item.h"
+#include "item_vars.h"
+#include "json.h"
+#include "point.h"
+
+TEST_CASE( "item_var_values_keep_their_text", "[item]" )
+{
+    CHECK( item_var_value( 42LL ).str() == "42" );
+    CHECK( item_var_value( -7LL ).str() == "-7" );
+    CHECK( item_var_value( 0.5 ).str() == "0.5" );
+    CHECK( item_var_value( 0.1 ).str() == "0.1" );
+    CHECK( item_var_value( 1.0 / 3.0 ).str() == "0.3333333333333333" );
+    CHECK( item_var_value( std::string( "plugged_in" ) ).str() == "plugged_in" );
+
+    // Text that wouldn't be written back the same stays text
+    for( const std::string text : {
+             "42", "-7", "0.500000", "+1", "007", "1e3", "0.5", "", "1,2,3", " 5", "plugged_in"
+         } ) {
+        CAPTURE( text );
+        CHECK( item_var_value::from_string( text ).str() == text );
+    }
+
+    CHECK( item_var_value::from_string( "42" ) == item_var_value( 42LL ) );
+    CHECK( item_var_value::from_string( "0.5" ) == item_var_value( 0.5 ) );
+    CHECK( item_var_value::from_string( "0.500000" ).to_double() == 0.5 );
+    CHECK( item_var_value( std::string( "42" ) ) == item_var_value( 42LL ) );
+    CHECK( item_var_value( 42LL ) != item_var_value( 43LL ) );
+    CHECK( item_var_value::from_string( "1,2,3" ).to_double() == 1.0 );
+}
+
+TEST_CASE( "item_vars_round_trip", "[item]" )
+{
+    item &it = *item::spawn_temporary( "rock" );
+    it.set_var( "counter", 12 );
+    it.set_var( "ratio", 0.25 );
+    it.set_var( "third", 1.0 / 3.0 );
+    it.set_var( "where", tripoint( 1, -2, 3 ) );
+    it.set_var( "cable", "plugged_in" );
+
+    CHECK( it.get_var( "counter", 0 ) == 12 );
+    CHECK( it.get_var( "counter" ) == "12" );
+    CHECK( it.get_var( "ratio", 0.0 ) == 0.25 );
+    CHECK( it.get_var( item_var_id( "ratio" ), 0.0 ) == 0.25 );
+    CHECK( it.get_var( "where", tripoint_zero ) == tripoint( 1, -2, 3 ) );
+    CHECK( it.get_var( "cable" ) == "plugged_in" );
+    CHECK( it.get_var( "missing", 5 ) == 5 );
+    CHECK_FALSE( it.has_var( "missing" ) );
+
+    it.erase_var( "ratio" );
+    CHECK_FALSE( it.has_var( "ratio" ) );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    it.serialize( jsout );
+    std::istringstream is( os.str() );
+    JsonIn jsin( is );
+    item &loaded = *item::spawn_temporary( "rock" );
+    loaded.deserialize( jsin );
+
+    CHECK( loaded.get_var( "counter", 0 ) == 12 );
+    CHECK( loaded.get_var( "third", 0.0 ) == 1.0 / 3.0 );
+    CHECK( loaded.get_var( "where", tripoint_zero ) == tripoint( 1, -2, 3 ) );
+    CHECK( loaded.get_var( "cable" ) == "plugged_in" );
+    CHECK_FALSE( loaded.has_var( "ratio" ) );
+    CHECK( loaded.stacks_with( it ) );
+}
+
+TEST_CASE( "item_vars_load_string_values", "[item]" )
+{
+    // Variables were saved as strings before they were typed
+    std::istringstream is(
+        R"({"typeid":"rock","item_vars":{"dirt":"1500","ratio":"0.250000","note":"hello"}})" );
+    JsonIn jsin( is );
+    item &it = *item::spawn_temporary( "rock" );
+    it.deserialize( jsin );
+
+    CHECK( it.get_var( "dirt", 0 ) == 1500 );
+    CHECK( it.get_var( "dirt" ) == "1500" );
+    CHECK( it.get_var( "ratio", 0.0 ) == 0.25 );
+    CHECK( it.get_var( "note" ) == "hello" );
+}
+
+TEST_CASE( "item_vars_benchmark", "[.][item][benchmark]" )
+{
+    item &it = *item::spawn_temporary( "rock" );
+    it.set_var( "dirt", 1500 );
+    it.set_var( "cable", "plugged_in" );
+    it.set_var( "magazine_converted", 1 );
+
+    BENCHMARK( "get_var number" ) {
+        return it.get_var( "dirt", 0 );
+    };
+    static const item_var_id var_dirt( "dirt" );
+    BENCHMARK( "get_var number by id" ) {
+        return it.get_var( var_dirt, 0 );
+    };
+    BENCHMARK( "get_var missing" ) {
+        return it.get_var( "ethereal", 0 );
+    };
+    BENCHMARK( "get_var string" ) {
+        return it.get_var( "cable" );
+    };
+    int i = 0;
+    BENCHMARK( "set_var number" ) {
+        it.set_var( "dirt", ++i );
+    };
+}
@@ -22,7 +22,7 @@ TEST_CASE( "eyedrops", "[iuse][eyedrops]" )
                                           item::default_charges_tag{} );
     item &eyedrops = *det;
     dummy.i_add( std::move( det ) );
-    int charges_before = eyedrops.charges;
+    int charges_before = eyedrops.charges();
     REQUIRE( charges_before > 0 );
 
     GIVEN( "avatar is boomered" ) {
@@ -33,7 +33,7 @@ TEST_CASE( "eyedrops", "[iuse][eyedrops]" )
             dummy.invoke_item( &eyedrops );
 
             THEN( "one dose is depleted" ) {
-                CHECK( eyedrops.charges == charges_before - 1 );
+                CHECK( eyedrops.charges() == charges_before - 1 );
 
                 AND_THEN( "it removes the boomered effect" ) {
                     CHECK_FALSE( dummy.has_effect( efftype_id( "boomered" ) ) );
@@ -62,7 +62,7 @@ TEST_CASE( "antifungal", "[iuse][antifungal]" )
                                           item::default_charges_tag{} );
     item &antifungal = *det;
     dummy.i_add( std::move( det ) );
-    int charges_before = antifungal.charges;
+    int charges_before = antifungal.charges();
     REQUIRE( charges_before > 0 );
 
     GIVEN( "avatar has a fungal infection" ) {
@@ -73,7 +73,7 @@ TEST_CASE( "antifungal", "[iuse][antifungal]" )
             dummy.invoke_item( &antifungal );
 
             THEN( "one dose is depleted" ) {
-                CHECK( antifungal.charges == charges_before - 1 );
+                CHECK( antifungal.charges() == charges_before - 1 );
 
                 AND_THEN( "it cures the fungal infection" ) {
                     CHECK_FALSE( dummy.has_effect( efftype_id( "fungus" ) ) );
@@ -90,7 +90,7 @@ TEST_CASE( "antifungal", "[iuse][antifungal]" )
             dummy.invoke_item( &antifungal );
 
             THEN( "one dose is depleted" ) {
-                CHECK( antifungal.charges == charges_before - 1 );
+                CHECK( antifungal.charges() == charges_before - 1 );
 
                 AND_THEN( "it has no effect on the spores" ) {
                     CHECK( dummy.has_effect( efftype_id( "spores" ) ) );
@@ -108,7 +108,7 @@ TEST_CASE( "antiparasitic", "[iuse][antiparasitic]" )
     item &antiparasitic = *det;
     dummy.i_add( std::move( det ) );
 
-    int charges_before = antiparasitic.charges;
+    int charges_before = antiparasitic.charges();
     REQUIRE( charges_before > 0 );
 
     GIVEN( "avatar has parasite infections" ) {
@@ -128,7 +128,7 @@ TEST_CASE( "antiparasitic", "[iuse][antiparasitic]" )
             dummy.invoke_item( &antiparasitic );
 
             THEN( "one dose is depleted" ) {
-                CHECK( antiparasitic.charges == charges_before - 1 );
+                CHECK( antiparasitic.charges() == charges_before - 1 );
 
                 AND_THEN( "it cures all parasite infections" ) {
                     CHECK_FALSE( dummy.has_effect( efftype_id( "dermatik" ) ) );
@@ -149,7 +149,7 @@ TEST_CASE( "antiparasitic", "[iuse][antiparasitic]" )
             dummy.invoke_item( &antiparasitic );
 
             THEN( "one dose is depleted" ) {
-                CHECK( antiparasitic.charges == charges_before - 1 );
+                CHECK( antiparasitic.charges() == charges_before - 1 );
 
                 AND_THEN( "it has no effect on the fungal infection" ) {
                     CHECK( dummy.has_effect( efftype_id( "fungus" ) ) );
@@ -167,7 +167,7 @@ TEST_CASE( "anticonvulsant", "[iuse][anticonvulsant]" )
     item &anticonvulsant = *det;
     dummy.i_add( std::move( det ) );
 
-    int charges_before = anticonvulsant.charges;
+    int charges_before = anticonvulsant.charges();
     REQUIRE( charges_before > 0 );
 
     GIVEN( "avatar has the shakes" ) {
@@ -178,7 +178,7 @@ TEST_CASE( "anticonvulsant", "[iuse][anticonvulsant]" )
             dummy.invoke_item( &anticonvulsant );
 
             THEN( "one dose is depleted" ) {
-                CHECK( anticonvulsant.charges == charges_before - 1 );
+                CHECK( anticonvulsant.charges() == charges_before - 1 );
 
                 AND_THEN( "it cures the shakes" ) {
                     CHECK_FALSE( dummy.has_effect( efftype_id( "shakes" ) ) );
@@ -201,7 +201,7 @@ TEST_CASE( "oxygen tank", "[iuse][oxygen_bottle]" )
     item &oxygen = *det;
     dummy.i_add( std::move( det ) );
 
-    int charges_before = oxygen.charges;
+    int charges_before = oxygen.charges();
     REQUIRE( charges_before > 0 );
 
     // Ensure baseline painkiller value to measure painkiller effects
@@ -214,7 +214,7 @@ TEST_CASE( "oxygen tank", "[iuse][oxygen_bottle]" )
 
         THEN( "a dose of oxygen relieves the smoke inhalation" ) {
             dummy.invoke_item( &oxygen );
-            CHECK( oxygen.charges == charges_before - 1 );
+            CHECK( oxygen.charges() == charges_before - 1 );
             CHECK_FALSE( dummy.has_effect( efftype_id( "smoke" ) ) );
 
             AND_THEN( "it acts as a mild painkiller" ) {
@@ -229,7 +229,7 @@ TEST_CASE( "oxygen tank", "[iuse][oxygen_bottle]" )
 
         THEN( "a dose of oxygen relieves the effects of tear gas" ) {
             dummy.invoke_item( &oxygen );
-            CHECK( oxygen.charges == charges_before - 1 );
+            CHECK( oxygen.charges() == charges_before - 1 );
             CHECK_FALSE( dummy.has_effect( efftype_id( "teargas" ) ) );
 
             AND_THEN( "it acts as a mild painkiller" ) {
@@ -244,7 +244,7 @@ TEST_CASE( "oxygen tank", "[iuse][oxygen_bottle]" )
 
         THEN( "a dose of oxygen relieves the effects of asthma" ) {
             dummy.invoke_item( &oxygen );
-            CHECK( oxygen.charges == charges_before - 1 );
+            CHECK( oxygen.charges() == charges_before - 1 );
             CHECK_FALSE( dummy.has_effect( efftype_id( "asthma" ) ) );
 
             AND_THEN( "it acts as a mild painkiller" ) {
@@ -264,7 +264,7 @@ TEST_CASE( "oxygen tank", "[iuse][oxygen_bottle]" )
 
             THEN( "a dose of oxygen is stimulating" ) {
                 dummy.invoke_item( &oxygen );
-                CHECK( oxygen.charges == charges_before - 1 );
+                CHECK( oxygen.charges() == charges_before - 1 );
                 // values should match iuse function `oxygen_bottle`
                 CHECK( dummy.get_stim() == 8 );
 
@@ -284,7 +284,7 @@ TEST_CASE( "oxygen tank", "[iuse][oxygen_bottle]" )
 
             THEN( "a dose of oxygen has no additional stimulation effects" ) {
                 dummy.invoke_item( &oxygen );
-                CHECK( oxygen.charges == charges_before - 1 );
+                CHECK( oxygen.charges() == charges_before - 1 );
                 CHECK( dummy.get_stim() == max_stim );
 
                 AND_THEN( "it acts as a mild painkiller" ) {
@@ -468,7 +468,7 @@ TEST_CASE( "thorazine", "[iuse][thorazine]" )
                                           item::default_charges_tag{} );
     item &thorazine = *det;
     dummy.i_add( std::move( det ) );
-    int charges_before = thorazine.charges;
+    int charges_before = thorazine.charges();
     REQUIRE( charges_before >= 2 );
 
     GIVEN( "avatar has hallucination, and visuals effects" ) {
@@ -481,7 +481,7 @@ TEST_CASE( "thorazine", "[iuse][thorazine]" )
             dummy.invoke_item( &thorazine );
 
             THEN( "it relieves both of those effects with a single dose" ) {
-                CHECK( thorazine.charges == charges_before - 1 );
+                CHECK( thorazine.charges() == charges_before - 1 );
                 REQUIRE_FALSE( dummy.has_effect( efftype_id( "hallu" ) ) );
                 REQUIRE_FALSE( dummy.has_effect( efftype_id( "visuals" ) ) );
 
@@ -494,14 +494,14 @@ TEST_CASE( "thorazine", "[iuse][thorazine]" )
 
     GIVEN( "avatar has already taken some thorazine" ) {
         dummy.invoke_item( &thorazine );
-        REQUIRE( thorazine.charges == charges_before - 1 );
+        REQUIRE( thorazine.charges() == charges_before - 1 );
         REQUIRE( dummy.has_effect( efftype_id( "took_thorazine" ) ) );
 
         WHEN( "they take more thorazine" ) {
             dummy.invoke_item( &thorazine );
 
             THEN( "it only causes more fatigue" ) {
-                CHECK( thorazine.charges == charges_before - 2 );
+                CHECK( thorazine.charges() == charges_before - 2 );
                 CHECK( dummy.get_fatigue() >= 20 );
             }
         }
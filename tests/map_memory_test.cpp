@@ -5,11 +5,13 @@
 #include <sstream>
 #include <string>
 
+#include "fstream_utils.h"
 #include "game_constants.h"
 #include "json.h"
 #include "lru_cache.h"
 #include "map.h"
 #include "map_memory.h"
+#include "memory_fast.h"
 #include "point.h"
 #include "string_formatter.h"
 
@@ -75,6 +77,54 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     memory.memorize_symbol( p3, 1 );
 }
 
+TEST_CASE( "map_memory_region_serialization", "[map_memory]" )
+{
+    mm_region region;
+    for( auto &column : region.submaps ) {
+        for( shared_ptr_fast<mm_submap> &sm : column ) {
+            sm = make_shared_fast<mm_submap>();
+        }
+    }
+    memorized_terrain_tile floor;
+    floor.tile = memorized_tile_id( "t_floor" );
+    memorized_terrain_tile car;
+    car.tile = memorized_tile_id( "vp_frame" );
+    car.subtile = 2;
+    car.rotation = 270;
+    region.submaps[1][2]->set_tile( point( 3, 4 ), floor );
+    region.submaps[1][2]->set_tile( point( 5, 4 ), car );
+    region.submaps[7][0]->set_tile( point_zero, car );
+    region.submaps[7][0]->set_symbol( point_zero, 35 );
+
+    mm_region loaded;
+    deserialize( loaded, serialize( region ) );
+    for( int x = 0; x < MM_REG_SIZE; x++ ) {
+        for( int y = 0; y < MM_REG_SIZE; y++ ) {
+            CHECK( loaded.submaps[x][y]->is_empty() == region.submaps[x][y]->is_empty() );
+        }
+    }
+    CHECK( loaded.submaps[1][2]->tile( point( 3, 4 ) ) == floor );
+    CHECK( loaded.submaps[1][2]->tile( point( 5, 4 ) ) == car );
+    CHECK( loaded.submaps[1][2]->tile( point( 4, 4 ) ) == mm_submap::default_tile );
+    CHECK( loaded.submaps[7][0]->tile( point_zero ) == car );
+    CHECK( loaded.submaps[7][0]->symbol( point_zero ) == 35 );
+    CHECK( loaded.submaps[7][0]->tile( point( 3, 3 ) ).tile.empty() );
+
+    // Region files from before the table of names
+    std::string legacy = "[[[\"t_floor\",0,0,46],[\"vp_frame\",2,270,0," + std::to_string(
+                             SEEX * SEEY - 1 ) + "]]";
+    for( int i = 1; i < MM_REG_SIZE * MM_REG_SIZE; i++ ) {
+        legacy += ",null";
+    }
+    legacy += "]";
+    mm_region legacy_loaded;
+    deserialize( legacy_loaded, legacy );
+    CHECK( legacy_loaded.submaps[0][0]->tile( point_zero ) == floor );
+    CHECK( legacy_loaded.submaps[0][0]->symbol( point_zero ) == 46 );
+    CHECK( legacy_loaded.submaps[0][0]->tile( point( SEEX - 1, SEEY - 1 ) ) == car );
+    CHECK( legacy_loaded.submaps[0][1]->is_empty() );
+}
+
 // TODO: map memory save / load
 
 #include <chrono>
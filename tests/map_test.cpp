@@ -1,17 +1,29 @@
 #include "catch/catch.hpp"
 
+#include <algorithm>
+#include <list>
 #include <memory>
 #include <vector>
 
 #include "avatar.h"
+#include "coordinate_conversions.h"
 #include "enums.h"
 #include "game.h"
 #include "game_constants.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "map_iterator.h"
+#include "mapbuffer.h"
+#include "pathfinding.h"
 #include "point.h"
 #include "state_helpers.h"
+#include "submap.h"
 #include "type_id.h"
+#include "units_angle.h"
+#include "vehicle.h"
+#include "vehicle_part.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 
 TEST_CASE( "destroy_grabbed_furniture" )
 {
@@ -144,3 +156,223 @@ TEST_CASE( "bash_through_roof_can_destroy_multiple_times" )
         }
     }
 }
+
+struct shifted_caches {
+    std::vector<float> transparency;
+    std::vector<bool> outside;
+    std::vector<bool> floor;
+    std::vector<int> pathfinding;
+
+    explicit shifted_caches( map &here, int z ) {
+        const level_cache &ch = here.get_cache_ref( z );
+        const pathfinding_cache &pf = here.get_pathfinding_cache_ref( z );
+        for( int x = 0; x < MAPSIZE_X; x++ ) {
+            for( int y = 0; y < MAPSIZE_Y; y++ ) {
+                transparency.push_back( ch.transparency_cache[x][y] );
+                outside.push_back( ch.outside_cache[x][y] );
+                floor.push_back( ch.floor_cache[x][y] );
+                pathfinding.push_back( pf.special[x][y] );
+            }
+        }
+    }
+};
+
+TEST_CASE( "map_shift_moves_caches_with_submaps", "[map]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const int z = 0;
+    const ter_id t_floor( "t_floor" );
+    const ter_id t_brick_wall( "t_brick_wall" );
+    const ter_id t_open_air( "t_open_air" );
+    // Buildings straddling submap borders, so the cached tiles differ between them
+    for( int x = 5; x < MAPSIZE_X - 5; x += 17 ) {
+        for( int y = 5; y < MAPSIZE_Y - 5; y += 13 ) {
+            for( const tripoint &p : here.points_in_rectangle( tripoint( x, y, z ),
+                    tripoint( x + 8, y + 6, z ) ) ) {
+                here.ter_set( p, p.x == x || p.y == y ? t_brick_wall : t_floor );
+            }
+            here.ter_set( tripoint( x + 4, y + 3, z ), t_open_air );
+        }
+    }
+    here.build_map_cache( z );
+
+    for( const point &dir : {
+             point_east, point_south, point_west, point_north, point_north_east, point_south_west
+         } ) {
+        INFO( dir.to_string() );
+        here.shift( dir );
+        here.build_map_cache( z );
+        const shifted_caches moved( here, z );
+
+        here.invalidate_map_cache( z );
+        here.set_pathfinding_cache_dirty( z );
+        here.build_map_cache( z );
+        const shifted_caches rebuilt( here, z );
+
+        CHECK( moved.transparency == rebuilt.transparency );
+        CHECK( moved.outside == rebuilt.outside );
+        CHECK( moved.floor == rebuilt.floor );
+        CHECK( moved.pathfinding == rebuilt.pathfinding );
+    }
+}
+
+TEST_CASE( "map_shift_updates_suspension_cache", "[map]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const int z = 0;
+    // On the east edge, unloaded by shifting west and loaded again by shifting back east
+    const tripoint bridge( MAPSIZE_X - 3, HALF_MAPSIZE_Y, z );
+    here.invalidate_map_cache( z );
+    here.update_suspension_cache( z );
+    here.ter_set( bridge, ter_id( "t_web_bridge" ) );
+    here.update_suspension_cache( z );
+    const point bridge_abs = here.getabs( bridge ).xy();
+    const std::list<point> &cache = here.get_cache_ref( z ).suspension_cache;
+    REQUIRE( std::count( cache.begin(), cache.end(), bridge_abs ) == 1 );
+
+    here.shift( point_west );
+    CHECK( std::count( cache.begin(), cache.end(), bridge_abs ) == 0 );
+    for( const point &p : cache ) {
+        CHECK( here.inbounds( here.getlocal( p ) ) );
+    }
+
+    here.shift( point_east );
+    CHECK( std::count( cache.begin(), cache.end(), bridge_abs ) == 1 );
+    here.update_suspension_cache( z );
+    CHECK( std::count( cache.begin(), cache.end(), bridge_abs ) == 1 );
+}
+
+// Terrain caches with the vehicle parts written over them
+struct vehicle_caches {
+    std::vector<float> transparency;
+    std::vector<bool> outside;
+    std::vector<bool> floor;
+    std::vector<bool> roof;
+    std::vector<bool> obscured;
+    std::vector<bool> obstructed;
+
+    explicit vehicle_caches( const map &m, int z ) {
+        const level_cache &ch = m.get_cache_ref( z );
+        const level_cache &above = m.get_cache_ref( z + 1 );
+        for( int x = 0; x < MAPSIZE_X; x++ ) {
+            for( int y = 0; y < MAPSIZE_Y; y++ ) {
+                transparency.push_back( ch.transparency_cache[x][y] );
+                outside.push_back( ch.outside_cache[x][y] );
+                floor.push_back( ch.floor_cache[x][y] );
+                roof.push_back( above.floor_cache[x][y] );
+                obscured.push_back( ch.vehicle_obscured_cache[x][y].nw );
+                obscured.push_back( ch.vehicle_obscured_cache[x][y].ne );
+                obstructed.push_back( ch.vehicle_obstructed_cache[x][y].nw );
+                obstructed.push_back( ch.vehicle_obstructed_cache[x][y].ne );
+            }
+        }
+    }
+};
+
+TEST_CASE( "vehicle_footprint_updates_match_full_rebuild", "[map][vehicle]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const int z = 0;
+    // Turned, so its walls block diagonals too
+    vehicle *veh = here.add_vehicle( vproto_id( "car" ), tripoint( HALF_MAPSIZE_X, HALF_MAPSIZE_Y, z ),
+                                     45_degrees, 0, 0 );
+    REQUIRE( veh != nullptr );
+    here.build_map_cache( z );
+
+    const auto check_against_full_rebuild = [&]() {
+        here.build_map_cache( z );
+        const vehicle_caches incremental( here, z );
+        // A map of its own has no footprints yet, so it builds all of them
+        map fresh;
+        fresh.load( here.get_abs_sub(), false );
+        fresh.build_map_cache( z );
+        const vehicle_caches rebuilt( fresh, z );
+        CHECK( incremental.transparency == rebuilt.transparency );
+        CHECK( incremental.outside == rebuilt.outside );
+        CHECK( incremental.floor == rebuilt.floor );
+        CHECK( incremental.roof == rebuilt.roof );
+        CHECK( incremental.obscured == rebuilt.obscured );
+        CHECK( incremental.obstructed == rebuilt.obstructed );
+    };
+
+    SECTION( "vehicle moves" ) {
+        REQUIRE( here.displace_vehicle( *veh, tripoint( 5, 3, 0 ) ) );
+        check_against_full_rebuild();
+    }
+    SECTION( "door opens and closes" ) {
+        int door = -1;
+        for( const vpart_reference &vp : veh->get_avail_parts( "OPENABLE" ) ) {
+            door = static_cast<int>( vp.part_index() );
+            break;
+        }
+        REQUIRE( door >= 0 );
+        veh->open( door );
+        check_against_full_rebuild();
+        veh->close( door );
+        check_against_full_rebuild();
+    }
+    SECTION( "part is destroyed" ) {
+        int wall = -1;
+        for( const vpart_reference &vp : veh->get_avail_parts( "OPAQUE" ) ) {
+            wall = static_cast<int>( vp.part_index() );
+            break;
+        }
+        REQUIRE( wall >= 0 );
+        // What damage_direct does to a part it breaks, without hitting a random part
+        veh->suspend_refresh();
+        veh->set_hp( veh->part( wall ), 0 );
+        veh->enable_refresh();
+        REQUIRE( veh->part( wall ).is_broken() );
+        check_against_full_rebuild();
+    }
+}
+
+TEST_CASE( "map_shift_keeps_grid_in_sync_with_mapbuffer", "[map]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const int z = 0;
+    vehicle *veh = here.add_vehicle( vproto_id( "bicycle" ), tripoint( HALF_MAPSIZE_X + 3,
+                                     HALF_MAPSIZE_Y + 3, z ), 0_degrees, 0, 0 );
+    REQUIRE( veh != nullptr );
+    const tripoint veh_abs = here.getabs( veh->global_pos3() );
+
+    // Enough steps in one direction to wrap the grid origin around more than once
+    std::vector<point> steps( MAPSIZE + 2, point_west );
+    steps.insert( steps.end(), MAPSIZE + 1, point_north );
+    for( const point &dir : {
+             point_south_east, point_east, point_south, point_north_west, point_south_west
+         } ) {
+        steps.push_back( dir );
+    }
+
+    int marker = 0;
+    for( const point &dir : steps ) {
+        here.shift( dir );
+        const tripoint abs_sub = here.get_abs_sub();
+        // Tag every loaded submap through the map and find the tag in the mapbuffer
+        for( int gridx = 0; gridx < MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < MAPSIZE; gridy++ ) {
+                const tripoint gridp( gridx, gridy, z );
+                const point local( 3, 5 );
+                here.set_radiation( sm_to_ms_copy( gridp ) + local, ++marker );
+                const submap *sm = MAPBUFFER.lookup_submap( abs_sub.xy() + gridp );
+                CAPTURE( dir, gridp );
+                REQUIRE( sm != nullptr );
+                REQUIRE( sm->get_radiation( local ) == marker );
+            }
+        }
+        const VehicleList vehs = here.get_vehicles();
+        const bool veh_loaded = std::any_of( vehs.begin(), vehs.end(),
+        [&]( const wrapped_vehicle & v ) {
+            return v.v == veh;
+        } );
+        if( veh_loaded ) {
+            CAPTURE( dir );
+            CHECK( here.getabs( veh->global_pos3() ) == veh_abs );
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#include "catch/catch.hpp"
+
+#include <chrono>
+
+#include "coordinates.h"
+#include "mapgen_queue.h"
+#include "point.h"
+#include "state_helpers.h"
+
+TEST_CASE( "mapgen_queue_follows_player_heading", "[mapgen]" )
+{
+    clear_all_state();
+    mapgen_queue queue;
+    const tripoint_abs_omt origin( 100, 100, 0 );
+
+    queue.update( origin );
+    CHECK( queue.pending() == 0 );
+
+    queue.update( origin + tripoint_east );
+    const std::size_t ahead = queue.pending();
+    CHECK( ahead > 0 );
+
+    // Staying in the same terrain keeps the queue
+    queue.update( origin + tripoint_east );
+    CHECK( queue.pending() == ahead );
+
+    // Turning replaces the jobs for the old heading
+    queue.update( origin + tripoint_east + tripoint_south_east );
+    CHECK( queue.pending() > 0 );
+
+    // Jumping far away isn't a heading
+    queue.update( origin + tripoint( 50, 0, 0 ) );
+    CHECK( queue.pending() == 0 );
+
+    queue.update( origin + tripoint( 50, 1, 0 ) );
+    CHECK( queue.pending() == ahead );
+    queue.clear();
+    CHECK( queue.pending() == 0 );
+}
+
+TEST_CASE( "mapgen_queue_respects_empty_budget", "[mapgen]" )
+{
+    clear_all_state();
+    mapgen_queue queue;
+    const tripoint_abs_omt origin( 100, 100, 0 );
+    queue.update( origin );
+    queue.update( origin + tripoint_east );
+    const std::size_t ahead = queue.pending();
+    REQUIRE( ahead > 0 );
+
+    CHECK( queue.process( std::chrono::microseconds::zero() ) == 0 );
+    CHECK( queue.pending() == ahead );
+}
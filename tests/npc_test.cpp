@@ -13,6 +13,7 @@
 #include "field.h"
 #include "field_type.h"
 #include "game.h"
+#include "item.h"
 #include "itype.h"
 #include "line.h"
 #include "map.h"
@@ -20,6 +21,7 @@
 #include "memory_fast.h"
 #include "npc.h"
 #include "npc_class.h"
+#include "npctalk.h"
 #include "numeric_interval.h"
 #include "overmapbuffer.h"
 #include "pimpl.h"
@@ -28,6 +30,7 @@
 #include "state_helpers.h"
 #include "text_snippets.h"
 #include "type_id.h"
+#include "units.h"
 #include "veh_type.h"
 #include "vehicle.h"
 #include "vehicle_part.h"
@@ -496,6 +499,112 @@ TEST_CASE( "npc_move_through_vehicle_holes" )
 
 }
 
+// Whether the player or a follower sees guy or p, without the perception snapshot
+static bool uncached_observed_by_followers( const npc &guy, const tripoint &p )
+{
+    std::vector<shared_ptr_fast<npc>> followers;
+    for( const character_id &elem : g->get_follower_list() ) {
+        if( shared_ptr_fast<npc> follower = overmap_buffer.find_npc( elem ) ) {
+            followers.emplace_back( follower );
+        }
+    }
+    if( followers.empty() ) {
+        return false;
+    }
+    for( const tripoint &target : { guy.pos(), p } ) {
+        if( get_player_character().sees( target ) ) {
+            return true;
+        }
+        for( const shared_ptr_fast<npc> &follower : followers ) {
+            if( follower->sees( target ) ) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// What npc::find_item picks when every tile is checked directly, without the perception snapshot
+static std::optional<tripoint> uncached_find_item_pos( npc &guy )
+{
+    map &here = get_map();
+    const units::volume volume_allowed = guy.volume_capacity() - guy.volume_carried();
+    const units::mass weight_allowed = guy.weight_capacity() - guy.weight_carried();
+    int best_value = guy.minimum_item_value();
+    std::optional<tripoint> ret;
+    for( const tripoint &p : closest_points_first( guy.pos(), npc_perception_cache::radius ) ) {
+        if( !here.inbounds( p ) || !guy.sees( p ) || !here.sees_some_items( p, guy ) ) {
+            continue;
+        }
+        for( const item * const &it : here.i_at( p ) ) {
+            const int itval = guy.value( *it );
+            if( it->made_of( LIQUID ) ||
+                ( !it->is_owned_by( guy, true ) && uncached_observed_by_followers( guy, p ) ) ) {
+                continue;
+            }
+            if( itval > best_value &&
+                it->volume() <= volume_allowed && it->weight() <= weight_allowed ) {
+                best_value = itval;
+                ret = p;
+            }
+        }
+    }
+    return ret;
+}
+
+static void check_find_item_matches_uncached( npc &guy )
+{
+    map &here = get_map();
+    std::vector<tripoint> item_tiles;
+    for( const tripoint &p : closest_points_first( guy.pos(), npc_perception_cache::radius ) ) {
+        if( here.inbounds( p ) && here.has_items( p ) ) {
+            item_tiles.push_back( p );
+        }
+    }
+    CHECK( guy.perceived_item_tiles() == item_tiles );
+    for( const tripoint &p : item_tiles ) {
+        CHECK( guy.perceives( p ) == guy.sees( p ) );
+        CHECK( guy.observed_by_followers( p ) == uncached_observed_by_followers( guy, p ) );
+    }
+
+    const std::optional<tripoint> expected = uncached_find_item_pos( guy );
+    guy.find_item();
+    CHECK( guy.fetching_item == expected.has_value() );
+    if( expected ) {
+        CHECK( guy.wanted_item_pos == *expected );
+    }
+}
+
+TEST_CASE( "npc_find_item_matches_uncached_search", "[npc]" )
+{
+    clear_all_state();
+    calendar::turn = calendar::turn_zero + 12_hours;
+    g->place_player( tripoint( 40, 40, 0 ) );
+    clear_npcs();
+
+    map &here = get_map();
+    npc &guy = spawn_npc( point( 60, 60 ), "thug" );
+    here.add_item_or_charges( guy.pos() + tripoint( 2, 1, 0 ), item::spawn( "rock" ) );
+    here.add_item_or_charges( guy.pos() + tripoint( -4, 3, 0 ), item::spawn( "glock_19" ) );
+    // Outside of the perception radius until the NPC moves
+    here.add_item_or_charges( guy.pos() + tripoint( 9, 0, 0 ), item::spawn( "hammer" ) );
+    here.build_map_cache( 0 );
+
+    check_find_item_matches_uncached( guy );
+
+    // Moving within the same turn takes a new snapshot
+    guy.setpos( guy.pos() + tripoint( 6, 0, 0 ) );
+    here.build_map_cache( 0 );
+    check_find_item_matches_uncached( guy );
+
+    // With a follower around, unowned items the follower can see are left alone
+    npc &follower = spawn_npc( guy.pos().xy() + point( 3, 3 ), "thug" );
+    talk_function::follow( follower );
+    here.build_map_cache( 0 );
+    calendar::turn += 1_turns;
+    check_find_item_matches_uncached( guy );
+}
+
 TEST_CASE( "random npc spawn chance" )
 {
     CHECK( npc_overmap::spawn_chance_in_hour( 0, 1.0 ) == Approx( 1.0 / 24.0 ) );
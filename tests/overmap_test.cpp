@@ -2,10 +2,13 @@
 
 #include <algorithm>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "calendar.h"
 #include "enums.h"
+#include "game.h"
 #include "game_constants.h"
 #include "numeric_interval.h"
 #include "omdata.h"
@@ -39,6 +42,97 @@ TEST_CASE( "set_and_get_overmap_scents", "[overmap]" )
     REQUIRE( test_overmap->scent_at( { 75, 85, 0} ).initial_strength == 90 );
 }
 
+TEST_CASE( "overmap_serialization_round_trip", "[overmap]" )
+{
+    clear_all_state();
+    const oter_id field( "field" );
+    const oter_id forest( "forest" );
+    std::unique_ptr<overmap> saved = std::make_unique<overmap>( point_abs_om() );
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z += 5 ) {
+        for( int x = 0; x < OMAPX; x += 3 ) {
+            saved->ter_set( { x, x % 7, z }, x % 2 ? field : forest );
+        }
+    }
+    saved->set_seen( { 4, 5, 0 }, true );
+    saved->set_explored( { 6, 7, -1 }, true );
+    saved->add_note( { 8, 9, 2 }, "note" );
+
+    std::ostringstream data;
+    saved->serialize( data );
+    std::ostringstream view;
+    saved->serialize_view( view );
+
+    std::unique_ptr<overmap> loaded = std::make_unique<overmap>( point_abs_om() );
+    std::istringstream data_in( data.str() );
+    loaded->unserialize( data_in, "test" );
+    std::istringstream view_in( view.str() );
+    loaded->unserialize_view( view_in, "test" );
+
+    // Layers that weren't used are written as they were loaded
+    std::ostringstream data_again;
+    loaded->serialize( data_again );
+    CHECK( data_again.str() == data.str() );
+
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const tripoint_om_omt p( x, y, z );
+                if( saved->ter( p ) != loaded->ter( p ) || saved->seen( p ) != loaded->seen( p ) ||
+                    saved->is_explored( p ) != loaded->is_explored( p ) ) {
+                    CAPTURE( p );
+                    CHECK( saved->ter( p ) == loaded->ter( p ) );
+                    CHECK( saved->seen( p ) == loaded->seen( p ) );
+                    CHECK( saved->is_explored( p ) == loaded->is_explored( p ) );
+                }
+            }
+        }
+    }
+    CHECK( loaded->note( { 8, 9, 2 } ) == "note" );
+
+    // Unpacked layers that didn't change are written as they were loaded too
+    std::ostringstream data_unpacked;
+    loaded->serialize( data_unpacked );
+    CHECK( data_unpacked.str() == data.str() );
+
+    // Changed layers are packed again
+    const tripoint_om_omt changed( 1, 2, 0 );
+    loaded->ter_set( changed, loaded->ter( changed ) == field ? forest : field );
+    std::ostringstream data_changed;
+    loaded->serialize( data_changed );
+    CHECK( data_changed.str() != data.str() );
+    saved->ter_set( changed, loaded->ter( changed ) );
+    std::ostringstream data_expected;
+    saved->serialize( data_expected );
+    CHECK( data_changed.str() == data_expected.str() );
+}
+
+TEST_CASE( "overmap_loads_json_format", "[overmap]" )
+{
+    clear_all_state();
+    const std::string version = "# version " + std::to_string( savegame_version ) + "\n";
+    std::string data = version + "{\"layers\":[";
+    std::string view = version + "{\"visible\":[";
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        data += std::string( z > 0 ? "," : "" ) + "[[\"forest\"," + std::to_string( OMAPX ) + "],[\"field\"," +
+                std::to_string( OMAPX * OMAPY - OMAPX ) + "]]";
+        view += std::string( z > 0 ? "," : "" ) + "[[false," + std::to_string( OMAPX * OMAPY - 1 ) +
+                "],[true,1]]";
+    }
+    data += "]}";
+    view += "]}";
+
+    std::unique_ptr<overmap> loaded = std::make_unique<overmap>( point_abs_om() );
+    std::istringstream data_in( data );
+    loaded->unserialize( data_in, "test" );
+    std::istringstream view_in( view );
+    loaded->unserialize_view( view_in, "test" );
+
+    CHECK( loaded->ter( { 5, 0, 3 } ) == oter_id( "forest" ) );
+    CHECK( loaded->ter( { 5, 1, 3 } ) == oter_id( "field" ) );
+    CHECK( loaded->seen( { OMAPX - 1, OMAPY - 1, -2 } ) );
+    CHECK( !loaded->seen( { 0, 0, -2 } ) );
+}
+
 TEST_CASE( "default_overmap_generation_always_succeeds", "[overmap][slow]" )
 {
     clear_all_state();
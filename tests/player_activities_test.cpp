@@ -292,7 +292,7 @@ TEST_CASE( "boltcut", "[activity][boltcut]" )
                         // can't use switch here
                         const itype_id it_id = it->typeId();
                         if( it_id == test_amount ) {
-                            count_amount += it->charges;
+                            count_amount += it->charges();
                         } else if( it_id == test_random ) {
                             count_random += 1;
                         }
@@ -554,7 +554,7 @@ TEST_CASE( "hacksaw", "[activity][hacksaw]" )
                         // can't use switch here
                         const itype_id it_id = it->typeId();
                         if( it_id == test_amount ) {
-                            count_amount += it->charges;
+                            count_amount += it->charges();
                         } else if( it_id == test_random ) {
                             count_random += 1;
                         }
@@ -812,7 +812,7 @@ TEST_CASE( "oxytorch", "[activity][oxytorch]" )
                         // can't use switch here
                         const itype_id it_id = it->typeId();
                         if( it_id == test_amount ) {
-                            count_amount += it->charges;
+                            count_amount += it->charges();
                         } else if( it_id == test_random ) {
                             count_random += 1;
                         }
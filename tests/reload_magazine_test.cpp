@@ -74,7 +74,7 @@ TEST_CASE( "reload_magazine", "[magazine] [visitable] [item] [item_location]" )
             det = item::spawn( ammo_id, calendar::turn, mag_cap + 5 );
             item &ammo = *det;
             p.i_add( std::move( det ) );
-            REQUIRE( ammo.charges == mag_cap + 5 );
+            REQUIRE( ammo.charges() == mag_cap + 5 );
 
             bool ok = mag.reload( g->u, ammo, mag.ammo_capacity() );
             THEN( "reloading is successful" ) {
@@ -97,7 +97,7 @@ TEST_CASE( "reload_magazine", "[magazine] [visitable] [item] [item_location]" )
                         return ( e->is_gun() || e->is_magazine() ) ? VisitResponse::SKIP : VisitResponse::NEXT;
                     } );
                     REQUIRE( found.size() == 1 );
-                    REQUIRE( found[0]->charges == 5 );
+                    REQUIRE( found[0]->charges() == 5 );
                 }
             }
         }
@@ -106,7 +106,7 @@ TEST_CASE( "reload_magazine", "[magazine] [visitable] [item] [item_location]" )
             det = item::spawn( ammo_id, calendar::turn, mag_cap - 2 );
             item &ammo = *det;
             p.i_add( std::move( det ) );
-            REQUIRE( ammo.charges == mag_cap - 2 );
+            REQUIRE( ammo.charges() == mag_cap - 2 );
 
             bool ok = mag.reload( g->u, ammo, mag.ammo_capacity() );
             THEN( "reloading is successful" ) {
@@ -136,7 +136,7 @@ TEST_CASE( "reload_magazine", "[magazine] [visitable] [item] [item_location]" )
                 det = item::spawn( ammo_id, calendar::turn, 10 );
                 item &ammo = *det;
                 p.i_add( std::move( det ) );
-                REQUIRE( ammo.charges == 10 );
+                REQUIRE( ammo.charges() == 10 );
                 REQUIRE( mag.ammo_remaining() == mag_cap - 2 );
 
                 bool ok = mag.reload( g->u, ammo, mag.ammo_capacity() );
@@ -156,7 +156,7 @@ TEST_CASE( "reload_magazine", "[magazine] [visitable] [item] [item_location]" )
                             return ( e->is_gun() || e->is_magazine() ) ? VisitResponse::SKIP : VisitResponse::NEXT;
                         } );
                         REQUIRE( found.size() == 1 );
-                        REQUIRE( found[0]->charges == 8 );
+                        REQUIRE( found[0]->charges() == 8 );
                     }
                 }
             }
@@ -291,7 +291,7 @@ TEST_CASE( "reload_magazine", "[magazine] [visitable] [item] [item_location]" )
                     det = item::spawn( ammo_id, calendar::turn, 10 );
                     item &ammo = *det;
                     p.i_add( std::move( det ) );
-                    REQUIRE( ammo.charges == 10 );
+                    REQUIRE( ammo.charges() == 10 );
 
                     bool ok = gun.magazine_current()->reload( g->u, ammo, 10 );
                     THEN( "further reloading is successful" ) {
@@ -311,7 +311,7 @@ TEST_CASE( "reload_magazine", "[magazine] [visitable] [item] [item_location]" )
                                        VisitResponse::SKIP : VisitResponse::NEXT;
                             } );
                             REQUIRE( found.size() == 1 );
-                            REQUIRE( found[0]->charges == 8 );
+                            REQUIRE( found[0]->charges() == 8 );
                         }
                     }
                 }
@@ -44,7 +44,7 @@ TEST_CASE( "reload_gun_with_integral_magazine", "[reload],[gun]" )
     REQUIRE( gun.ammo_remaining() == 0 );
     REQUIRE( gun.magazine_integral() );
 
-    bool success = gun.reload( dummy, ammo, ammo.charges );
+    bool success = gun.reload( dummy, ammo, ammo.charges() );
 
     REQUIRE( success );
     REQUIRE( gun.ammo_remaining() == gun.ammo_capacity() );
@@ -77,7 +77,7 @@ TEST_CASE( "reload_gun_with_integral_magazine_using_speedloader", "[reload],[gun
     REQUIRE( speedloader.ammo_remaining() == 0 );
     REQUIRE( speedloader.has_flag( flag_SPEEDLOADER ) );
 
-    bool speedloader_success = speedloader.reload( dummy, ammo, ammo.charges );
+    bool speedloader_success = speedloader.reload( dummy, ammo, ammo.charges() );
 
     REQUIRE( speedloader_success );
     REQUIRE( speedloader.ammo_remaining() == speedloader.ammo_capacity() );
@@ -130,7 +130,7 @@ TEST_CASE( "reload_gun_with_swappable_magazine", "[reload],[gun]" )
     int ammo_pos = dummy.inv_position_by_item( &ammo );
     REQUIRE( ammo_pos != INT_MIN );
 
-    bool magazine_success = magazine.reload( dummy, ammo, ammo.charges );
+    bool magazine_success = magazine.reload( dummy, ammo, ammo.charges() );
 
     REQUIRE( magazine_success );
     REQUIRE( magazine.ammo_remaining() == magazine.ammo_capacity() );
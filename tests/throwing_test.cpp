@@ -241,17 +241,17 @@ TEST_CASE( "time_to_throw_independent_of_number_of_projectiles", "[throwing],[ba
 
     detached_ptr<item> det = item::spawn( "throwing_stick", calendar::turn, 10 );
     item &thrown = *det;
-    REQUIRE( thrown.charges > 1 );
+    REQUIRE( thrown.charges() > 1 );
     REQUIRE( thrown.count_by_charges() );
     p.wield( std::move( det ) );
     int initial_moves = -1;
-    while( thrown.charges > 0 ) {
+    while( thrown.charges() > 0 ) {
         const int cost = ranged::throw_cost( p, thrown );
         if( initial_moves < 0 ) {
             initial_moves = cost;
         } else {
             CHECK( initial_moves == cost );
         }
-        thrown.charges--;
+        thrown.set_charges( thrown.charges() - 1 );
     }
 }
@@ -0,0 +1,275 @@
+#include "catch/catch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "field_type.h"
+#include "fstream_utils.h"
+#include "game.h"
+#include "item.h"
+#include "json.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "player_helpers.h"
+#include "rng.h"
+#include "state_helpers.h"
+#include "string_formatter.h"
+#include "turn_profiler.h"
+#include "type_id.h"
+#include "units_angle.h"
+#include "vehicle.h"
+
+static const efftype_id effect_sleep( "sleep" );
+
+static const vproto_id vehicle_car( "car" );
+
+namespace
+{
+
+// Keys in the output, which CI tracks, and the profiler zones they're read from
+constexpr std::array<std::pair<const char *, const char *>, 6> subsystem_zones = {{
+        { "monmove", "game::monmove" },
+        { "process_fields", "map::process_fields" },
+        { "process_items", "map::process_items" },
+        { "vehmove", "map::vehmove" },
+        { "build_map_cache", "map::build_map_cache" },
+        { "scent.update", "scent_map::update" },
+    }
+};
+
+struct turn_benchmark_scenario {
+    std::string name;
+    std::function<void()> setup;
+    // Called before every turn
+    std::function<void()> before_turn;
+    int turns = 0;
+};
+
+struct turn_benchmark_result {
+    std::string name;
+    int turns = 0;
+    std::chrono::microseconds total_time{ 0 };
+    std::chrono::microseconds max_time{ 0 };
+    std::array<std::chrono::microseconds, subsystem_zones.size()> subsystems = {};
+};
+
+} // namespace
+
+static std::string env_or( const char *name, const std::string &fallback )
+{
+    const char *value = std::getenv( name );
+    return value != nullptr && *value != '\0' ? value : fallback;
+}
+
+static const tripoint bench_center( 60, 60, 0 );
+
+static void place_avatar( const tripoint &where )
+{
+    avatar &u = get_avatar();
+    u.setpos( where );
+    get_map().build_map_cache( where.z );
+}
+
+static void setup_horde_siege()
+{
+    build_test_map( ter_id( "t_pavement" ) );
+    place_avatar( bench_center );
+    // A ring of zombies closing in from outside of melee range
+    for( int i = 0; i < 100; i++ ) {
+        const int radius = 8 + i % 12;
+        const tripoint offset = tripoint( i % 2 == 0 ? radius : -radius, ( i * 7 ) % 41 - 20, 0 );
+        spawn_test_monster( "mon_zombie", bench_center + offset );
+    }
+}
+
+static void setup_city_fire()
+{
+    build_test_map( ter_id( "t_floor" ) );
+    map &here = get_map();
+    // Wooden blocks with fire in the middle of each
+    for( int x = 20; x < 100; x++ ) {
+        for( int y = 20; y < 100; y++ ) {
+            if( x % 10 == 0 || y % 10 == 0 ) {
+                here.ter_set( tripoint( x, y, 0 ), ter_id( "t_wall_wood" ) );
+            } else if( x % 10 == 5 && y % 10 == 5 ) {
+                here.add_field( tripoint( x, y, 0 ), field_type_id( "fd_fire" ), 3 );
+            } else if( ( x + y ) % 3 == 0 ) {
+                here.add_item_or_charges( tripoint( x, y, 0 ), item::spawn( "2x4" ) );
+            }
+        }
+    }
+    here.invalidate_map_cache( 0 );
+    place_avatar( tripoint( 10, 10, 0 ) );
+}
+
+static vehicle *highway_vehicle = nullptr;
+static tripoint highway_start;
+
+static void setup_highway_drive()
+{
+    build_test_map( ter_id( "t_pavement" ) );
+    place_avatar( tripoint( 10, 10, 0 ) );
+    highway_start = bench_center;
+    highway_vehicle = get_map().add_vehicle( vehicle_car, highway_start, 0_degrees, 100, 0 );
+    REQUIRE( highway_vehicle != nullptr );
+    vehicle &veh = *highway_vehicle;
+    veh.tags.insert( "IN_CONTROL_OVERRIDE" );
+    veh.engine_on = true;
+    veh.cruise_velocity = std::min( 50 * 100, veh.safe_ground_velocity( false ) );
+    veh.velocity = veh.cruise_velocity;
+}
+
+static void highway_before_turn()
+{
+    // Bring it back to the start so it never leaves the map
+    vehicle &veh = *highway_vehicle;
+    get_map().displace_vehicle( veh, highway_start - veh.global_pos3() );
+}
+
+static void setup_big_base_idle()
+{
+    build_test_map( ter_id( "t_floor" ) );
+    map &here = get_map();
+    const std::vector<std::string> stock = { "2x4", "candle_lit", "rock", "water_clean", "apple" };
+    int n = 0;
+    for( int x = 30; x < 90; x++ ) {
+        for( int y = 30; y < 90; y++ ) {
+            if( x % 12 == 0 || y % 12 == 0 ) {
+                here.ter_set( tripoint( x, y, 0 ), ter_id( "t_wall_wood" ) );
+                continue;
+            }
+            if( ( x + y ) % 2 == 0 ) {
+                here.furn_set( tripoint( x, y, 0 ), furn_id( "f_bookcase" ) );
+            }
+            here.add_item_or_charges( tripoint( x, y, 0 ), item::spawn( stock[n++ % stock.size()] ) );
+        }
+    }
+    for( int i = 0; i < 4; i++ ) {
+        here.add_vehicle( vehicle_car, tripoint( 100, 20 + i * 20, 0 ), 0_degrees, 50, 0 );
+    }
+    here.invalidate_map_cache( 0 );
+    place_avatar( bench_center );
+}
+
+static void setup_sleeping()
+{
+    build_test_map( ter_id( "t_floor" ) );
+    place_avatar( bench_center );
+    avatar &u = get_avatar();
+    u.set_fatigue( 1000 );
+    u.add_effect( effect_sleep, 8_hours );
+}
+
+static turn_benchmark_result run_scenario( const turn_benchmark_scenario &scenario, int seed )
+{
+    clear_all_state();
+    rng_set_engine_seed( seed );
+    set_time( calendar::turn_zero + 12_hours );
+    scenario.setup();
+
+    turn_benchmark_result result;
+    result.name = scenario.name;
+    cata::turn_profiler &profiler = cata::get_turn_profiler();
+    profiler.start();
+    avatar &u = get_avatar();
+    for( int turn = 0; turn < scenario.turns; turn++ ) {
+        if( scenario.before_turn ) {
+            scenario.before_turn();
+        }
+        // No moves means do_turn won't wait for input, full hp keeps the avatar alive
+        u.moves = 0;
+        u.set_all_parts_hp_to_max();
+
+        const auto start = std::chrono::steady_clock::now();
+        g->do_turn();
+        const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start );
+        result.turns++;
+        result.total_time += time;
+        result.max_time = std::max( result.max_time, time );
+    }
+    // do_turn sums up the previous turn, this one is still open
+    profiler.end_turn();
+    profiler.stop();
+    for( const cata::turn_profiler::zone_usage &zone : profiler.zones_since_start() ) {
+        for( std::size_t i = 0; i < subsystem_zones.size(); i++ ) {
+            if( zone.name == subsystem_zones[i].second ) {
+                result.subsystems[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                                           zone.total );
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * Runs game::do_turn in a few scripted scenarios with a fixed seed and writes the time per
+ * turn and the time spent in the expensive subsystems, as measured by the zones of
+ * cata::turn_profiler, to a JSON file.
+ *
+ * Run with the cata_bench build target or `cata_test "[turn_benchmark]"`.
+ * Environment variables:
+ * - CATA_BENCH_FILTER: only scenarios containing this text
+ * - CATA_BENCH_TURNS: turns per scenario, 100 by default. Sleeping always lasts 8 hours.
+ * - CATA_BENCH_SEED: random seed, 1 by default
+ * - CATA_BENCH_OUTPUT: output file, turn_benchmark.json by default
+ */
+TEST_CASE( "turn_benchmark", "[.][turn_benchmark]" )
+{
+    const std::string filter = env_or( "CATA_BENCH_FILTER", "" );
+    const int turns = std::max( 1, std::atoi( env_or( "CATA_BENCH_TURNS", "100" ).c_str() ) );
+    const int seed = std::atoi( env_or( "CATA_BENCH_SEED", "1" ).c_str() );
+    const std::string output = env_or( "CATA_BENCH_OUTPUT", "turn_benchmark.json" );
+
+    const std::vector<turn_benchmark_scenario> scenarios = {
+        { "horde_siege", setup_horde_siege, nullptr, turns },
+        { "city_fire", setup_city_fire, nullptr, turns },
+        { "highway_drive", setup_highway_drive, highway_before_turn, turns },
+        { "big_base_idle", setup_big_base_idle, nullptr, turns },
+        { "sleeping", setup_sleeping, nullptr, to_turns<int>( 8_hours ) },
+    };
+
+    std::vector<turn_benchmark_result> results;
+    for( const turn_benchmark_scenario &scenario : scenarios ) {
+        if( filter.empty() || scenario.name.find( filter ) != std::string::npos ) {
+            results.push_back( run_scenario( scenario, seed ) );
+        }
+    }
+    clear_all_state();
+    REQUIRE( !results.empty() );
+
+    write_to_file( output, [&]( std::ostream & out ) {
+        JsonOut jsout( out, true );
+        jsout.start_object();
+        jsout.member( "seed", seed );
+        jsout.member( "scenarios" );
+        jsout.start_array();
+        for( const turn_benchmark_result &r : results ) {
+            jsout.start_object();
+            jsout.member( "name", r.name );
+            jsout.member( "turns", r.turns );
+            jsout.member( "mean_us", static_cast<double>( r.total_time.count() ) / r.turns );
+            jsout.member( "max_us", static_cast<int>( r.max_time.count() ) );
+            jsout.member( "subsystems_mean_us" );
+            jsout.start_object();
+            for( std::size_t i = 0; i < subsystem_zones.size(); i++ ) {
+                jsout.member( subsystem_zones[i].first,
+                              static_cast<double>( r.subsystems[i].count() ) / r.turns );
+            }
+            jsout.end_object();
+            jsout.end_object();
+        }
+        jsout.end_array();
+        jsout.end_object();
+    } );
+    cata_printf( "Turn benchmark of %d scenarios written to %s\n", results.size(), output );
+}
@@ -0,0 +1,91 @@
+#include "catch/catch.hpp"
+
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "filesystem.h"
+#include "json.h"
+#include "turn_profiler.h"
+
+static void profiled_leaf()
+{
+    cata::profile_zone zone( "profiled_leaf" );
+}
+
+static void profiled_parent()
+{
+    cata::profile_zone zone( "profiled_parent" );
+    profiled_leaf();
+    profiled_leaf();
+}
+
+TEST_CASE( "turn_profiler_sums_zones_per_turn", "[profiler]" )
+{
+    cata::turn_profiler &profiler = cata::get_turn_profiler();
+    profiler.start();
+    for( int turn = 0; turn < 3; turn++ ) {
+        profiled_parent();
+        profiler.end_turn();
+    }
+    profiler.stop();
+    // Not recorded while stopped
+    profiled_parent();
+    profiler.end_turn();
+
+    CHECK( profiler.recorded_turns() == 3 );
+    const std::vector<cata::turn_profiler::zone_usage> zones = profiler.top_zones( 10 );
+    REQUIRE( zones.size() == 2 );
+    // The parent includes the time of its children
+    CHECK( zones[0].name == "profiled_parent" );
+    CHECK( zones[0].calls == 3 );
+    CHECK( zones[1].name == "profiled_leaf" );
+    CHECK( zones[1].calls == 6 );
+    CHECK( zones[0].total >= zones[1].total );
+    CHECK( profiler.dropped_zones() == 0 );
+
+    const std::string path = "./turn_profiler_test.json";
+    REQUIRE( profiler.write_chrome_trace( path ) );
+    std::ifstream file( path, std::ios::binary );
+    JsonIn jsin( file );
+    JsonObject trace = jsin.get_object();
+    trace.allow_omitted_members();
+    std::multiset<std::string> names;
+    for( JsonObject event : trace.get_array( "traceEvents" ) ) {
+        event.allow_omitted_members();
+        CHECK( event.get_string( "ph" ) == "X" );
+        CHECK( event.get_float( "dur" ) >= 0.0 );
+        names.insert( event.get_string( "name" ) );
+    }
+    CHECK( names.count( "profiled_parent" ) == 3 );
+    CHECK( names.count( "profiled_leaf" ) == 6 );
+    file.close();
+    remove_file( path );
+
+    profiler.reset();
+    CHECK( profiler.recorded_turns() == 0 );
+}
+
+TEST_CASE( "turn_profiler_keeps_zones_since_start", "[profiler]" )
+{
+    cata::turn_profiler &profiler = cata::get_turn_profiler();
+    profiler.start();
+    const int turns = cata::turn_profiler::history_turns + 5;
+    for( int turn = 0; turn < turns; turn++ ) {
+        profiled_leaf();
+        profiler.end_turn();
+    }
+    profiler.stop();
+
+    const std::vector<cata::turn_profiler::zone_usage> recent = profiler.top_zones( 10 );
+    REQUIRE( recent.size() == 1 );
+    CHECK( recent[0].calls == cata::turn_profiler::history_turns );
+    const std::vector<cata::turn_profiler::zone_usage> all = profiler.zones_since_start();
+    REQUIRE( all.size() == 1 );
+    CHECK( all[0].name == "profiled_leaf" );
+    CHECK( all[0].calls == turns );
+
+    profiler.reset();
+    CHECK( profiler.zones_since_start().empty() );
+}
@@ -0,0 +1,42 @@
+#include "catch/catch.hpp"
+
+#include <string>
+
+#include "options.h"
+#include "options_helpers.h"
+#include "typed_options.h"
+
+TEST_CASE( "typed_option_handles_match_string_lookups", "[options]" )
+{
+#define CATA_TYPED_OPTION_CHECK( type, name ) \
+    CHECK( get_option( option::name ) == ::get_option<type>( #name ) );
+    CATA_TYPED_OPTIONS( CATA_TYPED_OPTION_CHECK )
+#undef CATA_TYPED_OPTION_CHECK
+}
+
+TEST_CASE( "typed_option_handles_follow_option_changes", "[options]" )
+{
+    const int original = get_option( option::SAFEMODEPROXIMITY );
+    const int changed = original == 10 ? 20 : 10;
+    {
+        override_option opt( "SAFEMODEPROXIMITY", std::to_string( changed ) );
+        CHECK( get_option( option::SAFEMODEPROXIMITY ) == changed );
+    }
+    CHECK( get_option( option::SAFEMODEPROXIMITY ) == original );
+
+    const bool autosave = get_option( option::AUTOSAVE );
+    {
+        override_option opt( "AUTOSAVE", autosave ? "false" : "true" );
+        CHECK( get_option( option::AUTOSAVE ) == !autosave );
+    }
+    CHECK( get_option( option::AUTOSAVE ) == autosave );
+}
+
+TEST_CASE( "typed_options_are_not_external", "[options]" )
+{
+    // External options only exist once mods are loaded, but typed options are read before that
+#define CATA_TYPED_OPTION_CHECK_PAGE( type, name ) \
+    CHECK( get_options().get_option( #name ).getPage() != "external_options" );
+    CATA_TYPED_OPTIONS( CATA_TYPED_OPTION_CHECK_PAGE )
+#undef CATA_TYPED_OPTION_CHECK_PAGE
+}
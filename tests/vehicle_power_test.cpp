@@ -1,6 +1,9 @@
 #include "catch/catch.hpp"
 
+#include <algorithm>
 #include <cstdlib>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -14,11 +17,15 @@
 #include "map.h"
 #include "map_helpers.h"
 #include "point.h"
+#include "rng.h"
 #include "state_helpers.h"
 #include "type_id.h"
+#include "veh_type.h"
 #include "vehicle.h"
 #include "vehicle_part.h"
 #include "vehicle_selector.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 #include "weather.h"
 
 static const itype_id fuel_type_battery( "battery" );
@@ -240,3 +247,114 @@ TEST_CASE( "Vehicle charging station", "[vehicle][power]" )
     }
 
 }
+
+TEST_CASE( "vehicle accessories power draw", "[vehicle][power]" )
+{
+    clear_all_state();
+    build_test_map( ter_id( "t_pavement" ) );
+
+    vehicle *veh_ptr = g->m.add_vehicle( vproto_id( "suv" ), tripoint( 10, 10, 0 ), 0_degrees, 100, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    REQUIRE( !veh_ptr->accessories.empty() );
+
+    const auto enabled_epower = [veh_ptr]() {
+        int epower = 0;
+        for( const vpart_reference &vp : veh_ptr->get_enabled_parts( VPFLAG_ENABLED_DRAINS_EPOWER ) ) {
+            epower += vp.info().epower;
+        }
+        return epower;
+    };
+
+    for( int p : veh_ptr->accessories ) {
+        veh_ptr->part( p ).enabled = false;
+    }
+    CHECK( veh_ptr->total_accessory_epower_w() == 0 );
+
+    for( int p : veh_ptr->accessories ) {
+        veh_ptr->part( p ).enabled = true;
+    }
+    CHECK( veh_ptr->total_accessory_epower_w() < 0 );
+    CHECK( veh_ptr->total_accessory_epower_w() == enabled_epower() );
+
+    veh_ptr->part( veh_ptr->accessories.front() ).enabled = false;
+    CHECK( veh_ptr->total_accessory_epower_w() == enabled_epower() );
+}
+
+// The percent-at-a-time distribution charge_battery used before it was calculated directly
+static int stepwise_charge( std::vector<vehicles::battery_level> &batteries, int amount )
+{
+    std::multimap<int, vehicles::battery_level *> chargeable;
+    for( vehicles::battery_level &b : batteries ) {
+        if( b.capacity > b.charge ) {
+            chargeable.insert( { b.charge * 100 / b.capacity, &b } );
+        }
+    }
+    while( amount > 0 && !chargeable.empty() ) {
+        auto iter = chargeable.begin();
+        const int charge_level = iter->first;
+        vehicles::battery_level *b = iter->second;
+        chargeable.erase( iter );
+        const int next = std::max( ( charge_level + 1 ) * b->capacity / 100, b->charge + 1 );
+        const int qty = std::min( amount, next - b->charge );
+        b->charge += qty;
+        amount -= qty;
+        if( b->capacity > b->charge ) {
+            chargeable.insert( { b->charge * 100 / b->capacity, b } );
+        }
+    }
+    return amount;
+}
+
+static int stepwise_discharge( std::vector<vehicles::battery_level> &batteries, int amount )
+{
+    std::multimap<int, vehicles::battery_level *> dischargeable;
+    for( vehicles::battery_level &b : batteries ) {
+        if( b.charge > 0 ) {
+            dischargeable.insert( { b.charge * 100 / b.capacity, &b } );
+        }
+    }
+    while( amount > 0 && !dischargeable.empty() ) {
+        auto iter = std::prev( dischargeable.end() );
+        const int charge_level = iter->first;
+        vehicles::battery_level *b = iter->second;
+        dischargeable.erase( iter );
+        const int prev = std::max( 0, ( charge_level - 1 ) * b->capacity / 100 );
+        const int qty = std::min( b->charge - prev, amount );
+        b->charge -= qty;
+        amount -= qty;
+        if( b->charge > 0 ) {
+            dischargeable.insert( { b->charge * 100 / b->capacity, b } );
+        }
+    }
+    return amount;
+}
+
+TEST_CASE( "battery distribution matches stepwise charging", "[vehicle][power]" )
+{
+    static const std::vector<int> capacities = { 50, 100, 250, 1000, 7000, 12345, 500000 };
+    for( int i = 0; i < 2000; i++ ) {
+        std::vector<vehicles::battery_level> batteries;
+        const int count = rng( 1, 40 );
+        for( int b = 0; b < count; b++ ) {
+            const int capacity = random_entry( capacities );
+            batteries.push_back( { rng( 0, capacity ), capacity } );
+        }
+        const int amount = rng( 0, 50000 );
+        const bool charging = one_in( 2 );
+        CAPTURE( amount, charging );
+
+        std::vector<vehicles::battery_level> expected = batteries;
+        if( charging ) {
+            CHECK( vehicles::charge_batteries( batteries, amount ) == stepwise_charge( expected, amount ) );
+        } else {
+            CHECK( vehicles::discharge_batteries( batteries, amount ) ==
+                   stepwise_discharge( expected, amount ) );
+        }
+        for( size_t b = 0; b < batteries.size(); b++ ) {
+            CAPTURE( batteries[b].capacity, expected[b].charge );
+            // Within two percent steps of rounding
+            CHECK( std::abs( batteries[b].charge - expected[b].charge ) <=
+                   2 * batteries[b].capacity / 100 + 2 );
+        }
+    }
+}
@@ -11,12 +11,14 @@
 #include "item.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "map_iterator.h"
 #include "point.h"
 #include "state_helpers.h"
 #include "type_id.h"
 #include "vehicle.h"
 #include "vehicle_part.h"
 #include "vpart_position.h"
+#include "vpart_range.h"
 #include "veh_type.h"
 
 TEST_CASE( "detaching_vehicle_unboards_passengers" )
@@ -201,3 +203,55 @@ TEST_CASE( "vehicle_rotation_reverse" )
         }
     }
 }
+
+static std::vector<vehicle *> park_vehicles( map &here )
+{
+    std::vector<vehicle *> vehs;
+    for( int x = 12; x < MAPSIZE_X - 12; x += 12 ) {
+        for( int y = 12; y < MAPSIZE_Y - 12; y += 12 ) {
+            vehicle *veh_ptr = here.add_vehicle( vproto_id( "suv" ), tripoint( x, y, 0 ), 0_degrees, 0, 0 );
+            REQUIRE( veh_ptr != nullptr );
+            vehs.push_back( veh_ptr );
+        }
+    }
+    return vehs;
+}
+
+TEST_CASE( "veh_at_finds_every_part", "[vehicle]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const std::vector<vehicle *> vehs = park_vehicles( here );
+
+    for( vehicle *veh : vehs ) {
+        for( const vpart_reference &vp : veh->get_all_parts() ) {
+            const optional_vpart_position ovp = here.veh_at( vp.pos() );
+            REQUIRE( ovp );
+            CHECK( &ovp->vehicle() == veh );
+        }
+    }
+
+    vehicle *removed = vehs.front();
+    const tripoint removed_pos = removed->global_pos3();
+    here.destroy_vehicle( removed );
+    here.reset_vehicle_cache();
+    CHECK_FALSE( here.veh_at( removed_pos ) );
+    CHECK( here.veh_at( vehs.back()->global_pos3() ) );
+}
+
+TEST_CASE( "veh_at_benchmark", "[.][vehicle][benchmark]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    park_vehicles( here );
+
+    BENCHMARK( "veh_at over the reality bubble" ) {
+        int found = 0;
+        for( const tripoint &p : here.points_on_zlevel( 0 ) ) {
+            if( here.veh_at( p ) ) {
+                found++;
+            }
+        }
+        return found;
+    };
+}
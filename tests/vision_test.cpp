@@ -717,3 +717,59 @@ TEST_CASE( "vision_see_into_vehicle", "[shadowcasting][vision]" )
 
     t.test();
 }
+
+static std::vector<float> lightmap_snapshot( const map &here, int z )
+{
+    const level_cache &cache = here.get_cache_ref( z );
+    std::vector<float> ret;
+    for( int x = 0; x < MAPSIZE_X; x++ ) {
+        for( int y = 0; y < MAPSIZE_Y; y++ ) {
+            for( quadrant q : {
+                     quadrant::NE, quadrant::SE, quadrant::SW, quadrant::NW
+                 } ) {
+                ret.push_back( cache.lm[x][y][q] );
+            }
+        }
+    }
+    return ret;
+}
+
+// The light from lamps and fires is only recast around changes,
+// so compare it with a lightmap generated from scratch after each change.
+TEST_CASE( "incremental_lightmap_matches_full_regeneration", "[shadowcasting][vision]" )
+{
+    clear_all_state();
+    calendar::turn = midnight;
+    map &here = get_map();
+    const ter_id t_utility_light( "t_utility_light" );
+    const ter_id t_brick_wall( "t_brick_wall" );
+    const ter_id t_floor( "t_floor" );
+    const tripoint center = get_player_character().pos();
+
+    const auto check_against_full = [&]() {
+        here.build_map_cache( center.z );
+        const std::vector<float> incremental = lightmap_snapshot( here, center.z );
+        here.invalidate_map_cache( center.z );
+        here.build_map_cache( center.z );
+        CHECK( incremental == lightmap_snapshot( here, center.z ) );
+    };
+
+    here.ter_set( center + point( 5, 0 ), t_utility_light );
+    here.ter_set( center + point( -20, 10 ), t_utility_light );
+    here.ter_set( center + point( 40, -30 ), t_utility_light );
+    check_against_full();
+
+    SECTION( "wall placed next to a light" ) {
+        here.ter_set( center + point( 6, 0 ), t_brick_wall );
+        here.ter_set( center + point( 6, 1 ), t_brick_wall );
+        check_against_full();
+    }
+    SECTION( "light removed" ) {
+        here.ter_set( center + point( -20, 10 ), t_floor );
+        check_against_full();
+    }
+    SECTION( "light added next to another" ) {
+        here.ter_set( center + point( 6, 0 ), t_utility_light );
+        check_against_full();
+    }
+}